@@ -58,11 +58,12 @@ if(NOT WIN32 AND ENCRYPTION_LINKAGE STREQUAL "STATIC")
             -static-libgcc -static-libstdc++)
         message(STATUS "Encryption linkage: STATIC (libc=${ENCRYPTION_LIBC}, runtime static)")
     endif()
-
-    find_package(Threads REQUIRED)
-    target_link_libraries(EncryptionLinkOptions INTERFACE Threads::Threads)
 endif()
 
+# scrypt의 병렬 ROMix 등 std::thread 사용
+find_package(Threads REQUIRED)
+target_link_libraries(EncryptionLinkOptions INTERFACE Threads::Threads)
+
 target_link_libraries(${SUB_PROJECT_NAME} PUBLIC EncryptionLinkOptions)
 
 if (NOT WIN32)
@@ -73,6 +74,35 @@ if (NOT WIN32)
         -mssse3
         -fno-exceptions -fno-rtti
     )
+
+    # 런타임 디스패치 대상 커널은 해당 ISA 플래그를 파일 단위로만 부여
+    # (PCH는 플래그가 달라 재사용 불가)
+    set(_enc_src "${CMAKE_CURRENT_SOURCE_DIR}/src/encryption")
+    set_source_files_properties(
+        "${_enc_src}/cipher/chacha20_avx2.cc"
+        "${_enc_src}/cipher/lea_avx2.cc"
+        "${_enc_src}/cipher/poly1305_avx2.cc"
+        "${_enc_src}/hash/keccak_avx2.cc"
+        "${_enc_src}/hash/lsh_avx2.cc"
+        "${_enc_src}/hash/pbkdf2_avx2.cc"
+        "${_enc_src}/hash/scrypt_avx2.cc"
+        "${_enc_src}/hash/sha256_avx2.cc"
+        "${_enc_src}/hash/sha256_multi_avx2.cc"
+        "${_enc_src}/hash/sha512_avx2.cc"
+        PROPERTIES COMPILE_OPTIONS "-mavx2" SKIP_PRECOMPILE_HEADERS ON
+    )
+    set_source_files_properties(
+        "${_enc_src}/cipher/chacha20_avx512.cc"
+        "${_enc_src}/hash/pbkdf2_avx512.cc"
+        "${_enc_src}/hash/sha256_multi_avx512.cc"
+        PROPERTIES COMPILE_OPTIONS "-mavx2;-mavx512f" SKIP_PRECOMPILE_HEADERS ON
+    )
+    set_source_files_properties(
+        "${_enc_src}/hash/sha1_ni.cc"
+        "${_enc_src}/hash/sha256_ni.cc"
+        PROPERTIES COMPILE_OPTIONS "-msha;-msse4.1" SKIP_PRECOMPILE_HEADERS ON
+    )
+    unset(_enc_src)
 else()
     add_compile_options(/utf-8)
 endif()
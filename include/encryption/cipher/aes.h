@@ -14,6 +14,9 @@ class AESImpl : public BlockCipherAlgorithm {
                       std::span<std::uint8_t> out) const noexcept final;
   ErrorStatus Decrypt(BlockCipherCTX& key, std::span<const std::uint8_t> block,
                       std::span<std::uint8_t> out) const noexcept final;
+  ErrorStatus EncryptBlocks(BlockCipherCTX& key,
+                            std::span<const std::uint8_t> blocks,
+                            std::span<std::uint8_t> out) const noexcept final;
 
   [[nodiscard]] [[nodiscard]] std::uint32_t GetBlockSize()
       const noexcept final {
@@ -35,6 +38,10 @@ class AESImpl : public BlockCipherAlgorithm {
   virtual void DecryptImpl(BlockCipherCTX& ctx,
                            std::span<const std::uint8_t> block,
                            std::span<std::uint8_t> out) const noexcept = 0;
+  // 기본 구현은 EncryptImpl을 블록마다 호출
+  virtual void EncryptBlocksImpl(BlockCipherCTX& ctx,
+                                 std::span<const std::uint8_t> blocks,
+                                 std::span<std::uint8_t> out) const noexcept;
 
   bool valid_ = false;
 };
@@ -51,6 +58,10 @@ class AesNi : public AESImpl {
                    std::span<std::uint8_t> out) const noexcept override;
   void DecryptImpl(BlockCipherCTX& ctx, std::span<const std::uint8_t> block,
                    std::span<std::uint8_t> out) const noexcept override;
+  // 8블록 인터리빙으로 aesenc 파이프라인 지연을 숨김
+  void EncryptBlocksImpl(BlockCipherCTX& ctx,
+                         std::span<const std::uint8_t> blocks,
+                         std::span<std::uint8_t> out) const noexcept override;
 };
 
 class AesSoft : public AESImpl {
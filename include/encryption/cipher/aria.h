@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "encryption/interfaces.h"
+
+namespace bedrock::cipher {
+
+// ARIA-128/192/256 (KS X 1213, RFC 5794)
+// 키 확장 시 암호화 키(ek)와 복호화 키(dk = 역순 + 확산 계층)를 모두 계산해
+// ctx.enc_round_keys / ctx.dec_round_keys에 저장. 복호화는 dk로 암호화와 같은 연산
+class Aria : public BlockCipherAlgorithm {
+ public:
+  Aria();
+  ~Aria() noexcept override;
+
+  // 단일 블록은 32-bit 테이블 경로
+  ErrorStatus Encrypt(BlockCipherCTX& ctx, std::span<const std::uint8_t> block,
+                      std::span<std::uint8_t> out) const noexcept override;
+  ErrorStatus Decrypt(BlockCipherCTX& ctx, std::span<const std::uint8_t> block,
+                      std::span<std::uint8_t> out) const noexcept override;
+  ErrorStatus KeyExpantion(std::span<const std::uint8_t> key,
+                           BlockCipherCTX& ctx) const noexcept override;
+
+  // AES-NI 사용 가능 시 S-box를 aesenclast/aesdeclast + pshufb 아핀 변환으로
+  // 계산하는 4-way 상수 시간 커널로 처리
+  ErrorStatus EncryptBlocks(BlockCipherCTX& ctx,
+                            std::span<const std::uint8_t> blocks,
+                            std::span<std::uint8_t> out) const noexcept override;
+  ErrorStatus DecryptBlocks(BlockCipherCTX& ctx,
+                            std::span<const std::uint8_t> blocks,
+                            std::span<std::uint8_t> out) const noexcept override;
+
+  [[nodiscard]] std::uint32_t GetBlockSize() const noexcept override {
+    return 128;
+  }
+  [[nodiscard]] const char* GetAlgorithmName() const noexcept override {
+    return "ARIA";
+  }
+
+ private:
+  using BlocksFn = void (*)(const std::uint8_t* round_keys, std::size_t nr,
+                            const std::uint8_t* in, std::uint8_t* out,
+                            std::size_t blocks);
+
+  BlocksFn crypt_blocks_;
+};
+
+// 블록 커널. round_keys는 16바이트 라운드 키 nr + 1개
+// (ek를 넘기면 암호화, dk를 넘기면 복호화)
+namespace aria {
+
+void CryptBlocksTable(const std::uint8_t* round_keys, std::size_t nr,
+                      const std::uint8_t* in, std::uint8_t* out,
+                      std::size_t blocks) noexcept;
+// 4-way, AES-NI + SSSE3
+void CryptBlocksAesNi(const std::uint8_t* round_keys, std::size_t nr,
+                      const std::uint8_t* in, std::uint8_t* out,
+                      std::size_t blocks) noexcept;
+
+}  // namespace aria
+
+}  // namespace bedrock::cipher
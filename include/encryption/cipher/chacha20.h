@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/interfaces.h"
+
+namespace bedrock::cipher {
+
+// ChaCha20 스트림 암호 (RFC 8439, 96-bit nonce / 32-bit 블록 카운터)
+class ChaCha20 {
+ public:
+  static constexpr std::size_t kKeyBytes = 32;
+  static constexpr std::size_t kNonceBytes = 12;
+  static constexpr std::size_t kBlockBytes = 64;
+
+  ChaCha20();
+
+  ErrorStatus SetKey(std::span<const std::uint8_t> key,
+                     std::span<const std::uint8_t> nonce,
+                     std::uint32_t counter = 0) noexcept;
+
+  // 키스트림과 XOR, 호출 사이에 키스트림 위치가 이어짐 (in-place 가능).
+  // 32-bit 블록 카운터가 0xffffffff 블록을 넘어 한 바퀴 돌아야 하는 호출은
+  // 아무것도 쓰지 않고 kFailure
+  ErrorStatus Process(std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output) noexcept;
+
+  // 다음 Process가 지정한 블록 카운터부터 시작하도록 위치를 옮김
+  void Seek(std::uint32_t counter) noexcept;
+
+  // 지정한 카운터 위치의 키스트림 블록 (내부 위치는 변경하지 않음)
+  void KeystreamBlock(std::uint32_t counter,
+                      std::span<std::uint8_t, kBlockBytes> out) const noexcept;
+
+  [[nodiscard]] bool IsValid() const noexcept { return valid_; }
+
+ private:
+  using XorBlocksFn = void (*)(const std::uint32_t* state,
+                               const std::uint8_t* in, std::uint8_t* out,
+                               std::size_t blocks);
+
+  XorBlocksFn xor_blocks_;
+  std::array<std::uint32_t, 16> state_{};
+  std::array<std::uint8_t, kBlockBytes> keystream_{};
+  std::size_t keystream_pos_ = kBlockBytes;
+  // state_[12]부터 카운터가 돌기 전까지 쓸 수 있는 블록 수
+  std::uint64_t blocks_left_ = 0;
+  bool valid_ = false;
+};
+
+// 블록 커널. state[12]부터 카운터를 1씩 올리며 blocks * 64 바이트를 XOR
+// 넓은 커널은 처리하고 남은 블록을 한 단계 좁은 커널로 넘김
+namespace chacha20 {
+
+void XorBlocksScalar(const std::uint32_t* state, const std::uint8_t* in,
+                     std::uint8_t* out, std::size_t blocks) noexcept;
+// 4-way, SSSE3
+void XorBlocksSsse3(const std::uint32_t* state, const std::uint8_t* in,
+                    std::uint8_t* out, std::size_t blocks) noexcept;
+// 8-way, AVX2
+void XorBlocksAvx2(const std::uint32_t* state, const std::uint8_t* in,
+                   std::uint8_t* out, std::size_t blocks) noexcept;
+// 16-way, AVX-512F
+void XorBlocksAvx512(const std::uint32_t* state, const std::uint8_t* in,
+                     std::uint8_t* out, std::size_t blocks) noexcept;
+
+}  // namespace chacha20
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "encryption/interfaces.h"
+
+namespace bedrock::cipher {
+
+// LEA-128/192/256 (KS X 3246)
+// 라운드 키는 라운드마다 32-bit 워드 6개를 ctx.enc_round_keys에 이어서 저장
+// (복호화도 같은 키를 역순으로 사용)
+class Lea : public BlockCipherAlgorithm {
+ public:
+  Lea();
+  ~Lea() noexcept override;
+
+  ErrorStatus Encrypt(BlockCipherCTX& ctx, std::span<const std::uint8_t> block,
+                      std::span<std::uint8_t> out) const noexcept override;
+  ErrorStatus Decrypt(BlockCipherCTX& ctx, std::span<const std::uint8_t> block,
+                      std::span<std::uint8_t> out) const noexcept override;
+  ErrorStatus KeyExpantion(std::span<const std::uint8_t> key,
+                           BlockCipherCTX& ctx) const noexcept override;
+
+  // 4-way(SSE2) / 8-way(AVX2) 커널로 처리
+  ErrorStatus EncryptBlocks(BlockCipherCTX& ctx,
+                            std::span<const std::uint8_t> blocks,
+                            std::span<std::uint8_t> out) const noexcept override;
+  ErrorStatus DecryptBlocks(BlockCipherCTX& ctx,
+                            std::span<const std::uint8_t> blocks,
+                            std::span<std::uint8_t> out) const noexcept override;
+
+  [[nodiscard]] std::uint32_t GetBlockSize() const noexcept override {
+    return 128;
+  }
+  [[nodiscard]] const char* GetAlgorithmName() const noexcept override {
+    return "LEA";
+  }
+
+ private:
+  using BlocksFn = void (*)(const std::uint8_t* round_keys, std::size_t nr,
+                            const std::uint8_t* in, std::uint8_t* out,
+                            std::size_t blocks);
+
+  BlocksFn encrypt_blocks_;
+  BlocksFn decrypt_blocks_;
+};
+
+// 블록 커널. 넓은 커널은 처리하고 남은 블록을 한 단계 좁은 커널로 넘김
+namespace lea {
+
+inline constexpr std::size_t kRoundKeyWords = 6;
+
+// 라운드 round의 키 워드. round_keys는 enc_round_keys의 바이트이므로
+// uint32_t 포인터로 바로 읽지 않고 memcpy로 읽음 (strict aliasing)
+inline std::array<std::uint32_t, kRoundKeyWords> RoundKey(
+    const std::uint8_t* round_keys, std::size_t round) noexcept {
+  std::array<std::uint32_t, kRoundKeyWords> rk;
+  std::memcpy(rk.data(), round_keys + (round * sizeof(rk)), sizeof(rk));
+  return rk;
+}
+
+void EncryptBlocksScalar(const std::uint8_t* round_keys, std::size_t nr,
+                         const std::uint8_t* in, std::uint8_t* out,
+                         std::size_t blocks) noexcept;
+void DecryptBlocksScalar(const std::uint8_t* round_keys, std::size_t nr,
+                         const std::uint8_t* in, std::uint8_t* out,
+                         std::size_t blocks) noexcept;
+// 4-way, SSE2
+void EncryptBlocksSse2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept;
+void DecryptBlocksSse2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept;
+// 8-way, AVX2
+void EncryptBlocksAvx2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept;
+void DecryptBlocksAvx2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept;
+
+}  // namespace lea
+
+}  // namespace bedrock::cipher
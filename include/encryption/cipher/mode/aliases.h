@@ -95,4 +95,108 @@ class AesEcb {
   op_mode::ModeContext ctx_;
 };
 
+// AES-CFB1 모드 편의성 단축 (OpenSSL 대신 네이티브 구현 사용)
+class AesCfb1 {
+ public:
+  AesCfb1(const std::span<const std::uint8_t> key,
+          const std::span<const std::uint8_t> iv)
+      : impl_(AESPicker::PickImpl()),
+        mode_impl_(op_mode::PickImpl("CFB1", false)),
+        ctx_(impl_, key, iv, op_mode::CipherMode::kEncrypt, 0, false) {}
+  virtual ~AesCfb1();
+
+  ErrorStatus Process(const std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output) {
+    return mode_impl_->Process(impl_, ctx_, input, output);
+  }
+
+  AesCfb1& operator<<(const op_mode::CipherMode& mode) {
+    ctx_.SetMode(mode);
+    return *this;
+  }
+
+ private:
+  std::shared_ptr<BlockCipherAlgorithm> impl_;
+  std::shared_ptr<op_mode::OperationMode> mode_impl_;
+  op_mode::ModeContext ctx_;
+};
+
+// AES-CFB8 모드 편의성 단축 (OpenSSL 대신 네이티브 구현 사용)
+class AesCfb8 {
+ public:
+  AesCfb8(const std::span<const std::uint8_t> key,
+          const std::span<const std::uint8_t> iv)
+      : impl_(AESPicker::PickImpl()),
+        mode_impl_(op_mode::PickImpl("CFB8", false)),
+        ctx_(impl_, key, iv, op_mode::CipherMode::kEncrypt, 0, false) {}
+  virtual ~AesCfb8();
+
+  ErrorStatus Process(const std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output) {
+    return mode_impl_->Process(impl_, ctx_, input, output);
+  }
+
+  AesCfb8& operator<<(const op_mode::CipherMode& mode) {
+    ctx_.SetMode(mode);
+    return *this;
+  }
+
+ private:
+  std::shared_ptr<BlockCipherAlgorithm> impl_;
+  std::shared_ptr<op_mode::OperationMode> mode_impl_;
+  op_mode::ModeContext ctx_;
+};
+
+// AES-CFB128 모드 편의성 단축 (OpenSSL 대신 네이티브 구현 사용)
+class AesCfb128 {
+ public:
+  AesCfb128(const std::span<const std::uint8_t> key,
+            const std::span<const std::uint8_t> iv)
+      : impl_(AESPicker::PickImpl()),
+        mode_impl_(op_mode::PickImpl("CFB", false)),
+        ctx_(impl_, key, iv, op_mode::CipherMode::kEncrypt, 0, false) {}
+  virtual ~AesCfb128();
+
+  ErrorStatus Process(const std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output) {
+    return mode_impl_->Process(impl_, ctx_, input, output);
+  }
+
+  AesCfb128& operator<<(const op_mode::CipherMode& mode) {
+    ctx_.SetMode(mode);
+    return *this;
+  }
+
+ private:
+  std::shared_ptr<BlockCipherAlgorithm> impl_;
+  std::shared_ptr<op_mode::OperationMode> mode_impl_;
+  op_mode::ModeContext ctx_;
+};
+
+// AES-OFB 모드 편의성 단축 (OpenSSL 대신 네이티브 구현 사용)
+class AesOfb {
+ public:
+  AesOfb(const std::span<const std::uint8_t> key,
+         const std::span<const std::uint8_t> iv)
+      : impl_(AESPicker::PickImpl()),
+        mode_impl_(op_mode::PickImpl("OFB", false)),
+        ctx_(impl_, key, iv, op_mode::CipherMode::kEncrypt, 0, false) {}
+  virtual ~AesOfb();
+
+  ErrorStatus Process(const std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output) {
+    return mode_impl_->Process(impl_, ctx_, input, output);
+  }
+
+  AesOfb& operator<<(const op_mode::CipherMode& mode) {
+    ctx_.SetMode(mode);
+    return *this;
+  }
+
+ private:
+  std::shared_ptr<BlockCipherAlgorithm> impl_;
+  std::shared_ptr<op_mode::OperationMode> mode_impl_;
+  op_mode::ModeContext ctx_;
+};
+
 }  // namespace bedrock::cipher
@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "../aes.h"
+#include "encryption/cipher/mode/operation.h"
+#include "encryption/hash/sha256_core.h"
+
+namespace bedrock::cipher {
+
+// AES-CBC + HMAC-SHA256 encrypt-then-MAC (MAC 입력은 IV || 암호문)
+// AES 블록 하나를 처리할 때마다 직전에 채워진 MAC 블록의 SHA-256 라운드를
+// 16개씩 AES 라운드 사이에 끼워 넣어 두 연산의 지연을 서로 숨김
+class AesCbcHmacSha256 {
+ public:
+  static constexpr std::size_t kTagBytes = hash::sha256::kDigestBytes;
+
+  AesCbcHmacSha256(std::span<const std::uint8_t> key,
+                   std::span<const std::uint8_t> iv,
+                   std::span<const std::uint8_t> mac_key);
+  virtual ~AesCbcHmacSha256();
+
+  // input.size()는 16의 배수, in-place 처리 가능
+  ErrorStatus Process(std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output);
+
+  // 지금까지 처리한 암호문에 대한 태그 (상태는 변경하지 않음)
+  [[nodiscard]] std::array<std::uint8_t, kTagBytes> Tag() const noexcept;
+  // 상수 시간 비교
+  [[nodiscard]] bool Verify(std::span<const std::uint8_t> tag) const noexcept;
+
+  // 방향을 바꾸고 IV와 MAC을 처음 상태로 되돌림
+  AesCbcHmacSha256& operator<<(const op_mode::CipherMode& mode);
+
+ private:
+  void Restart() noexcept;
+  // 블록 암호가 실패하면 체인 / MAC을 건드리지 않고 false
+  bool StitchedBlock(const std::uint8_t* in, std::uint8_t* out) noexcept;
+  void AbsorbCipherBlock(const std::uint8_t* block) noexcept;
+  void RunPendingRounds(std::size_t count) noexcept;
+
+  bool aesni_;
+  std::shared_ptr<AESImpl> impl_;
+  op_mode::ModeContext ctx_;
+
+  hash::sha256::State inner_midstate_{};
+  hash::sha256::State outer_midstate_{};
+  hash::sha256::State inner_{};
+
+  std::array<std::uint8_t, hash::sha256::kBlockBytes> mac_buffer_{};
+  std::size_t mac_buffered_ = 0;
+  std::uint64_t mac_bytes_ = 0;
+
+  // 라운드가 진행 중인 MAC 블록 (pending_round_ == 64 이면 없음)
+  hash::sha256::Schedule pending_w_{};
+  hash::sha256::State pending_v_{};
+  std::size_t pending_round_ = 64;
+};
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,23 @@
+﻿#pragma once
+#include "operation.h"
+
+namespace bedrock::cipher::op_mode {
+
+// CFB 운영 모드 (segment 크기 1, 8, 128 bit)
+// - CFB1: 입력 바이트를 MSB부터 1 bit씩 segment로 처리
+// - CFB8: 임의 길이 입력, CFB128: 블록 크기의 배수 입력
+// 복호화는 키스트림 입력이 모두 암호문에서 나오므로 EncryptBlocks로 병렬 처리
+class CFB : public OperationMode {
+ public:
+  explicit CFB(std::uint32_t segment_bits = 128);
+
+  ErrorStatus Process(
+      std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
+      ModeContext& ctx, std::span<const std::uint8_t> input,
+      std::span<std::uint8_t> output, bool final = true) final;
+
+ private:
+  std::uint32_t segment_bits_;
+};
+
+};  // namespace bedrock::cipher::op_mode
@@ -0,0 +1,48 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "../chacha20.h"
+#include "../poly1305.h"
+#include "encryption/cipher/mode/operation.h"
+
+namespace bedrock::cipher {
+
+// ChaCha20-Poly1305 AEAD (RFC 8439)
+class ChaCha20Poly1305 {
+ public:
+  static constexpr std::size_t kTagBytes = Poly1305::kTagBytes;
+  // 본문은 카운터 1부터이므로 (2^32 - 1) 블록 = 2^38 - 64 바이트 (RFC 8439)
+  static constexpr std::uint64_t kMaxTextBytes = (std::uint64_t{1} << 38) - 64;
+
+  ChaCha20Poly1305(std::span<const std::uint8_t> key,
+                   std::span<const std::uint8_t> nonce);
+  virtual ~ChaCha20Poly1305();
+
+  // 첫 Process 이전에만 호출 가능, 여러 번 나눠 넣을 수 있음
+  ErrorStatus AddAad(std::span<const std::uint8_t> aad);
+  // 임의 길이, in-place 처리 가능. 누적 길이가 kMaxTextBytes를 넘으면 kFailure
+  ErrorStatus Process(std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output);
+
+  // 상태는 변경하지 않음
+  [[nodiscard]] std::array<std::uint8_t, kTagBytes> Tag() const noexcept;
+  // 상수 시간 비교
+  [[nodiscard]] bool Verify(std::span<const std::uint8_t> tag) const noexcept;
+
+  // 방향을 바꾸고 키스트림, AAD, MAC을 처음 상태로 되돌림
+  ChaCha20Poly1305& operator<<(const op_mode::CipherMode& mode);
+
+ private:
+  void Restart() noexcept;
+
+  ChaCha20 chacha_;
+  Poly1305 poly_;
+  op_mode::CipherMode mode_ = op_mode::CipherMode::kEncrypt;
+  std::uint64_t aad_bytes_ = 0;
+  std::uint64_t text_bytes_ = 0;
+  bool aad_closed_ = false;
+};
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,17 @@
+﻿#pragma once
+#include "operation.h"
+
+namespace bedrock::cipher::op_mode {
+
+// OFB 운영 모드 (암/복호화 동일, 입력은 블록 크기의 배수)
+class OFB : public OperationMode {
+ public:
+  OFB() { algorithm_name = "OFB"; }
+
+  ErrorStatus Process(
+      std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
+      ModeContext& ctx, std::span<const std::uint8_t> input,
+      std::span<std::uint8_t> output, bool final = true) final;
+};
+
+};  // namespace bedrock::cipher::op_mode
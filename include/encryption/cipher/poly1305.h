@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/interfaces.h"
+
+namespace bedrock::cipher {
+
+// Poly1305 일회용 MAC (RFC 8439). 누산기는 26-bit limb 5개
+class Poly1305 {
+ public:
+  static constexpr std::size_t kKeyBytes = 32;
+  static constexpr std::size_t kTagBytes = 16;
+  static constexpr std::size_t kBlockBytes = 16;
+  // r^1 ~ r^4 (4-way 경로에서 사용)
+  using Powers = std::array<std::array<std::uint32_t, 5>, 4>;
+
+  Poly1305();
+
+  ErrorStatus SetKey(std::span<const std::uint8_t> key) noexcept;
+  void Update(std::span<const std::uint8_t> data) noexcept;
+  // 상태는 변경하지 않음
+  [[nodiscard]] std::array<std::uint8_t, kTagBytes> Final() const noexcept;
+
+ private:
+  void Blocks(const std::uint8_t* data, std::size_t blocks) noexcept;
+
+  bool avx2_;
+  std::array<std::uint32_t, 5> h_{};
+  Powers r_powers_{};
+  std::array<std::uint32_t, 4> pad_{};
+  std::array<std::uint8_t, kBlockBytes> buffer_{};
+  std::size_t buffered_ = 0;
+};
+
+namespace poly1305 {
+
+// h = h * r (mod 2^130 - 5)
+void Multiply(std::uint32_t* h, const std::uint32_t* r) noexcept;
+// 16바이트 블록마다 h = (h + m + hibit) * r
+void BlocksScalar(std::uint32_t* h, const std::uint32_t* r,
+                  const std::uint8_t* data, std::size_t blocks,
+                  std::uint32_t hibit) noexcept;
+// 4개 블록씩 r^4로 병렬 누산 후 합침. 처리한 블록 수(4의 배수)를 반환
+std::size_t BlocksAvx2(std::uint32_t* h, const Poly1305::Powers& r_powers,
+                       const std::uint8_t* data, std::size_t blocks) noexcept;
+
+}  // namespace poly1305
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,103 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace bedrock::hash {
+
+enum class FileReadMode {
+  // 작은 파일은 한 번에 읽고, map_limit 이하의 일반 파일은 mmap,
+  // 더 크거나 매핑할 수 없는 입력(파이프 등)은 파이프라인
+  kAuto,
+  // 읽기 전용 매핑 + 순차 접근 힌트 (MADV_SEQUENTIAL). 일반 파일만이며
+  // 읽는 동안 다른 프로세스가 파일을 자르면 SIGBUS가 날 수 있음
+  kMap,
+  // 읽기 스레드가 버퍼 두 개를 번갈아 채우는 동안 호출 스레드가 해시
+  kPipeline,
+};
+
+struct FileReadOptions {
+  FileReadMode mode = FileReadMode::kAuto;
+  // 파이프라인 버퍼 하나의 크기이자 매핑을 공급하는 단위 (4 KiB 배수로 올림)
+  std::size_t chunk_bytes = std::size_t{4} << 20;
+  std::uint64_t map_limit = std::uint64_t{1} << 32;
+  // 파이프라인에서 페이지 캐시를 거치지 않음 (O_DIRECT /
+  // FILE_FLAG_NO_BUFFERING). 파일 시스템이 지원하지 않으면 일반 읽기
+  bool direct_io = false;
+};
+
+// 읽기 전용 파일 하나. 순차 읽기와 전체 매핑을 플랫폼별로 감쌈
+class InputFile {
+ public:
+  InputFile() noexcept = default;
+  InputFile(const InputFile&) = delete;
+  InputFile& operator=(const InputFile&) = delete;
+  ~InputFile();
+
+  bool Open(const std::filesystem::path& path) noexcept;
+  // 페이지 캐시를 거치지 않도록 전환. 안 되면 그대로 일반 읽기
+  void EnableDirect() noexcept;
+  // 최대 bytes를 읽음. 파일 끝이면 0, 실패하면 -1
+  std::ptrdiff_t Read(std::uint8_t* out, std::size_t bytes) noexcept;
+  // offset부터 최대 bytes를 읽음. 파일 위치를 쓰지 않으므로 여러 스레드가
+  // 함께 불러도 됨. 파일 끝이면 0, 실패하면 -1
+  std::ptrdiff_t ReadAt(std::uint8_t* out, std::size_t bytes,
+                        std::uint64_t offset) noexcept;
+  // 일반 파일 전체를 읽기 전용으로 매핑 (순차 접근 힌트 포함).
+  // 빈 파일이거나 실패하면 nullptr
+  const std::uint8_t* Map() noexcept;
+  // 매핑의 [offset, offset + bytes)를 곧 읽는다고 알림
+  void Prefetch(std::size_t offset, std::size_t bytes) noexcept;
+
+  [[nodiscard]] bool Regular() const noexcept { return regular; }
+  [[nodiscard]] std::uint64_t Size() const noexcept { return size; }
+
+ private:
+#ifdef _WIN32
+  void* file = nullptr;
+  void* file_mapping = nullptr;
+#else
+  int file = -1;
+#endif
+  const std::uint8_t* mapping = nullptr;
+  bool regular = false;
+  std::uint64_t size = 0;
+};
+
+using ChunkSink = void (*)(void* context,
+                           std::span<const std::uint8_t> chunk) noexcept;
+
+// 파일 내용을 앞에서부터 순서대로 sink에 넘김. 조각은 복사 없이 매핑이나
+// 읽기 버퍼를 그대로 가리키며 sink가 돌아오면 재사용됨.
+// 열기 / 읽기에 실패하면 false (그 전까지 넘긴 조각은 이미 전달됨)
+bool ReadFileChunks(const std::filesystem::path& path,
+                    const FileReadOptions& options, ChunkSink sink,
+                    void* context) noexcept;
+
+// Update(std::span<const std::uint8_t>)가 있는 해시(SHA<>, SHA3, LSH,
+// HmacSha256 등)에 파일 내용을 공급. 다이제스트는 호출자가 꺼냄
+template <typename Hasher>
+bool HashFile(const std::filesystem::path& path, Hasher& hasher,
+              const FileReadOptions& options = {}) noexcept {
+  return ReadFileChunks(
+      path, options,
+      [](void* context, std::span<const std::uint8_t> chunk) noexcept {
+        static_cast<Hasher*>(context)->Update(chunk);
+      },
+      &hasher);
+}
+
+// 예: std::array<std::byte, 32> digest; DigestFile<SHA256>(path, digest)
+template <typename Hasher, typename Digest>
+bool DigestFile(const std::filesystem::path& path, Digest& digest,
+                const FileReadOptions& options = {}) noexcept {
+  Hasher hasher;
+  if (!HashFile(path, hasher, options)) {
+    return false;
+  }
+  digest = hasher.Digest();
+  return true;
+}
+
+}  // namespace bedrock::hash
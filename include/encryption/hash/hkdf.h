@@ -0,0 +1,47 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/hmac.h"
+
+namespace bedrock::hash {
+
+struct HkdfExpandRequest {
+  std::span<const std::uint8_t> info;
+  std::span<std::uint8_t> out;
+};
+
+// HKDF-SHA256 (RFC 5869). PRK 하나에 HMAC 키(ipad / opad 중간 상태)를
+// 한 번만 잡아 두고 그 PRK에서 나오는 하위 키를 모두 유도
+class HkdfSha256 {
+ public:
+  static constexpr std::size_t kPrkBytes = sha256::kDigestBytes;
+  static constexpr std::size_t kMaxOutputBytes = 255 * sha256::kDigestBytes;
+  using Prk = std::array<std::uint8_t, kPrkBytes>;
+
+  // PRK = HMAC(salt, ikm). 빈 salt는 0 32바이트와 같음
+  [[nodiscard]] static Prk Extract(std::span<const std::uint8_t> salt,
+                                   std::span<const std::uint8_t> ikm) noexcept;
+
+  explicit HkdfSha256(std::span<const std::uint8_t> prk) noexcept;
+
+  // out 전체를 채움. out이 비었거나 255 * 32바이트를 넘으면 false
+  bool Expand(std::span<const std::uint8_t> info,
+              std::span<std::uint8_t> out) const noexcept;
+  // 요청마다 Expand. 요청 하나의 T(1), T(2), ... 연쇄는 순차지만 서로 다른
+  // 요청은 독립이라 SHA-256 레인(AVX-512F 16개, AVX2 8개)에 나눠 함께 진행.
+  // 하나라도 길이가 맞지 않으면 아무것도 쓰지 않고 false
+  bool ExpandMany(std::span<const HkdfExpandRequest> requests) const noexcept;
+
+ private:
+  HmacSha256 key;
+};
+
+// Extract 후 Expand
+bool Hkdf(std::span<const std::uint8_t> salt, std::span<const std::uint8_t> ikm,
+          std::span<const std::uint8_t> info,
+          std::span<std::uint8_t> out) noexcept;
+
+}  // namespace bedrock::hash
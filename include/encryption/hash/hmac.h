@@ -0,0 +1,60 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/sha256_core.h"
+
+namespace bedrock::hash {
+
+// HMAC-SHA256 (RFC 2104). 키를 정할 때 ipad / opad 블록을 한 번씩 압축해
+// 중간 상태로 저장하므로 메시지마다 드는 비용은 메시지 블록 + 압축 두 번
+class HmacSha256 {
+ public:
+  static constexpr std::size_t kTagBytes = sha256::kDigestBytes;
+  using Tag = std::array<std::uint8_t, kTagBytes>;
+
+  explicit HmacSha256(std::span<const std::uint8_t> key) noexcept;
+
+  // 한 번에 계산. 스트리밍 상태는 건드리지 않음
+  [[nodiscard]] Tag Mac(std::span<const std::uint8_t> message) const noexcept;
+  // 상수 시간 비교. tag는 32바이트 전체만 받음
+  [[nodiscard]] bool Verify(std::span<const std::uint8_t> message,
+                            std::span<const std::uint8_t> tag) const noexcept;
+
+  void Update(std::span<const std::uint8_t> data) noexcept;
+  // 태그를 내고 같은 키의 처음 상태로 돌아감
+  Tag Final() noexcept;
+  void Reset() noexcept;
+
+  [[nodiscard]] const sha256::State& InnerMidstate() const noexcept {
+    return inner_midstate;
+  }
+  [[nodiscard]] const sha256::State& OuterMidstate() const noexcept {
+    return outer_midstate;
+  }
+
+ private:
+  sha256::State inner_midstate{};
+  sha256::State outer_midstate{};
+
+  sha256::State inner{};
+  std::array<std::uint8_t, sha256::kBlockBytes> buffer{};
+  std::size_t buffered = 0;
+  std::uint64_t message_bytes = 0;
+};
+
+struct HmacVerifyItem {
+  const HmacSha256* key = nullptr;
+  std::span<const std::uint8_t> message;
+  std::span<const std::uint8_t> tag;
+};
+
+// valid[i] = items[i].tag가 맞는지. valid가 items보다 짧으면 false.
+// 항목마다 키가 달라도 되며, 안쪽 / 바깥쪽 해시를 SHA-256 레인
+// (AVX-512F 16개, AVX2 8개)에 섞어 넣어 함께 압축. 둘 다 없으면 항목마다 Verify
+bool VerifyMany(std::span<const HmacVerifyItem> items,
+                std::span<bool> valid) noexcept;
+
+}  // namespace bedrock::hash
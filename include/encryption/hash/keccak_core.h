@@ -0,0 +1,119 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Keccak-f[1600] 순열. SHA-3 / SHAKE 스펀지가 공유
+namespace bedrock::hash::keccak {
+
+// 레인 A[x, y]는 state[x + 5y]
+using State = std::array<std::uint64_t, 25>;
+
+inline constexpr std::size_t kStateBytes = 200;
+inline constexpr std::size_t kRounds = 24;
+
+inline constexpr std::array<std::uint64_t, kRounds> kRoundConstants = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+    0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+    0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+    0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+    0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+    0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+
+constexpr std::uint64_t Rotl(std::uint64_t x, std::uint32_t n) {
+  return (x << n) | (x >> (64 - n));
+}
+
+constexpr std::uint64_t LoadLittleEndian64(const std::uint8_t* p) {
+  std::uint64_t v = 0;
+  for (std::size_t i = 0; i < 8; i++) {
+    v |= static_cast<std::uint64_t>(p[i]) << (i * 8);
+  }
+  return v;
+}
+
+// 회전량이 즉시값이 되도록 단계마다 레인을 풀어 씀
+constexpr void Permute(State& state) {
+  // 지역 복사본이어야 레인이 레지스터에 머묾
+  State a = state;
+  for (std::size_t round = 0; round < kRounds; round++) {
+    // θ
+    const std::uint64_t c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+    const std::uint64_t c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+    const std::uint64_t c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+    const std::uint64_t c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+    const std::uint64_t c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+    const std::uint64_t d0 = c4 ^ Rotl(c1, 1);
+    const std::uint64_t d1 = c0 ^ Rotl(c2, 1);
+    const std::uint64_t d2 = c1 ^ Rotl(c3, 1);
+    const std::uint64_t d3 = c2 ^ Rotl(c4, 1);
+    const std::uint64_t d4 = c3 ^ Rotl(c0, 1);
+
+    // ρ, π: B[y, 2x + 3y] = rotl(A[x, y] ^ D[x], r[x, y])
+    std::array<std::uint64_t, 25> b = {};
+    b[0] = a[0] ^ d0;
+    b[10] = Rotl(a[1] ^ d1, 1);
+    b[20] = Rotl(a[2] ^ d2, 62);
+    b[5] = Rotl(a[3] ^ d3, 28);
+    b[15] = Rotl(a[4] ^ d4, 27);
+    b[16] = Rotl(a[5] ^ d0, 36);
+    b[1] = Rotl(a[6] ^ d1, 44);
+    b[11] = Rotl(a[7] ^ d2, 6);
+    b[21] = Rotl(a[8] ^ d3, 55);
+    b[6] = Rotl(a[9] ^ d4, 20);
+    b[7] = Rotl(a[10] ^ d0, 3);
+    b[17] = Rotl(a[11] ^ d1, 10);
+    b[2] = Rotl(a[12] ^ d2, 43);
+    b[12] = Rotl(a[13] ^ d3, 25);
+    b[22] = Rotl(a[14] ^ d4, 39);
+    b[23] = Rotl(a[15] ^ d0, 41);
+    b[8] = Rotl(a[16] ^ d1, 45);
+    b[18] = Rotl(a[17] ^ d2, 15);
+    b[3] = Rotl(a[18] ^ d3, 21);
+    b[13] = Rotl(a[19] ^ d4, 8);
+    b[14] = Rotl(a[20] ^ d0, 18);
+    b[24] = Rotl(a[21] ^ d1, 2);
+    b[9] = Rotl(a[22] ^ d2, 61);
+    b[19] = Rotl(a[23] ^ d3, 56);
+    b[4] = Rotl(a[24] ^ d4, 14);
+
+    // χ
+    a[0] = b[0] ^ (~b[1] & b[2]);
+    a[1] = b[1] ^ (~b[2] & b[3]);
+    a[2] = b[2] ^ (~b[3] & b[4]);
+    a[3] = b[3] ^ (~b[4] & b[0]);
+    a[4] = b[4] ^ (~b[0] & b[1]);
+    a[5] = b[5] ^ (~b[6] & b[7]);
+    a[6] = b[6] ^ (~b[7] & b[8]);
+    a[7] = b[7] ^ (~b[8] & b[9]);
+    a[8] = b[8] ^ (~b[9] & b[5]);
+    a[9] = b[9] ^ (~b[5] & b[6]);
+    a[10] = b[10] ^ (~b[11] & b[12]);
+    a[11] = b[11] ^ (~b[12] & b[13]);
+    a[12] = b[12] ^ (~b[13] & b[14]);
+    a[13] = b[13] ^ (~b[14] & b[10]);
+    a[14] = b[14] ^ (~b[10] & b[11]);
+    a[15] = b[15] ^ (~b[16] & b[17]);
+    a[16] = b[16] ^ (~b[17] & b[18]);
+    a[17] = b[17] ^ (~b[18] & b[19]);
+    a[18] = b[18] ^ (~b[19] & b[15]);
+    a[19] = b[19] ^ (~b[15] & b[16]);
+    a[20] = b[20] ^ (~b[21] & b[22]);
+    a[21] = b[21] ^ (~b[22] & b[23]);
+    a[22] = b[22] ^ (~b[23] & b[24]);
+    a[23] = b[23] ^ (~b[24] & b[20]);
+    a[24] = b[24] ^ (~b[20] & b[21]);
+
+    // ι
+    a[0] ^= kRoundConstants[round];
+  }
+  state = a;
+}
+
+// 독립된 상태 4개를 ymm 레인 하나씩에 두고 함께 순열.
+// states는 레인 우선 배치: states[lane_index * 4 + 상태 번호]
+void PermuteX4Avx2(std::uint64_t* states) noexcept;
+
+}  // namespace bedrock::hash::keccak
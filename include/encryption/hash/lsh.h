@@ -0,0 +1,134 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "common.h"
+#include "encryption/hash/lsh_core.h"
+
+namespace bedrock::hash {
+
+// LSH-Family-DigestLen (KS X 3262). Family는 256 / 512, DigestLen은 출력
+// 비트 수. bit 단위 입력은 마지막 Update에서만
+template <std::uint32_t Family, std::uint32_t DigestLen = Family>
+class LSH : public HashAlgorithm<DigestLen> {
+  static_assert(Family == 256 || Family == 512);
+  static_assert(DigestLen % 8 == 0 && DigestLen <= Family);
+
+  using Word = std::conditional_t<Family == 512, std::uint64_t, std::uint32_t>;
+
+ public:
+  static constexpr std::size_t kBlockBytes = lsh::kBlockBytes<Word>;
+  static constexpr lsh::ChainVar<Word> kIv =
+      lsh::InitialValue<Word>(DigestLen);
+
+  LSH() {
+    this->digest_size = DigestLen;
+    this->inner_block_size = kBlockBytes * 8;
+    Reset();
+  }
+
+  std::array<std::byte, DigestLen / 8> Digest(
+      std::span<const std::uint8_t> data) const final override {
+    lsh::ChainVar<Word> one_shot = kIv;
+    const std::size_t blocks = data.size() / kBlockBytes;
+    lsh::CompressBlocks(one_shot, data.data(), blocks);
+    return Finish(one_shot, data.subspan(blocks * kBlockBytes));
+  }
+
+  // bit_length가 8의 배수가 아니면 이 입력으로 메시지가 끝남. 마지막
+  // 바이트의 남는 bit는 상위 bit부터 메시지 bit. message보다 길면 거부
+  void Update(const HashAlgorithmInputData& data) final override {
+    const auto* bytes =
+        reinterpret_cast<const std::uint8_t*>(data.message.data());
+    const std::size_t whole = data.bit_length / 8;
+    const std::size_t bits = data.bit_length % 8;
+    if (whole + (bits != 0 ? 1 : 0) > data.message.size() ||
+        !Update(std::span(bytes, whole))) {
+      return;
+    }
+    trailing_bits = bits;
+    if (bits != 0) {
+      trailing = static_cast<std::uint8_t>(bytes[whole] & (0xff00 >> bits));
+    }
+  }
+  // 바이트 중간에서 끝난 입력을 받은 뒤면 아무것도 하지 않고 false.
+  // Reset(Digest) 후 다시 사용
+  bool Update(std::span<const std::uint8_t> data) {
+    if (trailing_bits != 0) {
+      return false;
+    }
+    if (data.empty()) {
+      return true;
+    }
+    if (buffered > 0) {
+      const std::size_t take = std::min(kBlockBytes - buffered, data.size());
+      std::memcpy(data_buffer.data() + buffered, data.data(), take);
+      buffered += take;
+      data = data.subspan(take);
+      if (buffered < kBlockBytes) {
+        return true;
+      }
+      lsh::CompressBlocks(cv, data_buffer.data(), 1);
+      buffered = 0;
+    }
+
+    const std::size_t blocks = data.size() / kBlockBytes;
+    lsh::CompressBlocks(cv, data.data(), blocks);
+    data = data.subspan(blocks * kBlockBytes);
+
+    std::ranges::copy(data, data_buffer.begin());
+    buffered = data.size();
+    return true;
+  }
+
+  std::array<std::byte, DigestLen / 8> Digest() final override {
+    const auto ret =
+        Finish(cv, std::span<const std::uint8_t>(data_buffer.data(), buffered),
+               trailing, trailing_bits);
+    Reset();
+    return ret;
+  }
+  void Reset() final override {
+    cv = kIv;
+    buffered = 0;
+    trailing = 0;
+    trailing_bits = 0;
+  }
+
+ private:
+  // 남은 바이트(블록 미만)와 남는 bit(last의 상위 bits개) 뒤에 1 bit,
+  // 나머지는 0 (길이 필드 없음). 출력은 두 절반의 XOR
+  static std::array<std::byte, DigestLen / 8> Finish(
+      lsh::ChainVar<Word> state, std::span<const std::uint8_t> rest,
+      std::uint8_t last = 0, std::size_t bits = 0) {
+    std::array<std::uint8_t, kBlockBytes> tail{};
+    std::ranges::copy(rest, tail.begin());
+    tail[rest.size()] = static_cast<std::uint8_t>(last | (0x80 >> bits));
+    lsh::CompressBlocks(state, tail.data(), 1);
+
+    std::array<std::byte, DigestLen / 8> ret;
+    for (std::size_t i = 0; i < ret.size(); i++) {
+      const Word word = state[i / sizeof(Word)] ^ state[(i / sizeof(Word)) + 8];
+      ret[i] = static_cast<std::byte>(word >> (8 * (i % sizeof(Word))));
+    }
+    return ret;
+  }
+
+  lsh::ChainVar<Word> cv;
+  std::array<std::uint8_t, kBlockBytes> data_buffer;
+  std::size_t buffered = 0;
+  // 바이트 중간에서 끝난 입력의 남는 bit (상위 trailing_bits개)
+  std::uint8_t trailing = 0;
+  std::size_t trailing_bits = 0;
+};
+
+using LSH256 = LSH<256>;
+using LSH256_224 = LSH<256, 224>;
+using LSH512 = LSH<512>;
+using LSH512_384 = LSH<512, 384>;
+using LSH512_256 = LSH<512, 256>;
+using LSH512_224 = LSH<512, 224>;
+
+};  // namespace bedrock::hash
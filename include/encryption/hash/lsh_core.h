@@ -0,0 +1,163 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// LSH-256 / LSH-512 (KS X 3262) 압축 함수. 두 계열은 워드 크기와 상수만 다르고
+// 구조가 같아 워드 타입을 템플릿 인자로 받음. 워드는 리틀 엔디언
+namespace bedrock::hash::lsh {
+
+template <typename Word>
+struct Params;
+
+template <>
+struct Params<std::uint32_t> {
+  static constexpr std::size_t kSteps = 26;
+  // [짝수 단계, 홀수 단계]
+  static constexpr std::array<std::uint32_t, 2> kAlpha = {29, 5};
+  static constexpr std::array<std::uint32_t, 2> kBeta = {1, 17};
+  static constexpr std::array<std::uint32_t, 8> kGamma = {0,  8,  16, 24,
+                                                          24, 16, 8,  0};
+  static constexpr std::array<std::uint32_t, 8> kStepConstant0 = {
+      0x917caf90, 0x6c1b10a2, 0x6f352943, 0xcf778243,
+      0x2ceb7472, 0x29e96ff2, 0x8a9ba428, 0x2eeb2642};
+};
+
+template <>
+struct Params<std::uint64_t> {
+  static constexpr std::size_t kSteps = 28;
+  static constexpr std::array<std::uint32_t, 2> kAlpha = {23, 7};
+  static constexpr std::array<std::uint32_t, 2> kBeta = {59, 3};
+  static constexpr std::array<std::uint32_t, 8> kGamma = {0, 16, 32, 48,
+                                                          8, 24, 40, 56};
+  static constexpr std::array<std::uint64_t, 8> kStepConstant0 = {
+      0x97884283c938982a, 0xba1fca93533e2355, 0xc519a2e87aeb1c03,
+      0x9a0fc95462af17b1, 0xfc3dda8ab019a82b, 0x02825d079a895407,
+      0x79f2d0a7ee06a6f7, 0xd76d15eed9fdf5fe};
+};
+
+// 연결 변수 16워드. 0~7이 왼쪽, 8~15가 오른쪽 절반
+template <typename Word>
+using ChainVar = std::array<Word, 16>;
+
+template <typename Word>
+inline constexpr std::size_t kBlockBytes = 32 * sizeof(Word);
+
+// 메시지 확장 τ와 워드 순열 σ. 새 X[l] = 이전 X[σ(l)]
+inline constexpr std::array<std::size_t, 16> kTau = {
+    3, 2, 0, 1, 7, 4, 5, 6, 11, 10, 8, 9, 15, 12, 13, 14};
+inline constexpr std::array<std::size_t, 16> kSigma = {
+    6, 4, 5, 7, 12, 15, 14, 13, 2, 0, 1, 3, 8, 11, 10, 9};
+
+template <typename Word>
+constexpr Word Rotl(Word x, std::uint32_t n) {
+  return n == 0 ? x : (x << n) | (x >> ((sizeof(Word) * 8) - n));
+}
+
+// SC_j = SC_{j-1} + (SC_{j-1} <<< 8)
+template <typename Word>
+inline constexpr auto kStepConstants = [] {
+  std::array<Word, 8 * Params<Word>::kSteps> sc{};
+  for (std::size_t i = 0; i < sc.size(); i++) {
+    sc[i] = i < 8 ? Params<Word>::kStepConstant0[i]
+                  : sc[i - 8] + Rotl<Word>(sc[i - 8], 8);
+  }
+  return sc;
+}();
+
+template <typename Word>
+constexpr Word LoadWord(const std::uint8_t* p) {
+  Word v = 0;
+  for (std::size_t i = 0; i < sizeof(Word); i++) {
+    v |= static_cast<Word>(p[i]) << (8 * i);
+  }
+  return v;
+}
+
+// 한 단계: 메시지 XOR, 섞기, 워드 순열
+template <typename Word>
+constexpr void Step(ChainVar<Word>& cv, const std::array<Word, 16>& m,
+                    std::size_t j) {
+  using P = Params<Word>;
+  ChainVar<Word> t{};
+  for (std::size_t l = 0; l < 16; l++) {
+    t[l] = cv[l] ^ m[l];
+  }
+  for (std::size_t l = 0; l < 8; l++) {
+    Word x = t[l];
+    Word y = t[l + 8];
+    x = Rotl<Word>(x + y, P::kAlpha[j % 2]) ^ kStepConstants<Word>[(j * 8) + l];
+    y = Rotl<Word>(x + y, P::kBeta[j % 2]);
+    t[l] = x + y;
+    t[l + 8] = Rotl<Word>(y, P::kGamma[l]);
+  }
+  for (std::size_t l = 0; l < 16; l++) {
+    cv[l] = t[kSigma[l]];
+  }
+}
+
+// M^(j) = M^(j-1) + τ(M^(j-2)). older(M^(j-2))를 덮어씀
+template <typename Word>
+constexpr void Expand(std::array<Word, 16>& older,
+                      const std::array<Word, 16>& newer) {
+  const std::array<Word, 16> prev = older;
+  for (std::size_t l = 0; l < 16; l++) {
+    older[l] = newer[l] + prev[kTau[l]];
+  }
+}
+
+template <typename Word>
+constexpr void CompressBytes(ChainVar<Word>& cv, const std::uint8_t* block) {
+  std::array<Word, 16> even{};
+  std::array<Word, 16> odd{};
+  for (std::size_t l = 0; l < 16; l++) {
+    even[l] = LoadWord<Word>(block + (l * sizeof(Word)));
+    odd[l] = LoadWord<Word>(block + ((l + 16) * sizeof(Word)));
+  }
+
+  Step(cv, even, 0);
+  Step(cv, odd, 1);
+  for (std::size_t j = 2; j < Params<Word>::kSteps; j += 2) {
+    Expand(even, odd);
+    Step(cv, even, j);
+    Expand(odd, even);
+    Step(cv, odd, j + 1);
+  }
+  Expand(even, odd);
+  for (std::size_t l = 0; l < 16; l++) {
+    cv[l] ^= even[l];
+  }
+}
+
+// 초기값: [최대 출력 바이트, 출력 비트, 0, ...]을 0 블록으로 압축
+template <typename Word>
+constexpr ChainVar<Word> InitialValue(std::uint32_t digest_bits) {
+  constexpr Word kMaxBytes = sizeof(Word) * 8;
+  ChainVar<Word> cv{};
+  cv[0] = kMaxBytes;
+  cv[1] = digest_bits;
+  const std::array<std::uint8_t, kBlockBytes<Word>> zero{};
+  CompressBytes(cv, zero.data());
+  return cv;
+}
+
+// 런타임 디스패치 (AVX2 > 스칼라)
+void CompressBlocks(ChainVar<std::uint32_t>& cv, const std::uint8_t* data,
+                    std::size_t blocks) noexcept;
+void CompressBlocks(ChainVar<std::uint64_t>& cv, const std::uint8_t* data,
+                    std::size_t blocks) noexcept;
+
+void CompressBlocksScalar(ChainVar<std::uint32_t>& cv,
+                          const std::uint8_t* data,
+                          std::size_t blocks) noexcept;
+void CompressBlocksScalar(ChainVar<std::uint64_t>& cv,
+                          const std::uint8_t* data,
+                          std::size_t blocks) noexcept;
+
+// AVX2 지원 CPU에서만 호출
+void CompressBlocksAvx2(ChainVar<std::uint32_t>& cv, const std::uint8_t* data,
+                        std::size_t blocks) noexcept;
+void CompressBlocksAvx2(ChainVar<std::uint64_t>& cv, const std::uint8_t* data,
+                        std::size_t blocks) noexcept;
+
+}  // namespace bedrock::hash::lsh
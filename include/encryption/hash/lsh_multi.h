@@ -0,0 +1,30 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/lsh_core.h"
+
+// 짧은 메시지 여러 개의 LSH-256-256 / LSH-512-512를 레인 여러 개(ymm 한 칸이
+// 메시지 하나)로 묶어 동시에 계산. 끝난 레인에는 다음 메시지를 바로 채워 넣음
+namespace bedrock::hash::lsh {
+
+template <std::size_t kBytes>
+using Digest = std::array<std::uint8_t, kBytes>;
+
+// digests[i] = LSH-256-256(messages[i]) / LSH-512-512(messages[i]).
+// digests가 messages보다 짧으면 false. AVX2가 없으면 메시지마다 단일 경로
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<32>> digests) noexcept;
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<64>> digests) noexcept;
+
+// 연결 변수는 워드 우선 배치: cv[(word * 레인 수) + lane].
+// LSH-256은 8레인, LSH-512는 4레인. AVX2 지원 CPU에서만 호출
+void CompressLanesAvx2(std::uint32_t* cv,
+                       const std::uint8_t* const* blocks) noexcept;
+void CompressLanesAvx2(std::uint64_t* cv,
+                       const std::uint8_t* const* blocks) noexcept;
+
+}  // namespace bedrock::hash::lsh
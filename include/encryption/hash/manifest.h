@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "encryption/hash/file_hash.h"
+#include "encryption/hash/sha256_multi.h"
+
+// 디렉터리 아래 모든 일반 파일의 체크섬 목록.
+// 작은 파일은 여러 개를 한꺼번에 읽어 SHA-256 레인(DigestMany)에 섞어 넣고,
+// 큰 파일은 파일 하나가 작업 하나. 작업은 스레드마다 둔 큐에 나눠 넣고
+// 자기 큐가 비면 다른 스레드의 큐에서 훔쳐 옴
+namespace bedrock::hash {
+
+enum class ManifestDigest {
+  // 파일 전체의 SHA-256 (sha256sum과 같은 값). 큰 파일 하나는 한 스레드가 맡음
+  kSha256,
+  // merkle::TreeHash 루트 (leaf_bytes 단위). 큰 파일도 리프 구간으로 나눠
+  // 여러 스레드가 함께 계산. 루트에 길이가 묶이므로 작은 파일도 kSha256과
+  // 다른 값
+  kMerkle,
+};
+
+struct ManifestOptions {
+  // 0이면 std::thread::hardware_concurrency
+  std::size_t threads = 0;
+  // 이 크기 이하의 파일은 batch_files개씩 묶어 레인으로 해시
+  std::size_t small_file_bytes = std::size_t{256} << 10;
+  std::size_t batch_files = 64;
+  ManifestDigest digest = ManifestDigest::kSha256;
+  std::size_t leaf_bytes = std::size_t{1} << 20;
+  // 큰 파일을 읽는 방식. 읽는 중에 잘린 매핑 파일은 SIGBUS로 프로세스를
+  // 죽이므로 기본은 매핑하지 않음 (잘린 파일은 readable = false).
+  // kMerkle은 kMap이나 map_limit 이하의 kAuto일 때만 매핑하고, 아니면
+  // 리프 구간마다 chunk_bytes씩 읽음. direct_io는 kSha256에만 적용
+  FileReadOptions read = {FileReadMode::kPipeline};
+};
+
+struct ManifestEntry {
+  // root 기준 상대 경로
+  std::filesystem::path path;
+  std::uint64_t bytes = 0;
+  sha256::Digest digest{};
+  // 읽는 중 실패하면 false이고 digest는 의미 없음
+  bool readable = false;
+};
+
+// root 아래(하위 디렉터리 포함)의 일반 파일을 경로 순으로 entries에 씀.
+// 심볼릭 링크는 따라가지 않음. root를 읽을 수 없거나 옵션이 잘못됐거나
+// 읽지 못한 파일이 하나라도 있으면 false (나머지 항목은 채워짐)
+bool BuildManifest(const std::filesystem::path& root,
+                   const ManifestOptions& options,
+                   std::vector<ManifestEntry>& entries) noexcept;
+
+// "<16진 다이제스트>  <경로>" 줄 목록 (sha256sum 형식, 경로 구분자는 '/').
+// 경로에 '\\'나 줄바꿈이 있으면 sha256sum처럼 줄 앞에 '\\'를 붙이고 이스케이프.
+// 읽지 못한 항목은 건너뜀
+std::string FormatManifest(std::span<const ManifestEntry> entries);
+
+}  // namespace bedrock::hash
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/sha256_multi.h"
+
+// SHA-256 트리 해시.
+//   리프: 입력을 leaf_bytes 크기로 자른 조각의 SHA-256 (마지막은 짧을 수 있음,
+//         빈 입력은 빈 리프 하나)
+//   내부 노드: SHA-256(왼쪽 || 오른쪽), 짝이 없는 마지막 노드는 그대로 올림
+//   루트: SHA-256(맨 위 노드 || 입력 길이(64비트 빅엔디언) || 0 24바이트).
+//         리프와 내부 노드를 같은 방식으로 해시하므로, 길이를 묶지 않으면
+//         내부 노드를 이어 붙인 더 짧은 입력이 같은 루트를 가짐
+// 검증하는 쪽도 같은 leaf_bytes를 알아야 함
+namespace bedrock::hash::merkle {
+
+using Digest = sha256::Digest;
+
+struct TreeOptions {
+  std::size_t leaf_bytes = std::size_t{1} << 20;
+  // 리프 해시에 쓸 스레드 수 (호출 스레드 포함). 리프 수와
+  // std::thread::hardware_concurrency로 제한
+  std::size_t threads = 1;
+};
+
+// 바이트 수 bytes를 leaf_bytes로 자른 리프 개수 (빈 입력도 1)
+[[nodiscard]] std::size_t LeafCount(std::size_t bytes,
+                                    std::size_t leaf_bytes) noexcept;
+
+// 리프 다이제스트만 계산. leaf_digests는 LeafCount 이상이어야 함
+bool LeafHashes(std::span<const std::uint8_t> data, const TreeOptions& options,
+                std::span<Digest> leaf_digests) noexcept;
+
+// root에 루트를 씀. leaf_digests가 비어 있지 않으면 리프 다이제스트도
+// 함께 쓰며 이때는 LeafCount 이상이어야 함. leaf_bytes가 0이면 false
+bool TreeHash(std::span<const std::uint8_t> data, const TreeOptions& options,
+              Digest& root, std::span<Digest> leaf_digests = {}) noexcept;
+
+// 리프 다이제스트에서 맨 위 노드까지 올린 뒤 Finalize. 한 층은
+// Hash64Many로 계산. total_bytes는 원래 입력의 길이.
+// leaves가 비어 있으면 false
+bool Reduce(std::span<const Digest> leaves, std::uint64_t total_bytes,
+            Digest& root) noexcept;
+
+// 맨 위 노드 top과 입력 길이로 루트를 만듦 (Hash64 한 번)
+[[nodiscard]] Digest Finalize(const Digest& top,
+                              std::uint64_t total_bytes) noexcept;
+
+}  // namespace bedrock::hash::merkle
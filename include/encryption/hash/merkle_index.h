@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include "encryption/hash/merkle.h"
+
+namespace bedrock::hash::merkle {
+
+// 사이드카 파일에 저장되는 머클 트리 (merkle.h와 같은 형식).
+// 리프부터 루트까지 모든 층의 노드를 파일에 메모리 매핑해 두고, 데이터의
+// 일부 구간이 바뀌면 그 구간의 리프와 조상 경로만 다시 계산함.
+// 파일 구성: 헤더 64바이트 + 층 0(리프), 층 1, ..., 맨 위 노드 순서의
+// 다이제스트. Root는 맨 위 노드에 데이터 길이를 묶어(Finalize) 돌려줌
+// 데이터 길이는 고정 (덧붙이기 / 자르기는 Create로 다시 만듦)
+class MerkleIndex {
+ public:
+  MerkleIndex() noexcept = default;
+  MerkleIndex(const MerkleIndex&) = delete;
+  MerkleIndex& operator=(const MerkleIndex&) = delete;
+  MerkleIndex(MerkleIndex&& other) noexcept;
+  MerkleIndex& operator=(MerkleIndex&& other) noexcept;
+  ~MerkleIndex();
+
+  // data 전체로 트리를 만들어 path에 씀 (기존 파일은 덮어씀)
+  bool Create(const std::filesystem::path& path,
+              std::span<const std::uint8_t> data,
+              const TreeOptions& options) noexcept;
+  // 기존 사이드카를 매핑. 헤더나 크기가 맞지 않으면 false
+  bool Open(const std::filesystem::path& path) noexcept;
+
+  // data의 [offset, offset + length)가 바뀐 뒤 호출. data는 바뀐 뒤의 전체로
+  // 인덱스를 만들 때와 길이가 같아야 함
+  bool Update(std::span<const std::uint8_t> data, std::size_t offset,
+              std::size_t length) noexcept;
+  // 매핑된 변경 내용을 파일에 내려씀
+  bool Sync() noexcept;
+  void Close() noexcept;
+
+  [[nodiscard]] bool IsOpen() const noexcept { return nodes != nullptr; }
+  [[nodiscard]] Digest Root() const noexcept;
+  [[nodiscard]] std::span<const Digest> Leaves() const noexcept;
+  [[nodiscard]] std::size_t LeafBytes() const noexcept { return leaf_bytes; }
+  [[nodiscard]] std::size_t DataBytes() const noexcept { return data_bytes; }
+
+ private:
+  bool Map(const std::filesystem::path& path, std::size_t file_bytes,
+           bool create) noexcept;
+
+  std::uint8_t* mapping = nullptr;
+  std::size_t mapping_bytes = 0;
+#ifdef _WIN32
+  void* file = nullptr;
+  void* file_mapping = nullptr;
+#else
+  int file = -1;
+#endif
+
+  Digest* nodes = nullptr;
+  std::size_t leaf_bytes = 0;
+  std::size_t data_bytes = 0;
+  std::size_t leaf_count = 0;
+  std::size_t node_count = 0;
+};
+
+}  // namespace bedrock::hash::merkle
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace bedrock::hash {
+
+// PBKDF2-HMAC-SHA256 (RFC 8018). out 전체를 유도. iterations가 0이거나
+// out이 비어 있거나 출력 블록 수가 2^32 - 1을 넘으면 false
+bool Pbkdf2HmacSha256(std::span<const std::uint8_t> password,
+                      std::span<const std::uint8_t> salt,
+                      std::uint32_t iterations,
+                      std::span<std::uint8_t> out) noexcept;
+
+struct Pbkdf2Request {
+  std::span<const std::uint8_t> password;
+  std::span<const std::uint8_t> salt;
+  std::span<std::uint8_t> out;
+};
+
+// 같은 반복 횟수로 여러 요청을 한꺼번에 유도 (비밀번호 후보 검증 등).
+// 요청의 출력 블록 하나하나가 독립 작업이 되어 SHA-256 레인
+// (AVX-512F 16개, AVX2 8개)에 나뉘어 들어감. 하나라도 조건에 맞지 않으면
+// 아무것도 쓰지 않고 false
+bool Pbkdf2HmacSha256Many(std::span<const Pbkdf2Request> requests,
+                          std::uint32_t iterations) noexcept;
+
+namespace pbkdf2 {
+
+// 반복 커널. 레인마다 U_{j+1} = HMAC(P, U_j), T ^= U_{j+1}을 iterations번.
+// 입력이 항상 32바이트라 압축 두 번의 메시지 블록 뒷부분은 고정값
+// 모든 배열은 워드 우선 배치: x[word * 레인 수 + lane]
+// inner / outer는 HMAC 키의 ipad / opad 중간 상태, u / t는 갱신됨
+void IterateLanesAvx2(const std::uint32_t* inner, const std::uint32_t* outer,
+                      std::uint32_t* u, std::uint32_t* t,
+                      std::uint32_t iterations) noexcept;
+void IterateLanesAvx512(const std::uint32_t* inner, const std::uint32_t* outer,
+                        std::uint32_t* u, std::uint32_t* t,
+                        std::uint32_t iterations) noexcept;
+
+}  // namespace pbkdf2
+
+}  // namespace bedrock::hash
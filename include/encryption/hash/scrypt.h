@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace bedrock::hash {
+
+// scrypt 비용 매개변수 (RFC 7914). n은 2 이상의 2의 거듭제곱
+struct ScryptParams {
+  std::uint64_t n = 0;
+  std::uint32_t r = 8;
+  std::uint32_t p = 1;
+};
+
+// ROMix 작업 메모리. 가능하면 큰 페이지(리눅스 MAP_HUGETLB, 안 되면
+// MADV_HUGEPAGE / 윈도우 MEM_LARGE_PAGES)로 잡고, 한 번 잡은 영역은
+// 더 큰 요청이 올 때까지 재사용하므로 같은 매개변수로 반복 호출해도
+// 할당이 일어나지 않음. 스레드마다 하나씩 두고 쓰는 용도 (동시 사용 불가)
+class ScryptScratch {
+ public:
+  ScryptScratch() noexcept = default;
+  ScryptScratch(const ScryptScratch&) = delete;
+  ScryptScratch& operator=(const ScryptScratch&) = delete;
+  ScryptScratch(ScryptScratch&& other) noexcept;
+  ScryptScratch& operator=(ScryptScratch&& other) noexcept;
+  ~ScryptScratch();
+
+  // 최소 bytes를 확보. 시작 주소는 64바이트 이상 정렬. 실패하면 false
+  bool Reserve(std::size_t bytes) noexcept;
+  void Release() noexcept;
+
+  [[nodiscard]] std::uint8_t* Data() const noexcept { return data; }
+  [[nodiscard]] std::size_t Size() const noexcept { return size; }
+  [[nodiscard]] bool HugePages() const noexcept { return huge_pages; }
+
+ private:
+  std::uint8_t* data = nullptr;
+  std::size_t size = 0;
+  bool huge_pages = false;
+};
+
+// out = scrypt(password, salt, n, r, p). 앞뒤 PBKDF2-HMAC-SHA256 단계는
+// Pbkdf2HmacSha256, 서로 독립인 p개의 ROMix는 threads개 스레드에 나눔
+// (p와 하드웨어 스레드 수로 제한). 돌아오기 전에 scratch에 쓴 값은 지움.
+// 매개변수가 범위를 벗어나거나 out이 비었거나 메모리를 못 잡으면 false
+bool Scrypt(std::span<const std::uint8_t> password,
+            std::span<const std::uint8_t> salt, const ScryptParams& params,
+            std::span<std::uint8_t> out, ScryptScratch& scratch,
+            std::size_t threads = 1) noexcept;
+// 호출마다 작업 메모리를 새로 잡는 편의 함수
+bool Scrypt(std::span<const std::uint8_t> password,
+            std::span<const std::uint8_t> salt, const ScryptParams& params,
+            std::span<std::uint8_t> out) noexcept;
+
+namespace scrypt {
+
+// ROMix 커널. b는 128 * r바이트 블록 (제자리 갱신), v는 128 * r * n,
+// xy는 256 * r바이트 작업 영역이며 모두 64바이트 정렬이어야 함
+// Salsa20/8은 SSE2 대각선 배치로 계산
+void RoMixSse2(std::uint8_t* b, std::size_t r, std::uint64_t n,
+               std::uint8_t* v, std::uint8_t* xy) noexcept;
+// 독립된 ROMix 두 개를 ymm의 128비트 반쪽에 하나씩 실어 함께 계산.
+// v, xy는 RoMixSse2의 두 배 크기
+void RoMix2Avx2(std::uint8_t* b0, std::uint8_t* b1, std::size_t r,
+                std::uint64_t n, std::uint8_t* v, std::uint8_t* xy) noexcept;
+
+}  // namespace scrypt
+
+}  // namespace bedrock::hash
@@ -1,205 +1,291 @@
 ﻿#pragma once
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <memory>
 #include <queue>
 #include <span>
+#include <type_traits>
 
 #include "common.h"
+#include "encryption/hash/sha1_core.h"
+#include "encryption/hash/sha256_core.h"
+#include "encryption/hash/sha512_core.h"
 
 
 namespace bedrock::hash {
 
+// 블록 크기별 압축 엔진. SHA-1/224/256은 32비트 워드 64바이트 블록,
+// SHA-384/512/512-256은 64비트 워드 128바이트 블록
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+struct SHAEngine;
+
+template <>
+struct SHAEngine<160, 512> {
+  using State = sha1::State;
+  static constexpr State kH0 = sha1::kH0;
+
+  static void CompressBlocks(State& h, const std::uint8_t* data,
+                             std::size_t blocks) noexcept {
+    sha1::CompressBlocks(h, data, blocks);
+  }
+  static constexpr void StoreWord(std::uint8_t* p, std::uint32_t v) {
+    sha256::StoreBigEndian32(p, v);
+  }
+};
+
+template <std::uint32_t DigestLen>
+struct SHAEngine<DigestLen, 512> {
+  using State = sha256::State;
+  static constexpr State kH0 =
+      DigestLen == 224 ? sha256::kH0_224 : sha256::kH0;
+
+  static void CompressBlocks(State& h, const std::uint8_t* data,
+                             std::size_t blocks) noexcept {
+    sha256::CompressBlocks(h, data, blocks);
+  }
+  static constexpr void StoreWord(std::uint8_t* p, std::uint32_t v) {
+    sha256::StoreBigEndian32(p, v);
+  }
+};
+
 template <std::uint32_t DigestLen>
+struct SHAEngine<DigestLen, 1024> {
+  using State = sha512::State;
+  static constexpr State kH0 = DigestLen == 384   ? sha512::kH0_384
+                               : DigestLen == 256 ? sha512::kH0_256
+                                                  : sha512::kH0;
+
+  static void CompressBlocks(State& h, const std::uint8_t* data,
+                             std::size_t blocks) noexcept {
+    sha512::CompressBlocks(h, data, blocks);
+  }
+  static constexpr void StoreWord(std::uint8_t* p, std::uint64_t v) {
+    sha512::StoreBigEndian64(p, v);
+  }
+};
+
+// BlockLen은 DigestLen만으로 정해지지 않는 SHA-512/256 (SHA<256, 1024>) 때문
+template <std::uint32_t DigestLen,
+          std::uint32_t BlockLen = (DigestLen >= 384 ? 1024 : 512)>
 class SHA : public HashAlgorithm<DigestLen> {
+  static_assert(
+      (BlockLen == 512 &&
+       (DigestLen == 160 || DigestLen == 224 || DigestLen == 256)) ||
+          (BlockLen == 1024 &&
+           (DigestLen == 256 || DigestLen == 384 || DigestLen == 512)),
+      "SHA-1 / SHA-224 / SHA-256 / SHA-384 / SHA-512 / SHA-512/256만 지원");
+
  public:
   SHA();
   std::array<std::byte, DigestLen / 8> Digest(
       std::span<const std::uint8_t> data) const final override;
 
   void Update(const HashAlgorithmInputData& data) final override;
+  // 바이트 단위 입력. 완성된 블록은 호출자 메모리에서 바로 압축하고
+  // 남는 꼬리만 버퍼에 복사
+  void Update(std::span<const std::uint8_t> data);
   std::array<std::byte, DigestLen / 8> Digest() final override;
   void Reset() final override;
 
+  // 진행 중인 해시의 중간 상태. 고정 크기 POD라 그대로 저장해 두었다가
+  // 다른 프로세스에서 Import로 이어 계산할 수 있음. 워드는 호스트 바이트 순서
+  struct Midstate {
+    std::uint32_t digest_bits;
+    std::uint32_t block_bits;
+    typename SHAEngine<DigestLen, BlockLen>::State h;
+    std::uint64_t buffered_bits;
+    std::uint64_t total_bits;
+    std::array<std::uint8_t, BlockLen / 8> buffer;
+  };
+
+  [[nodiscard]] Midstate Export() const;
+  // 다른 알고리즘의 상태이거나 길이가 맞지 않으면 false (상태는 그대로)
+  bool Import(const Midstate& midstate);
+
  private:
-  constexpr std::vector<std::array<std::uint32_t, 16>> Padding(
-      const HashAlgorithmInputData& data) const;
-  constexpr std::array<std::uint32_t, 16> MakeMessage(
-      const std::array<std::byte, 64>& data, std::uint64_t data_bit_length);
-  constexpr std::array<std::uint32_t, 8> ProcessMessageBlock(
-      const std::array<std::uint32_t, 16>& M,
-      const std::array<std::uint32_t, 8>& H) const;
-
-  std::array<std::byte, 64> data_buffer;
+  using Engine = SHAEngine<DigestLen, BlockLen>;
+  using State = typename Engine::State;
+  static constexpr std::size_t kBlockBytes = BlockLen / 8;
+  using TailBlocks = std::array<std::uint8_t, kBlockBytes * 2>;
+
+  // rest_bits 비트짜리 꼬리에 1비트와 전체 길이를 붙여 tail에 씀.
+  // 패딩된 블록 수(1 또는 2)를 돌려줌
+  static std::size_t PadTail(TailBlocks& tail, const std::uint8_t* rest,
+                             std::uint64_t rest_bits,
+                             std::uint64_t total_bits);
+  static std::array<std::byte, DigestLen / 8> Output(const State& h);
+
+  std::array<std::byte, kBlockBytes> data_buffer;
   std::uint64_t data_buffer_bit_length = 0;
   std::uint64_t data_length = 0;
 
-  std::array<std::uint32_t, 8> H;
-
-  constexpr std::uint32_t ROTR(std::uint32_t x, std::uint32_t n) const;
-  constexpr std::uint32_t Ch(std::uint32_t x, std::uint32_t y,
-                             std::uint32_t z) const;
-  constexpr std::uint32_t Maj(std::uint32_t x, std::uint32_t y,
-                              std::uint32_t z) const;
-  constexpr std::uint32_t Sigma0(std::uint32_t x) const;
-  constexpr std::uint32_t Sigma1(std::uint32_t x) const;
-  constexpr std::uint32_t sigma0(std::uint32_t x) const;
-  constexpr std::uint32_t sigma1(std::uint32_t x) const;
-
-  static constexpr std::uint32_t K[64] = {
-      0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
-      0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-      0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
-      0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-      0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
-      0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-      0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
-      0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-      0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
-      0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-      0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
-  static constexpr std::uint32_t H0[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
-                                          0xa54ff53a, 0x510e527f, 0x9b05688c,
-                                          0x1f83d9ab, 0x5be0cd19};
+  State H;
 };
 
-template <std::uint32_t DigestLen>
-SHA<DigestLen>::SHA() {
-  if (DigestLen == 1)
-    this->digest_size = 160;
-  else
-    this->digest_size = DigestLen;
-  if (DigestLen >= 384)
-    this->inner_block_size = 1024;
-  else
-    this->inner_block_size = 512;
+using SHA1 = SHA<160>;
+using SHA224 = SHA<224>;
+using SHA256 = SHA<256>;
+using SHA384 = SHA<384>;
+using SHA512 = SHA<512>;
+using SHA512_256 = SHA<256, 1024>;
+
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+SHA<DigestLen, BlockLen>::SHA() {
+  this->digest_size = DigestLen;
+  this->inner_block_size = BlockLen;
   Reset();
 }
 
-template <std::uint32_t DigestLen>
-void SHA<DigestLen>::Reset() {
-  std::copy(std::begin(H0), std::end(H0), H.begin());
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+void SHA<DigestLen, BlockLen>::Reset() {
+  H = Engine::kH0;
   data_length = 0;
   data_buffer_bit_length = 0;
 }
 
-template <>
-constexpr std::uint32_t SHA<256>::ROTR(std::uint32_t x, std::uint32_t n) const {
-  return (x >> n) | (x << (32 - n));
-}
-template <>
-constexpr std::uint32_t SHA<256>::Ch(std::uint32_t x, std::uint32_t y,
-                                     std::uint32_t z) const {
-  return (x & y) ^ (~x & z);
-}
-template <>
-constexpr std::uint32_t SHA<256>::Maj(std::uint32_t x, std::uint32_t y,
-                                      std::uint32_t z) const {
-  return (x & y) ^ (x & z) ^ (y & z);
-}
-
-template <>
-constexpr std::uint32_t SHA<256>::Sigma0(std::uint32_t x) const {
-  return ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22);
-}
-template <>
-constexpr std::uint32_t SHA<256>::Sigma1(std::uint32_t x) const {
-  return ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25);
-}
-template <>
-constexpr std::uint32_t SHA<256>::sigma0(std::uint32_t x) const {
-  return ROTR(x, 7) ^ ROTR(x, 18) ^ (x >> 3);
-}
-template <>
-constexpr std::uint32_t SHA<256>::sigma1(std::uint32_t x) const {
-  return ROTR(x, 17) ^ ROTR(x, 19) ^ (x >> 10);
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+typename SHA<DigestLen, BlockLen>::Midstate
+SHA<DigestLen, BlockLen>::Export() const {
+  static_assert(std::is_trivially_copyable_v<Midstate> &&
+                std::is_standard_layout_v<Midstate>);
+
+  // 저장한 바이트가 매번 같도록 버퍼의 빈 부분도 0으로 채움
+  Midstate midstate{};
+  midstate.digest_bits = DigestLen;
+  midstate.block_bits = BlockLen;
+  midstate.h = H;
+  midstate.buffered_bits = data_buffer_bit_length;
+  midstate.total_bits = data_length;
+  std::memcpy(midstate.buffer.data(), data_buffer.data(),
+              (data_buffer_bit_length + 7) / 8);
+  return midstate;
 }
 
-template <>
-constexpr std::vector<std::array<std::uint32_t, 16>> SHA<256>::Padding(
-    const HashAlgorithmInputData& data) const {
-  std::vector<std::array<std::uint32_t, 16>> padded = {};
-  padded.resize((data.bit_length + 1 + 64 + 511) / 512);
-
-  for (int i = 0; i < data.message.size(); i++) {
-    padded[i / 64][(i / 4) % 16] |= std::to_integer<uint32_t>(data.message[i])
-                                    << 8 * (3 - (i % 4));
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+bool SHA<DigestLen, BlockLen>::Import(const Midstate& midstate) {
+  // 버퍼에 남은 비트를 빼면 전체 길이는 블록의 배수
+  if (midstate.digest_bits != DigestLen || midstate.block_bits != BlockLen ||
+      midstate.buffered_bits >= BlockLen ||
+      midstate.total_bits < midstate.buffered_bits ||
+      (midstate.total_bits - midstate.buffered_bits) % BlockLen != 0) {
+    return false;
   }
 
-  padded[data.bit_length / 512][(data.bit_length / 32) % 16] |=
-      (1u << (31 - (data.bit_length % 32)));
+  H = midstate.h;
+  data_buffer_bit_length = midstate.buffered_bits;
+  data_length = midstate.total_bits;
+  std::memcpy(data_buffer.data(), midstate.buffer.data(),
+              midstate.buffer.size());
+  return true;
+}
 
-  padded.back()[14] = static_cast<uint32_t>(data.bit_length >> 32);
-  padded.back()[15] = static_cast<uint32_t>(data.bit_length & 0xFFFFFFFF);
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+std::size_t SHA<DigestLen, BlockLen>::PadTail(TailBlocks& tail,
+                                              const std::uint8_t* rest,
+                                              std::uint64_t rest_bits,
+                                              std::uint64_t total_bits) {
+  // 길이 필드는 블록의 1/8 (64 / 128비트). 상위 64비트는 항상 0
+  constexpr std::size_t kLengthBits = BlockLen / 8;
+
+  tail.fill(0);
+  const std::size_t rest_bytes = (rest_bits + 7) / 8;
+  if (rest_bytes != 0) {
+    std::memcpy(tail.data(), rest, rest_bytes);
+  }
+  tail[rest_bits / 8] |= static_cast<std::uint8_t>(0x80u >> (rest_bits % 8));
+  const std::size_t blocks = rest_bits + 1 + kLengthBits <= BlockLen ? 1 : 2;
 
-  return padded;
+  sha512::StoreBigEndian64(tail.data() + (blocks * kBlockBytes) - 8,
+                           total_bits);
+  return blocks;
 }
 
-template <>
-constexpr std::array<std::uint32_t, 16> SHA<256>::MakeMessage(
-    const std::array<std::byte, 64>& data, std::uint64_t data_bit_length) {
-  std::array<std::uint32_t, 16> M = {};
-
-  for (int i = 0; i < 64 && i < (data_bit_length + 7) / 8; i++) {
-    M[i / 4] |= std::to_integer<uint32_t>(data[i]) << 8 * (3 - (i % 4));
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+std::array<std::byte, DigestLen / 8> SHA<DigestLen, BlockLen>::Output(
+    const State& h) {
+  // 상태 전체를 빅엔디언으로 쓴 뒤 앞쪽 DigestLen비트만 잘라냄
+  constexpr std::size_t kWords = std::tuple_size_v<State>;
+  constexpr std::size_t kWordBytes = sizeof(typename State::value_type);
+  std::array<std::uint8_t, kWords * kWordBytes> bytes;
+  for (std::size_t i = 0; i < kWords; i++) {
+    Engine::StoreWord(bytes.data() + (i * kWordBytes), h[i]);
   }
 
-  return M;
+  std::array<std::byte, DigestLen / 8> ret;
+  std::memcpy(ret.data(), bytes.data(), ret.size());
+  return ret;
 }
 
-template <>
-constexpr std::array<std::uint32_t, 8> SHA<256>::ProcessMessageBlock(
-    const std::array<std::uint32_t, 16>& M,
-    const std::array<std::uint32_t, 8>& H) const {
-  std::array<std::uint32_t, 64> W = {};
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+std::array<std::byte, DigestLen / 8> SHA<DigestLen, BlockLen>::Digest(
+    std::span<const std::uint8_t> data) const {
+  // 입력을 복사하지 않고 완성 블록은 그대로 압축, 패딩은 마지막 1~2블록만
+  const std::size_t blocks = data.size() / kBlockBytes;
+  State h = Engine::kH0;
+  Engine::CompressBlocks(h, data.data(), blocks);
+
+  TailBlocks tail;
+  const std::size_t tail_blocks =
+      PadTail(tail, data.data() + (blocks * kBlockBytes),
+              (data.size() % kBlockBytes) * 8, data.size() * 8);
+  Engine::CompressBlocks(h, tail.data(), tail_blocks);
+  return Output(h);
+}
 
-  for (int t = 0; t < 16; t++) {
-    W[t] = M[t];
-  }
-  for (int t = 16; t < 64; t++) {
-    W[t] = sigma1(W[t - 2]) + W[t - 7] + sigma0(W[t - 15]) + W[t - 16];
-  }
-  std::uint32_t a = H[0], b = H[1], c = H[2], d = H[3], e = H[4], f = H[5],
-                g = H[6], h = H[7];
-  std::uint32_t T1 = 0, T2 = 0;
-  for (int t = 0; t < 64; t++) {
-    T1 = h + Sigma1(e) + Ch(e, f, g) + K[t] + W[t];
-    T2 = Sigma0(a) + Maj(a, b, c);
-    h = g;
-    g = f;
-    f = e;
-    e = d + T1;
-    d = c;
-    c = b;
-    b = a;
-    a = T1 + T2;
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+void SHA<DigestLen, BlockLen>::Update(std::span<const std::uint8_t> data) {
+  // 앞선 비트 단위 입력으로 버퍼가 바이트 경계에 있지 않으면 기존 경로로
+  if (data_buffer_bit_length % 8 != 0) {
+    HashAlgorithmInputData input;
+    input.message.resize(data.size());
+    std::ranges::copy(data, reinterpret_cast<std::uint8_t*>(
+                                input.message.data()));
+    input.bit_length = data.size() * 8;
+    Update(input);
+    return;
   }
 
-  return {H[0] + a, H[1] + b, H[2] + c, H[3] + d,
-          H[4] + e, H[5] + f, H[6] + g, H[7] + h};
-}
+  if (data.empty()) {
+    return;
+  }
 
-template <>
-inline std::array<std::byte, 32> SHA<256>::Digest(
-    const HashAlgorithmInputData& data) const {
-  std::vector<std::array<std::uint32_t, 16>> M = Padding(data);
+  data_length += data.size() * 8;
+  auto* buffer = reinterpret_cast<std::uint8_t*>(data_buffer.data());
+  std::size_t buffered = data_buffer_bit_length / 8;
+
+  if (buffered > 0) {
+    const std::size_t take = std::min(kBlockBytes - buffered, data.size());
+    std::memcpy(buffer + buffered, data.data(), take);
+    buffered += take;
+    data = data.subspan(take);
+    if (buffered < kBlockBytes) {
+      data_buffer_bit_length = buffered * 8;
+      return;
+    }
+    Engine::CompressBlocks(H, buffer, 1);
+  }
 
-  std::array<std::uint32_t, 8> H = {H0[0], H0[1], H0[2], H0[3],
-                                    H0[4], H0[5], H0[6], H0[7]};
+  const std::size_t blocks = data.size() / kBlockBytes;
+  Engine::CompressBlocks(H, data.data(), blocks);
+  data = data.subspan(blocks * kBlockBytes);
 
-  for (int i = 0; i < M.size(); i++) {
-    H = ProcessMessageBlock(M[i], H);
+  if (!data.empty()) {
+    std::memcpy(buffer, data.data(), data.size());
   }
-  std::array<std::byte, 32> ret;
-  for (int i = 0; i < 8; i++) {
-    std::uint32_t v = ::htonl(H[i]);
-    std::memcpy(ret.data() + i * 4, &v, 4);
-  }
-  return ret;
+  data_buffer_bit_length = data.size() * 8;
 }
 
-template <>
-inline void SHA<256>::Update(const HashAlgorithmInputData& data) {
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+void SHA<DigestLen, BlockLen>::Update(const HashAlgorithmInputData& data) {
+  // 바이트 정렬된 입력은 복사 없는 경로로
+  if (data.bit_length % 8 == 0 && data_buffer_bit_length % 8 == 0) {
+    Update(std::span<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t*>(data.message.data()),
+        data.bit_length / 8));
+    return;
+  }
+
   const uint8_t* input_ptr =
       reinterpret_cast<const uint8_t*>(data.message.data());
   size_t input_bits = data.bit_length;
@@ -207,8 +293,8 @@ inline void SHA<256>::Update(const HashAlgorithmInputData& data) {
   data_length += input_bits;
 
   if (data_buffer_bit_length > 0) {
-    size_t bits_to_copy = (512 - data_buffer_bit_length) < input_bits
-                              ? 512 - data_buffer_bit_length
+    size_t bits_to_copy = (BlockLen - data_buffer_bit_length) < input_bits
+                              ? BlockLen - data_buffer_bit_length
                               : input_bits;
     size_t bytes_to_copy = (bits_to_copy + 7) / 8;
 
@@ -219,17 +305,17 @@ inline void SHA<256>::Update(const HashAlgorithmInputData& data) {
     input_ptr += bytes_to_copy;
     input_bits -= bits_to_copy;
 
-    if (data_buffer_bit_length == 512) {
-      H = ProcessMessageBlock(MakeMessage(data_buffer, 512), H);
+    if (data_buffer_bit_length == BlockLen) {
+      Engine::CompressBlocks(
+          H, reinterpret_cast<const std::uint8_t*>(data_buffer.data()), 1);
       data_buffer_bit_length = 0;
     }
   }
 
-  while (input_bits >= 512) {
-    std::memcpy(data_buffer.data(), input_ptr, 64);
-    H = ProcessMessageBlock(MakeMessage(data_buffer, 512), H);
-    input_ptr += 64;
-    input_bits -= 512;
+  while (input_bits >= BlockLen) {
+    Engine::CompressBlocks(H, input_ptr, 1);
+    input_ptr += kBlockBytes;
+    input_bits -= BlockLen;
   }
 
   if (input_bits > 0) {
@@ -239,32 +325,17 @@ inline void SHA<256>::Update(const HashAlgorithmInputData& data) {
   }
 }
 
-template <>
-inline std::array<std::byte, 32> SHA<256>::Digest() {
-  std::array<std::uint32_t, 16> M = {};
-
-  M = MakeMessage(data_buffer, data_buffer_bit_length);
-  M[(data_buffer_bit_length / 32) % 16] |=
-      (1u << (31 - (data_buffer_bit_length % 32)));
-
-  if (data_buffer_bit_length % 512 > 447) {
-    H = ProcessMessageBlock(M, H);
-    M.fill(0);
-  }
-  M[14] = static_cast<uint32_t>(data_length >> 32);
-  M[15] = static_cast<uint32_t>(data_length & 0xFFFFFFFF);
-  H = ProcessMessageBlock(M, H);
-  data_buffer_bit_length = 0;
-
-  std::array<std::byte, 32> ret;
-  for (int i = 0; i < 8; i++) {
-    std::uint32_t v = ::htonl(H[i]);
-    std::memcpy(ret.data() + i * 4, &v, 4);
-  }
+template <std::uint32_t DigestLen, std::uint32_t BlockLen>
+std::array<std::byte, DigestLen / 8> SHA<DigestLen, BlockLen>::Digest() {
+  TailBlocks tail;
+  const std::size_t tail_blocks =
+      PadTail(tail, reinterpret_cast<const std::uint8_t*>(data_buffer.data()),
+              data_buffer_bit_length, data_length);
+  Engine::CompressBlocks(H, tail.data(), tail_blocks);
 
+  const auto ret = Output(H);
   Reset();
-
   return ret;
 }
 
-};  // namespace bedrock::hash
\ No newline at end of file
+};  // namespace bedrock::hash
@@ -0,0 +1,117 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// SHA-1 상수와 압축 함수 구성 요소. 레거시 체크섬 호환용
+namespace bedrock::hash::sha1 {
+
+using State = std::array<std::uint32_t, 5>;
+
+inline constexpr std::size_t kBlockBytes = 64;
+
+// 20라운드 단위(단계)마다 바뀌는 상수
+inline constexpr std::array<std::uint32_t, 4> kK = {0x5a827999, 0x6ed9eba1,
+                                                    0x8f1bbcdc, 0xca62c1d6};
+inline constexpr State kH0 = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476,
+                              0xc3d2e1f0};
+
+constexpr std::uint32_t Rotl(std::uint32_t x, std::uint32_t n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+constexpr std::uint32_t LoadBigEndian32(const std::uint8_t* p) {
+  return (static_cast<std::uint32_t>(p[0]) << 24) |
+         (static_cast<std::uint32_t>(p[1]) << 16) |
+         (static_cast<std::uint32_t>(p[2]) << 8) |
+         static_cast<std::uint32_t>(p[3]);
+}
+
+// 단계별 논리 함수: Ch / Parity / Maj / Parity
+template <std::size_t kStage>
+constexpr std::uint32_t F(std::uint32_t b, std::uint32_t c, std::uint32_t d) {
+  if constexpr (kStage == 0) {
+    return d ^ (b & (c ^ d));
+  } else if constexpr (kStage == 2) {
+    return (b & c) | (d & (b | c));
+  } else {
+    return b ^ c ^ d;
+  }
+}
+
+// 라운드 하나. 상태를 옮기지 않고 변수 역할을 돌려가며 호출
+template <std::size_t kStage>
+constexpr void Round(std::uint32_t a, std::uint32_t& b, std::uint32_t c,
+                     std::uint32_t d, std::uint32_t& e,
+                     std::uint32_t k_plus_w) {
+  e += Rotl(a, 5) + F<kStage>(b, c, d) + k_plus_w;
+  b = Rotl(b, 30);
+}
+
+// W[t] + K 20개로 한 단계(20라운드). 변수 5개가 제자리로 돌아오는 단위
+template <std::size_t kStage>
+constexpr void TwentyRounds(State& v, const std::uint32_t* k_plus_w) {
+  std::uint32_t a = v[0];
+  std::uint32_t b = v[1];
+  std::uint32_t c = v[2];
+  std::uint32_t d = v[3];
+  std::uint32_t e = v[4];
+  for (std::size_t i = 0; i < 20; i += 5) {
+    Round<kStage>(a, b, c, d, e, k_plus_w[i]);
+    Round<kStage>(e, a, b, c, d, k_plus_w[i + 1]);
+    Round<kStage>(d, e, a, b, c, k_plus_w[i + 2]);
+    Round<kStage>(c, d, e, a, b, k_plus_w[i + 3]);
+    Round<kStage>(b, c, d, e, a, k_plus_w[i + 4]);
+  }
+  v = {a, b, c, d, e};
+}
+
+// 블록 하나. 16워드 창을 순환하며 스케줄 계산
+constexpr void CompressBytes(State& h, const std::uint8_t* block) {
+  std::array<std::uint32_t, 16> w = {};
+  for (std::size_t t = 0; t < 16; t++) {
+    w[t] = LoadBigEndian32(block + (t * 4));
+  }
+
+  State v = h;
+  std::array<std::uint32_t, 20> k_plus_w = {};
+  const auto fill = [&](std::size_t stage) {
+    for (std::size_t i = 0; i < 20; i++) {
+      const std::size_t t = (stage * 20) + i;
+      if (t >= 16) {
+        w[t % 16] = Rotl(w[(t - 3) % 16] ^ w[(t - 8) % 16] ^
+                             w[(t - 14) % 16] ^ w[t % 16],
+                         1);
+      }
+      k_plus_w[i] = kK[stage] + w[t % 16];
+    }
+  };
+  fill(0);
+  TwentyRounds<0>(v, k_plus_w.data());
+  fill(1);
+  TwentyRounds<1>(v, k_plus_w.data());
+  fill(2);
+  TwentyRounds<2>(v, k_plus_w.data());
+  fill(3);
+  TwentyRounds<3>(v, k_plus_w.data());
+
+  for (std::size_t i = 0; i < 5; i++) {
+    h[i] += v[i];
+  }
+}
+
+// 런타임 디스패치 압축 (SHA-NI > SSSE3 > 스칼라).
+// data는 빅엔디언 64바이트 블록 blocks개
+void CompressBlocks(State& h, const std::uint8_t* data,
+                    std::size_t blocks) noexcept;
+
+void CompressBlocksScalar(State& h, const std::uint8_t* data,
+                          std::size_t blocks) noexcept;
+// 메시지 스케줄을 4워드씩 xmm에서 계산
+void CompressBlocksSsse3(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept;
+// SHA + SSE4.1 (sha1rnds4 / sha1msg1 / sha1msg2)
+void CompressBlocksShaNi(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept;
+
+}  // namespace bedrock::hash::sha1
@@ -0,0 +1,101 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "encryption/hash/sha256_core.h"
+
+// 컴파일 시간에도 계산할 수 있는 SHA-256 / HMAC-SHA256.
+// 문자열 리터럴이나 내장 테이블의 다이제스트를 constexpr 상수로 만들 때 사용.
+// 스칼라 압축만 쓰므로 런타임에는 SHA<256> / HmacSha256이 더 빠름
+namespace bedrock::hash::sha256 {
+
+// uint8_t / char / std::byte 입력을 같은 경로로 읽음
+template <typename Byte>
+constexpr void LoadBytes(std::uint8_t* out, const Byte* in, std::size_t size) {
+  static_assert(sizeof(Byte) == 1);
+  for (std::size_t i = 0; i < size; i++) {
+    out[i] = static_cast<std::uint8_t>(in[i]);
+  }
+}
+
+// h에 data를 이어 넣고 패딩까지 압축. prefix_bytes는 h에 이미 들어간 길이
+template <typename Byte>
+constexpr Digest FinishConstexpr(State h, std::span<const Byte> data,
+                                 std::uint64_t prefix_bytes) {
+  std::array<std::uint8_t, kBlockBytes> block{};
+  const std::size_t full = data.size() / kBlockBytes;
+  for (std::size_t i = 0; i < full; i++) {
+    LoadBytes(block.data(), data.data() + (i * kBlockBytes), kBlockBytes);
+    CompressBytes(h, block.data());
+  }
+
+  const std::size_t rest = data.size() % kBlockBytes;
+  LoadBytes(block.data(), data.data() + (full * kBlockBytes), rest);
+  TailBlocks tail{};
+  const std::size_t blocks =
+      PadTail(tail, block.data(), rest, prefix_bytes + data.size());
+  for (std::size_t i = 0; i < blocks; i++) {
+    CompressBytes(h, tail.data() + (i * kBlockBytes));
+  }
+
+  Digest digest{};
+  for (std::size_t i = 0; i < 8; i++) {
+    StoreBigEndian32(digest.data() + (i * 4), h[i]);
+  }
+  return digest;
+}
+
+template <typename KeyByte, typename MessageByte>
+constexpr Digest HmacBytesConstexpr(std::span<const KeyByte> key,
+                                    std::span<const MessageByte> message) {
+  // 블록보다 긴 키는 해시한 값을 키로 사용 (RFC 2104)
+  std::array<std::uint8_t, kBlockBytes> key_block{};
+  if (key.size() > kBlockBytes) {
+    const Digest hashed = FinishConstexpr(kH0, key, 0);
+    LoadBytes(key_block.data(), hashed.data(), hashed.size());
+  } else {
+    LoadBytes(key_block.data(), key.data(), key.size());
+  }
+
+  std::array<std::uint8_t, kBlockBytes> pad{};
+  State inner = kH0;
+  for (std::size_t i = 0; i < kBlockBytes; i++) {
+    pad[i] = static_cast<std::uint8_t>(key_block[i] ^ 0x36U);
+  }
+  CompressBytes(inner, pad.data());
+  State outer = kH0;
+  for (std::size_t i = 0; i < kBlockBytes; i++) {
+    pad[i] = static_cast<std::uint8_t>(key_block[i] ^ 0x5cU);
+  }
+  CompressBytes(outer, pad.data());
+
+  const Digest inner_digest = FinishConstexpr(inner, message, kBlockBytes);
+  return FinishConstexpr(outer, std::span<const std::uint8_t>(inner_digest),
+                         kBlockBytes);
+}
+
+constexpr Digest DigestConstexpr(std::span<const std::uint8_t> data) {
+  return FinishConstexpr(kH0, data, 0);
+}
+constexpr Digest DigestConstexpr(std::span<const std::byte> data) {
+  return FinishConstexpr(kH0, data, 0);
+}
+// 문자열 리터럴용. 끝의 NUL은 포함하지 않음
+constexpr Digest DigestConstexpr(std::string_view text) {
+  return FinishConstexpr(kH0, std::span(text.data(), text.size()), 0);
+}
+
+constexpr Digest HmacConstexpr(std::span<const std::uint8_t> key,
+                               std::span<const std::uint8_t> message) {
+  return HmacBytesConstexpr(key, message);
+}
+constexpr Digest HmacConstexpr(std::string_view key,
+                               std::string_view message) {
+  return HmacBytesConstexpr(std::span(key.data(), key.size()),
+                            std::span(message.data(), message.size()));
+}
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,211 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// SHA-256 라운드 상수와 압축 함수 구성 요소.
+// SHA<256>과 HMAC/스티칭 모드가 같은 구현을 공유하도록 분리.
+namespace bedrock::hash::sha256 {
+
+using State = std::array<std::uint32_t, 8>;
+using MessageBlock = std::array<std::uint32_t, 16>;
+using Schedule = std::array<std::uint32_t, 64>;
+
+inline constexpr std::size_t kBlockBytes = 64;
+inline constexpr std::size_t kDigestBytes = 32;
+
+using Digest = std::array<std::uint8_t, kDigestBytes>;
+
+inline constexpr std::array<std::uint32_t, 64> kK = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+inline constexpr State kH0 = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                              0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+// SHA-224 초기값 (압축 함수는 같고 출력만 앞 7워드)
+inline constexpr State kH0_224 = {0xc1059ed8, 0x367cd507, 0x3070dd17,
+                                  0xf70e5939, 0xffc00b31, 0x68581511,
+                                  0x64f98fa7, 0xbefa4fa4};
+
+constexpr std::uint32_t Rotr(std::uint32_t x, std::uint32_t n) {
+  return (x >> n) | (x << (32 - n));
+}
+constexpr std::uint32_t Ch(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+  return (x & y) ^ (~x & z);
+}
+constexpr std::uint32_t Maj(std::uint32_t x, std::uint32_t y,
+                            std::uint32_t z) {
+  return (x & y) ^ (x & z) ^ (y & z);
+}
+constexpr std::uint32_t Sigma0(std::uint32_t x) {
+  return Rotr(x, 2) ^ Rotr(x, 13) ^ Rotr(x, 22);
+}
+constexpr std::uint32_t Sigma1(std::uint32_t x) {
+  return Rotr(x, 6) ^ Rotr(x, 11) ^ Rotr(x, 25);
+}
+constexpr std::uint32_t SmallSigma0(std::uint32_t x) {
+  return Rotr(x, 7) ^ Rotr(x, 18) ^ (x >> 3);
+}
+constexpr std::uint32_t SmallSigma1(std::uint32_t x) {
+  return Rotr(x, 17) ^ Rotr(x, 19) ^ (x >> 10);
+}
+
+constexpr std::uint32_t LoadBigEndian32(const std::uint8_t* p) {
+  return (static_cast<std::uint32_t>(p[0]) << 24) |
+         (static_cast<std::uint32_t>(p[1]) << 16) |
+         (static_cast<std::uint32_t>(p[2]) << 8) |
+         static_cast<std::uint32_t>(p[3]);
+}
+constexpr void StoreBigEndian32(std::uint8_t* p, std::uint32_t v) {
+  p[0] = static_cast<std::uint8_t>(v >> 24);
+  p[1] = static_cast<std::uint8_t>(v >> 16);
+  p[2] = static_cast<std::uint8_t>(v >> 8);
+  p[3] = static_cast<std::uint8_t>(v);
+}
+
+constexpr MessageBlock LoadBlock(const std::uint8_t* block) {
+  MessageBlock m = {};
+  for (std::size_t t = 0; t < 16; t++) {
+    m[t] = LoadBigEndian32(block + (t * 4));
+  }
+  return m;
+}
+
+constexpr Schedule ExpandSchedule(const MessageBlock& m) {
+  Schedule w = {};
+  for (std::size_t t = 0; t < 16; t++) {
+    w[t] = m[t];
+  }
+  for (std::size_t t = 16; t < 64; t++) {
+    w[t] = SmallSigma1(w[t - 2]) + w[t - 7] + SmallSigma0(w[t - 15]) +
+           w[t - 16];
+  }
+  return w;
+}
+
+// 라운드 하나. v = {a, b, c, d, e, f, g, h}
+constexpr void Round(State& v, std::uint32_t k_plus_w) {
+  const std::uint32_t t1 = v[7] + Sigma1(v[4]) + Ch(v[4], v[5], v[6]) + k_plus_w;
+  const std::uint32_t t2 = Sigma0(v[0]) + Maj(v[0], v[1], v[2]);
+  v[7] = v[6];
+  v[6] = v[5];
+  v[5] = v[4];
+  v[4] = v[3] + t1;
+  v[3] = v[2];
+  v[2] = v[1];
+  v[1] = v[0];
+  v[0] = t1 + t2;
+}
+
+constexpr void Compress(State& h, const MessageBlock& m) {
+  const Schedule w = ExpandSchedule(m);
+  State v = h;
+  for (std::size_t t = 0; t < 64; t++) {
+    Round(v, kK[t] + w[t]);
+  }
+  for (std::size_t i = 0; i < 8; i++) {
+    h[i] += v[i];
+  }
+}
+
+constexpr void CompressBytes(State& h, const std::uint8_t* block) {
+  Compress(h, LoadBlock(block));
+}
+
+using TailBlocks = std::array<std::uint8_t, kBlockBytes * 2>;
+
+// 마지막 64바이트 미만 조각(rest)에 0x80과 전체 비트 길이를 붙여 tail에 씀.
+// 패딩된 블록 수(1 또는 2)를 돌려줌
+constexpr std::size_t PadTail(TailBlocks& tail, const std::uint8_t* rest,
+                              std::size_t rest_bytes,
+                              std::uint64_t total_bytes) {
+  tail.fill(0);
+  for (std::size_t i = 0; i < rest_bytes; i++) {
+    tail[i] = rest[i];
+  }
+  tail[rest_bytes] = 0x80;
+  const std::size_t blocks = rest_bytes < kBlockBytes - 8 ? 1 : 2;
+
+  const std::uint64_t bit_length = total_bytes << 3;
+  std::uint8_t* length = tail.data() + (blocks * kBlockBytes) - 8;
+  StoreBigEndian32(length, static_cast<std::uint32_t>(bit_length >> 32));
+  StoreBigEndian32(length + 4, static_cast<std::uint32_t>(bit_length));
+  return blocks;
+}
+
+// 64바이트 메시지(머클 내부 노드 등)의 두 번째 블록은 항상 0x80, 0...,
+// 비트 길이 512라 메시지 스케줄 W[t] + K[t]를 컴파일 시간에 계산해 둠
+inline constexpr Schedule kPad64KPlusW = [] {
+  MessageBlock m{};
+  m[0] = 0x80000000;
+  m[15] = kBlockBytes * 8;
+  Schedule w = ExpandSchedule(m);
+  for (std::size_t t = 0; t < 64; t++) {
+    w[t] += kK[t];
+  }
+  return w;
+}();
+
+// 벡터 스케줄 커널용 라운드. 상태를 옮기지 않고 변수 역할을 돌려가며 호출
+constexpr void Round(std::uint32_t a, std::uint32_t b, std::uint32_t c,
+                     std::uint32_t& d, std::uint32_t e, std::uint32_t f,
+                     std::uint32_t g, std::uint32_t& h,
+                     std::uint32_t k_plus_w) {
+  const std::uint32_t t1 = h + Sigma1(e) + Ch(e, f, g) + k_plus_w;
+  d += t1;
+  h = t1 + Sigma0(a) + Maj(a, b, c);
+}
+
+// W[t] + K[t] 8개로 8라운드
+constexpr void EightRounds(State& v, const std::uint32_t* k_plus_w) {
+  std::uint32_t a = v[0];
+  std::uint32_t b = v[1];
+  std::uint32_t c = v[2];
+  std::uint32_t d = v[3];
+  std::uint32_t e = v[4];
+  std::uint32_t f = v[5];
+  std::uint32_t g = v[6];
+  std::uint32_t h = v[7];
+  Round(a, b, c, d, e, f, g, h, k_plus_w[0]);
+  Round(h, a, b, c, d, e, f, g, k_plus_w[1]);
+  Round(g, h, a, b, c, d, e, f, k_plus_w[2]);
+  Round(f, g, h, a, b, c, d, e, k_plus_w[3]);
+  Round(e, f, g, h, a, b, c, d, k_plus_w[4]);
+  Round(d, e, f, g, h, a, b, c, k_plus_w[5]);
+  Round(c, d, e, f, g, h, a, b, k_plus_w[6]);
+  Round(b, c, d, e, f, g, h, a, k_plus_w[7]);
+  v = {a, b, c, d, e, f, g, h};
+}
+
+// 런타임 디스패치 압축 (SHA-NI > AVX2 > SSSE3 > 스칼라).
+// data는 빅엔디언 64바이트 블록 blocks개
+void CompressBlocks(State& h, const std::uint8_t* data,
+                    std::size_t blocks) noexcept;
+
+void CompressBlocksScalar(State& h, const std::uint8_t* data,
+                          std::size_t blocks) noexcept;
+// 메시지 스케줄을 4워드씩 계산, 16워드 창만 유지
+void CompressBlocksSsse3(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept;
+// 두 블록의 스케줄을 ymm 레인 하나씩에 넣어 함께 계산
+void CompressBlocksAvx2(State& h, const std::uint8_t* data,
+                        std::size_t blocks) noexcept;
+// SHA + SSE4.1
+void CompressBlocksShaNi(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept;
+
+// 스케줄을 미리 아는 블록 하나 압축. k_plus_w = W[t] + K[t] 64개
+// 메시지 스케줄 계산이 없어 SHA-NI에서는 sha256rnds2만 남음
+void CompressKPlusW(State& h, const std::uint32_t* k_plus_w) noexcept;
+void CompressKPlusWScalar(State& h, const std::uint32_t* k_plus_w) noexcept;
+void CompressKPlusWShaNi(State& h, const std::uint32_t* k_plus_w) noexcept;
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,30 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/sha256_multi.h"
+
+// 길이가 고정된 입력의 SHA-256. 머클 내부 노드(자식 다이제스트 두 개 =
+// 64바이트)와 다이제스트 재해시(32바이트)는 패딩이 항상 같으므로
+// Update의 버퍼링 / 패딩 계산 없이 바로 압축
+namespace bedrock::hash::sha256 {
+
+using Block64 = std::array<std::uint8_t, kBlockBytes>;
+
+// 압축 두 번. 두 번째(패딩) 블록은 미리 계산한 스케줄 kPad64KPlusW 사용
+[[nodiscard]] Digest Hash64(std::span<const std::uint8_t, 64> data) noexcept;
+[[nodiscard]] Digest Hash64(const Digest& left, const Digest& right) noexcept;
+// 압축 한 번 (데이터 32바이트 + 고정 패딩)
+[[nodiscard]] Digest Hash32(std::span<const std::uint8_t, 32> data) noexcept;
+
+// digests[i] = Hash64(inputs[i]) / Hash32(inputs[i]). digests가 짧으면 false
+// AVX-512F면 16레인. 그 외에는 SHA-NI 단일 압축이 8레인 AVX2보다 빠르므로
+// SHA-NI가 있으면 항목마다, 없으면 AVX2 8레인
+bool Hash64Many(std::span<const Block64> inputs,
+                std::span<Digest> digests) noexcept;
+bool Hash32Many(std::span<const Digest> inputs,
+                std::span<Digest> digests) noexcept;
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/sha256_core.h"
+
+// 서로 독립인 메시지 여러 개의 SHA-256을 SIMD 레인에 나눠 동시에 계산.
+// 레인마다 메시지 하나를 맡아 블록 단위로 진행하고, 끝난 레인에는
+// 다음 메시지를 바로 채워 넣음
+namespace bedrock::hash::sha256 {
+
+// digests[i] = SHA-256(messages[i]). digests가 messages보다 짧으면 false
+// AVX-512F면 16레인, AVX2면 8레인, 둘 다 없으면 메시지마다 CompressBlocks
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest> digests) noexcept;
+
+// 레인 스케줄러. SHA-256 DigestMany, HMAC VerifyMany, HKDF ExpandMany,
+// SHA3 / LSH DigestMany가 함께 씀. 레인마다 Job 하나가 블록을 하나씩 내고
+// compress 한 번이 모든 레인을 한 블록씩 진행시킴. 쉬는 레인에는
+// idle_block을 넣고 그 결과는 버림
+//   start(lane, job)  : 다음 작업을 job에 올리고 레인 상태를 초기화.
+//                       남은 작업이 없으면 false
+//   compress(blocks)  : 레인마다 blocks[lane]을 압축
+//   finish(lane, job) : job.Done()이 된 레인의 결과를 꺼냄. 같은 레인에서
+//                       이어 갈 작업(HMAC 바깥쪽 해시 등)을 올렸으면 true
+// Job은 const std::uint8_t* NextBlock()과 bool Done() const를 제공
+template <std::size_t kLanes, typename Job, typename Start, typename Compress,
+          typename Finish>
+void RunLanes(const std::uint8_t* idle_block, Start&& start,
+              Compress&& compress, Finish&& finish) {
+  std::array<Job, kLanes> jobs{};
+  std::array<bool, kLanes> busy{};
+  std::array<const std::uint8_t*, kLanes> blocks{};
+
+  while (true) {
+    std::size_t active = 0;
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      if (!busy[lane]) {
+        busy[lane] = start(lane, jobs[lane]);
+      }
+      if (busy[lane]) {
+        blocks[lane] = jobs[lane].NextBlock();
+        ++active;
+      } else {
+        blocks[lane] = idle_block;
+      }
+    }
+    if (active == 0) {
+      return;
+    }
+
+    compress(blocks.data());
+
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      if (busy[lane] && jobs[lane].Done()) {
+        busy[lane] = finish(lane, jobs[lane]);
+      }
+    }
+  }
+}
+
+// 레인 커널. 레인마다 blocks[lane]의 64바이트 블록 하나를 압축
+// state는 워드 우선 배치: state[word * 레인 수 + lane]
+void CompressLanesAvx2(std::uint32_t* state,
+                       const std::uint8_t* const* blocks) noexcept;
+void CompressLanesAvx512(std::uint32_t* state,
+                         const std::uint8_t* const* blocks) noexcept;
+// 모든 레인이 스케줄을 미리 아는 같은 블록을 압축 (W[t] + K[t] 브로드캐스트)
+void CompressKPlusWLanesAvx2(std::uint32_t* state,
+                             const std::uint32_t* k_plus_w) noexcept;
+void CompressKPlusWLanesAvx512(std::uint32_t* state,
+                               const std::uint32_t* k_plus_w) noexcept;
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,232 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <span>
+
+#include "common.h"
+#include "encryption/hash/keccak_core.h"
+
+namespace bedrock::hash {
+
+// Keccak 스펀지. kRate는 블록 바이트 수, kSuffix는 도메인 구분 비트와
+// pad10*1의 첫 1비트 (SHA-3 0x06, SHAKE 0x1F)
+template <std::size_t kRate, std::uint8_t kSuffix>
+class KeccakSponge {
+ public:
+  KeccakSponge() { Reset(); }
+
+  void Reset() {
+    state.fill(0);
+    offset = 0;
+    trailing = 0;
+    trailing_bits = 0;
+    squeezing = false;
+  }
+
+  // 이미 짜내는 중이거나 바이트 중간에서 끝난 입력을 받은 뒤면 아무것도
+  // 흡수하지 않고 false. Reset 후 다시 사용
+  bool Absorb(std::span<const std::uint8_t> data) {
+    if (squeezing || trailing_bits != 0) {
+      return false;
+    }
+    // 앞 블록을 채우는 동안은 바이트 단위
+    while (!data.empty() && offset != 0) {
+      XorByte(offset++, data[0]);
+      data = data.subspan(1);
+      if (offset == kRate) {
+        keccak::Permute(state);
+        offset = 0;
+      }
+    }
+    // 완성 블록은 레인 단위로 바로 XOR
+    while (data.size() >= kRate) {
+      for (std::size_t i = 0; i < kRate / 8; i++) {
+        state[i] ^= keccak::LoadLittleEndian64(data.data() + (i * 8));
+      }
+      keccak::Permute(state);
+      data = data.subspan(kRate);
+    }
+    for (const std::uint8_t byte : data) {
+      XorByte(offset++, byte);
+    }
+    return true;
+  }
+
+  // 앞 bit_length bit만 흡수. 마지막 바이트의 남는 bit는 FIPS 202 B.1
+  // 순서대로 하위 bit부터 메시지 bit (5bit 메시지 11001 = 0x13).
+  // 바이트 중간에서 끝나면 그 뒤의 Absorb / AbsorbBits는 false
+  bool AbsorbBits(std::span<const std::uint8_t> data, std::size_t bit_length) {
+    if (data.size() < (bit_length + 7) / 8 ||
+        !Absorb(data.first(bit_length / 8))) {
+      return false;
+    }
+    trailing_bits = bit_length % 8;
+    if (trailing_bits != 0) {
+      trailing = static_cast<std::uint8_t>(data[bit_length / 8] &
+                                           ((1U << trailing_bits) - 1));
+    }
+    return true;
+  }
+
+  // 첫 호출에서 패딩 후 짜내기 시작. 이어서 부르면 출력이 이어짐
+  void Squeeze(std::span<std::uint8_t> out) {
+    if (!squeezing) {
+      // 남은 bit 뒤에 도메인 비트와 pad10*1의 첫 1을 붙임. 다음 바이트
+      // (블록)로 넘칠 수 있고, 첫 1이 블록 마지막 bit면 끝 1은 다음 블록에
+      const unsigned value = trailing | (unsigned{kSuffix} << trailing_bits);
+      std::size_t end_bit =
+          (offset * 8) + trailing_bits +
+          static_cast<std::size_t>(std::bit_width(kSuffix));
+      XorByte(offset, static_cast<std::uint8_t>(value));
+      if (end_bit > (offset + 1) * 8) {
+        if (offset + 1 == kRate) {
+          keccak::Permute(state);
+          end_bit -= kRate * 8;
+          XorByte(0, static_cast<std::uint8_t>(value >> 8));
+        } else {
+          XorByte(offset + 1, static_cast<std::uint8_t>(value >> 8));
+        }
+      }
+      if (end_bit == kRate * 8) {
+        keccak::Permute(state);
+      }
+      XorByte(kRate - 1, 0x80);
+      keccak::Permute(state);
+      offset = 0;
+      squeezing = true;
+    }
+    for (std::uint8_t& byte : out) {
+      if (offset == kRate) {
+        keccak::Permute(state);
+        offset = 0;
+      }
+      byte = static_cast<std::uint8_t>(state[offset / 8] >> (8 * (offset % 8)));
+      offset++;
+    }
+  }
+
+ private:
+  void XorByte(std::size_t index, std::uint8_t byte) {
+    state[index / 8] ^= static_cast<std::uint64_t>(byte) << (8 * (index % 8));
+  }
+
+  keccak::State state;
+  std::size_t offset = 0;
+  // 바이트 중간에서 끝난 입력의 남는 bit (하위 trailing_bits개)
+  std::uint8_t trailing = 0;
+  std::size_t trailing_bits = 0;
+  bool squeezing = false;
+};
+
+// SHA3-224/256/384/512 (FIPS 202). bit 단위 입력은 마지막 Update에서만
+template <std::uint32_t DigestLen>
+class SHA3 : public HashAlgorithm<DigestLen> {
+ public:
+  static constexpr std::size_t kRate = keccak::kStateBytes - (DigestLen / 4);
+
+  SHA3() {
+    this->digest_size = DigestLen;
+    this->inner_block_size = kRate * 8;
+  }
+
+  std::array<std::byte, DigestLen / 8> Digest(
+      std::span<const std::uint8_t> data) const final override {
+    KeccakSponge<kRate, 0x06> one_shot;
+    one_shot.Absorb(data);
+    return Squeeze(one_shot);
+  }
+
+  // bit_length가 8의 배수가 아니면 이 입력으로 메시지가 끝남 (AbsorbBits)
+  void Update(const HashAlgorithmInputData& data) final override {
+    sponge.AbsorbBits(
+        std::span(reinterpret_cast<const std::uint8_t*>(data.message.data()),
+                  data.message.size()),
+        data.bit_length);
+  }
+  // 거부된 입력(KeccakSponge::Absorb 참고)이면 false
+  bool Update(std::span<const std::uint8_t> data) {
+    return sponge.Absorb(data);
+  }
+
+  std::array<std::byte, DigestLen / 8> Digest() final override {
+    const auto ret = Squeeze(sponge);
+    Reset();
+    return ret;
+  }
+  void Reset() final override { sponge.Reset(); }
+
+ private:
+  static std::array<std::byte, DigestLen / 8> Squeeze(
+      KeccakSponge<kRate, 0x06>& from) {
+    std::array<std::byte, DigestLen / 8> ret;
+    from.Squeeze(std::span(reinterpret_cast<std::uint8_t*>(ret.data()),
+                           ret.size()));
+    return ret;
+  }
+
+  KeccakSponge<kRate, 0x06> sponge;
+};
+
+// SHAKE128/256 XOF. HashAlgorithm 인터페이스의 Digest()는 DigestLen비트
+// (기본값은 보안 강도의 두 배)를 내고, Squeeze로는 원하는 만큼 이어서 뽑음
+template <std::uint32_t Security, std::uint32_t DigestLen = Security * 2>
+class SHAKE : public HashAlgorithm<DigestLen> {
+ public:
+  static constexpr std::size_t kRate = keccak::kStateBytes - (Security / 4);
+
+  SHAKE() {
+    this->digest_size = DigestLen;
+    this->inner_block_size = kRate * 8;
+  }
+
+  std::array<std::byte, DigestLen / 8> Digest(
+      std::span<const std::uint8_t> data) const final override {
+    std::array<std::byte, DigestLen / 8> ret;
+    Digest(data, std::span(reinterpret_cast<std::uint8_t*>(ret.data()),
+                           ret.size()));
+    return ret;
+  }
+  // 한 번에 임의 길이 출력
+  void Digest(std::span<const std::uint8_t> data,
+              std::span<std::uint8_t> out) const {
+    KeccakSponge<kRate, 0x1F> one_shot;
+    one_shot.Absorb(data);
+    one_shot.Squeeze(out);
+  }
+
+  // bit_length가 8의 배수가 아니면 이 입력으로 메시지가 끝남 (AbsorbBits)
+  void Update(const HashAlgorithmInputData& data) final override {
+    sponge.AbsorbBits(
+        std::span(reinterpret_cast<const std::uint8_t*>(data.message.data()),
+                  data.message.size()),
+        data.bit_length);
+  }
+  // 거부된 입력(KeccakSponge::Absorb 참고)이면 false
+  bool Update(std::span<const std::uint8_t> data) {
+    return sponge.Absorb(data);
+  }
+
+  // 입력을 닫고 출력을 이어서 뽑음. 그 뒤의 Update는 Reset 전까지 거부됨
+  void Squeeze(std::span<std::uint8_t> out) { sponge.Squeeze(out); }
+
+  std::array<std::byte, DigestLen / 8> Digest() final override {
+    std::array<std::byte, DigestLen / 8> ret;
+    Squeeze(std::span(reinterpret_cast<std::uint8_t*>(ret.data()), ret.size()));
+    Reset();
+    return ret;
+  }
+  void Reset() final override { sponge.Reset(); }
+
+ private:
+  KeccakSponge<kRate, 0x1F> sponge;
+};
+
+using SHA3_224 = SHA3<224>;
+using SHA3_256 = SHA3<256>;
+using SHA3_384 = SHA3<384>;
+using SHA3_512 = SHA3<512>;
+using SHAKE128 = SHAKE<128>;
+using SHAKE256 = SHAKE<256>;
+
+};  // namespace bedrock::hash
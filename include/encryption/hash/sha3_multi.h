@@ -0,0 +1,23 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "encryption/hash/keccak_core.h"
+
+// 짧은 메시지 여러 개의 SHA3-256 / SHA3-512를 Keccak 상태 4개씩 묶어
+// 동시에 계산. 끝난 레인에는 다음 메시지를 바로 채워 넣음
+namespace bedrock::hash::sha3 {
+
+template <std::size_t kBytes>
+using Digest = std::array<std::uint8_t, kBytes>;
+
+// digests[i] = SHA3-256(messages[i]) / SHA3-512(messages[i]).
+// digests가 messages보다 짧으면 false. AVX2가 없으면 메시지마다 스펀지
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<32>> digests) noexcept;
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<64>> digests) noexcept;
+
+}  // namespace bedrock::hash::sha3
@@ -0,0 +1,163 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// SHA-512 계열(SHA-384, SHA-512, SHA-512/256) 상수와 압축 함수 구성 요소.
+// 워드가 64비트, 블록이 128바이트, 라운드가 80개인 것 말고는 sha256_core.h와
+// 같은 구성
+namespace bedrock::hash::sha512 {
+
+using State = std::array<std::uint64_t, 8>;
+
+inline constexpr std::size_t kBlockBytes = 128;
+
+inline constexpr std::array<std::uint64_t, 80> kK = {
+    0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f,
+    0xe9b5dba58189dbbc, 0x3956c25bf348b538, 0x59f111f1b605d019,
+    0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242,
+    0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+    0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
+    0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3,
+    0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275,
+    0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+    0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f,
+    0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+    0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc,
+    0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+    0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6,
+    0x92722c851482353b, 0xa2bfe8a14cf10364, 0xa81a664bbc423001,
+    0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
+    0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+    0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99,
+    0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb,
+    0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc,
+    0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915,
+    0xc67178f2e372532b, 0xca273eceea26619c, 0xd186b8c721c0c207,
+    0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba,
+    0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+    0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
+    0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a,
+    0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
+
+// 초기 해시값. SHA-512 / SHA-384 / SHA-512/256
+inline constexpr State kH0 = {
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b,
+    0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+    0x1f83d9abfb41bd6b, 0x5be0cd19137e2179};
+inline constexpr State kH0_384 = {
+    0xcbbb9d5dc1059ed8, 0x629a292a367cd507, 0x9159015a3070dd17,
+    0x152fecd8f70e5939, 0x67332667ffc00b31, 0x8eb44a8768581511,
+    0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4};
+inline constexpr State kH0_256 = {
+    0x22312194fc2bf72c, 0x9f555fa3c84c64c2, 0x2393b86b6f53b151,
+    0x963877195940eabd, 0x96283ee2a88effe3, 0xbe5e1e2553863992,
+    0x2b0199fc2c85b8aa, 0x0eb72ddc81c52ca2};
+
+constexpr std::uint64_t Rotr(std::uint64_t x, std::uint32_t n) {
+  return (x >> n) | (x << (64 - n));
+}
+constexpr std::uint64_t Ch(std::uint64_t x, std::uint64_t y, std::uint64_t z) {
+  return (x & y) ^ (~x & z);
+}
+constexpr std::uint64_t Maj(std::uint64_t x, std::uint64_t y,
+                            std::uint64_t z) {
+  return (x & y) ^ (x & z) ^ (y & z);
+}
+constexpr std::uint64_t Sigma0(std::uint64_t x) {
+  return Rotr(x, 28) ^ Rotr(x, 34) ^ Rotr(x, 39);
+}
+constexpr std::uint64_t Sigma1(std::uint64_t x) {
+  return Rotr(x, 14) ^ Rotr(x, 18) ^ Rotr(x, 41);
+}
+constexpr std::uint64_t SmallSigma0(std::uint64_t x) {
+  return Rotr(x, 1) ^ Rotr(x, 8) ^ (x >> 7);
+}
+constexpr std::uint64_t SmallSigma1(std::uint64_t x) {
+  return Rotr(x, 19) ^ Rotr(x, 61) ^ (x >> 6);
+}
+
+constexpr std::uint64_t LoadBigEndian64(const std::uint8_t* p) {
+  std::uint64_t v = 0;
+  for (std::size_t i = 0; i < 8; i++) {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+constexpr void StoreBigEndian64(std::uint8_t* p, std::uint64_t v) {
+  for (std::size_t i = 0; i < 8; i++) {
+    p[i] = static_cast<std::uint8_t>(v >> (56 - (i * 8)));
+  }
+}
+
+// 라운드 하나. 변수 역할을 돌려가며 호출 (sha256::Round와 같은 방식)
+constexpr void Round(std::uint64_t a, std::uint64_t b, std::uint64_t c,
+                     std::uint64_t& d, std::uint64_t e, std::uint64_t f,
+                     std::uint64_t g, std::uint64_t& h,
+                     std::uint64_t k_plus_w) {
+  const std::uint64_t t1 = h + Sigma1(e) + Ch(e, f, g) + k_plus_w;
+  d += t1;
+  h = t1 + Sigma0(a) + Maj(a, b, c);
+}
+
+// W[t] + K[t] 8개로 8라운드
+constexpr void EightRounds(State& v, const std::uint64_t* k_plus_w) {
+  std::uint64_t a = v[0];
+  std::uint64_t b = v[1];
+  std::uint64_t c = v[2];
+  std::uint64_t d = v[3];
+  std::uint64_t e = v[4];
+  std::uint64_t f = v[5];
+  std::uint64_t g = v[6];
+  std::uint64_t h = v[7];
+  Round(a, b, c, d, e, f, g, h, k_plus_w[0]);
+  Round(h, a, b, c, d, e, f, g, k_plus_w[1]);
+  Round(g, h, a, b, c, d, e, f, k_plus_w[2]);
+  Round(f, g, h, a, b, c, d, e, k_plus_w[3]);
+  Round(e, f, g, h, a, b, c, d, k_plus_w[4]);
+  Round(d, e, f, g, h, a, b, c, k_plus_w[5]);
+  Round(c, d, e, f, g, h, a, b, k_plus_w[6]);
+  Round(b, c, d, e, f, g, h, a, k_plus_w[7]);
+  v = {a, b, c, d, e, f, g, h};
+}
+
+// 블록 하나. 16워드 창을 순환하며 스케줄 계산
+constexpr void CompressBytes(State& h, const std::uint8_t* block) {
+  std::array<std::uint64_t, 16> w = {};
+  for (std::size_t t = 0; t < 16; t++) {
+    w[t] = LoadBigEndian64(block + (t * 8));
+  }
+
+  State v = h;
+  std::array<std::uint64_t, 8> k_plus_w = {};
+  for (std::size_t t = 0; t < 80; t++) {
+    if (t >= 16) {
+      w[t % 16] += SmallSigma1(w[(t - 2) % 16]) + w[(t - 7) % 16] +
+                   SmallSigma0(w[(t - 15) % 16]);
+    }
+    k_plus_w[t % 8] = kK[t] + w[t % 16];
+    if (t % 8 == 7) {
+      EightRounds(v, k_plus_w.data());
+    }
+  }
+  for (std::size_t i = 0; i < 8; i++) {
+    h[i] += v[i];
+  }
+}
+
+// 런타임 디스패치 압축 (AVX2 > SSSE3 > 스칼라).
+// data는 빅엔디언 128바이트 블록 blocks개
+void CompressBlocks(State& h, const std::uint8_t* data,
+                    std::size_t blocks) noexcept;
+
+void CompressBlocksScalar(State& h, const std::uint8_t* data,
+                          std::size_t blocks) noexcept;
+// 메시지 스케줄을 2워드씩 xmm에서 계산
+void CompressBlocksSsse3(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept;
+// 두 블록의 스케줄을 ymm 레인 하나씩에 넣어 함께 계산
+void CompressBlocksAvx2(State& h, const std::uint8_t* data,
+                        std::size_t blocks) noexcept;
+
+}  // namespace bedrock::hash::sha512
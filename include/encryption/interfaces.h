@@ -69,6 +69,16 @@ class BlockCipherAlgorithm {
   virtual ErrorStatus KeyExpantion(std::span<const std::uint8_t> key,
                                    BlockCipherCTX& ctx) const noexcept = 0;
 
+  // 서로 독립인 여러 블록을 한번에 암호화 (blocks.size()는 블록 크기의 배수)
+  // 기본 구현은 Encrypt를 블록마다 호출하며, 구현체가 병렬 커널로 재정의함
+  virtual ErrorStatus EncryptBlocks(BlockCipherCTX& ctx,
+                                    std::span<const std::uint8_t> blocks,
+                                    std::span<std::uint8_t> out) const noexcept;
+  // EncryptBlocks의 복호화 방향
+  virtual ErrorStatus DecryptBlocks(BlockCipherCTX& ctx,
+                                    std::span<const std::uint8_t> blocks,
+                                    std::span<std::uint8_t> out) const noexcept;
+
   [[nodiscard]] virtual std::uint32_t GetBlockSize() const noexcept = 0;
   [[nodiscard]] virtual const char* GetAlgorithmName() const noexcept = 0;
 };
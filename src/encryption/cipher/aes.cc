@@ -117,5 +117,28 @@ ErrorStatus AESImpl::Decrypt(BlockCipherCTX& key,
 
   return ErrorStatus::kSuccess;
 }
+ErrorStatus AESImpl::EncryptBlocks(BlockCipherCTX& key,
+                                   std::span<const std::uint8_t> blocks,
+                                   std::span<std::uint8_t> out) const noexcept {
+  if (!key.IsValid()) {
+    return ErrorStatus::kFailure;
+  }
+
+  if (blocks.size() % 16 != 0 || out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  EncryptBlocksImpl(key, blocks, out);
+
+  return ErrorStatus::kSuccess;
+}
+
+void AESImpl::EncryptBlocksImpl(BlockCipherCTX& ctx,
+                                std::span<const std::uint8_t> blocks,
+                                std::span<std::uint8_t> out) const noexcept {
+  for (std::size_t offset = 0; offset < blocks.size(); offset += 16) {
+    EncryptImpl(ctx, blocks.subspan(offset, 16), out.subspan(offset, 16));
+  }
+}
 
 }  // namespace bedrock::cipher
\ No newline at end of file
@@ -60,6 +60,52 @@ void AesNi::DecryptImpl(BlockCipherCTX& ctx,
   std::ranges::copy(ctx.state, out.begin());
 }
 
+void AesNi::EncryptBlocksImpl(BlockCipherCTX& ctx,
+                              std::span<const std::uint8_t> blocks,
+                              std::span<std::uint8_t> out) const noexcept {
+  constexpr std::size_t kLanes = 8;
+
+  const auto* round_keys =
+      reinterpret_cast<const __m128i*>(ctx.enc_round_keys.data());
+  const auto* in_ptr = reinterpret_cast<const __m128i*>(blocks.data());
+  auto* out_ptr = reinterpret_cast<__m128i*>(out.data());
+  const std::size_t block_count = blocks.size() / 16;
+  std::size_t i = 0;
+
+  // 블록 간 의존성이 없으므로 8개를 한 라운드씩 번갈아 돌려 aesenc 지연을 채움
+  for (; i + kLanes <= block_count; i += kLanes) {
+    __m128i lanes[kLanes];
+    __m128i round_key = _mm_loadu_si128(round_keys);
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      lanes[lane] =
+          _mm_xor_si128(_mm_loadu_si128(in_ptr + i + lane), round_key);
+    }
+    for (std::size_t round = 1; round < ctx.nr; ++round) {
+      round_key = _mm_loadu_si128(round_keys + round);
+      for (auto& lane : lanes) {
+        lane = _mm_aesenc_si128(lane, round_key);
+      }
+    }
+    round_key = _mm_loadu_si128(round_keys + ctx.nr);
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      _mm_storeu_si128(out_ptr + i + lane,
+                       _mm_aesenclast_si128(lanes[lane], round_key));
+    }
+  }
+
+  for (; i < block_count; ++i) {
+    __m128i state_128i =
+        _mm_xor_si128(_mm_loadu_si128(in_ptr + i), _mm_loadu_si128(round_keys));
+    for (std::size_t round = 1; round < ctx.nr; ++round) {
+      state_128i =
+          _mm_aesenc_si128(state_128i, _mm_loadu_si128(round_keys + round));
+    }
+    state_128i =
+        _mm_aesenclast_si128(state_128i, _mm_loadu_si128(round_keys + ctx.nr));
+    _mm_storeu_si128(out_ptr + i, state_128i);
+  }
+}
+
 static inline __m128i AESKeygenAssist(__m128i a, int imm) {
   // because api needs const numbers, not variables
   switch (imm) {
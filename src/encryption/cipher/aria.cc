@@ -0,0 +1,409 @@
+#include "encryption/cipher/aria.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "common/intrinsics.h"
+
+namespace bedrock::cipher {
+
+enum AriaIntrinSet { kAESNI, kSSSE3 };
+
+static bool IntrinEnabled(AriaIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 2> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AESNI"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSSE3")};
+
+  switch (target) {
+    case kAESNI:
+      return enabled[target];
+    case kSSSE3:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+using SBox = std::array<std::uint8_t, 256>;
+using Table = std::array<std::uint32_t, 256>;
+using Words = std::array<std::uint32_t, 4>;
+
+// SB1 = AES S-box, SB3 = AES 역 S-box, SB4 = SB2의 역
+static constexpr SBox kSb1 = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+    0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+    0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+    0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+    0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+    0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+    0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+    0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+    0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+    0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+    0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+    0xb0, 0x54, 0xbb, 0x16,
+};
+static constexpr SBox kSb2 = {
+    0xe2, 0x4e, 0x54, 0xfc, 0x94, 0xc2, 0x4a, 0xcc, 0x62, 0x0d, 0x6a, 0x46,
+    0x3c, 0x4d, 0x8b, 0xd1, 0x5e, 0xfa, 0x64, 0xcb, 0xb4, 0x97, 0xbe, 0x2b,
+    0xbc, 0x77, 0x2e, 0x03, 0xd3, 0x19, 0x59, 0xc1, 0x1d, 0x06, 0x41, 0x6b,
+    0x55, 0xf0, 0x99, 0x69, 0xea, 0x9c, 0x18, 0xae, 0x63, 0xdf, 0xe7, 0xbb,
+    0x00, 0x73, 0x66, 0xfb, 0x96, 0x4c, 0x85, 0xe4, 0x3a, 0x09, 0x45, 0xaa,
+    0x0f, 0xee, 0x10, 0xeb, 0x2d, 0x7f, 0xf4, 0x29, 0xac, 0xcf, 0xad, 0x91,
+    0x8d, 0x78, 0xc8, 0x95, 0xf9, 0x2f, 0xce, 0xcd, 0x08, 0x7a, 0x88, 0x38,
+    0x5c, 0x83, 0x2a, 0x28, 0x47, 0xdb, 0xb8, 0xc7, 0x93, 0xa4, 0x12, 0x53,
+    0xff, 0x87, 0x0e, 0x31, 0x36, 0x21, 0x58, 0x48, 0x01, 0x8e, 0x37, 0x74,
+    0x32, 0xca, 0xe9, 0xb1, 0xb7, 0xab, 0x0c, 0xd7, 0xc4, 0x56, 0x42, 0x26,
+    0x07, 0x98, 0x60, 0xd9, 0xb6, 0xb9, 0x11, 0x40, 0xec, 0x20, 0x8c, 0xbd,
+    0xa0, 0xc9, 0x84, 0x04, 0x49, 0x23, 0xf1, 0x4f, 0x50, 0x1f, 0x13, 0xdc,
+    0xd8, 0xc0, 0x9e, 0x57, 0xe3, 0xc3, 0x7b, 0x65, 0x3b, 0x02, 0x8f, 0x3e,
+    0xe8, 0x25, 0x92, 0xe5, 0x15, 0xdd, 0xfd, 0x17, 0xa9, 0xbf, 0xd4, 0x9a,
+    0x7e, 0xc5, 0x39, 0x67, 0xfe, 0x76, 0x9d, 0x43, 0xa7, 0xe1, 0xd0, 0xf5,
+    0x68, 0xf2, 0x1b, 0x34, 0x70, 0x05, 0xa3, 0x8a, 0xd5, 0x79, 0x86, 0xa8,
+    0x30, 0xc6, 0x51, 0x4b, 0x1e, 0xa6, 0x27, 0xf6, 0x35, 0xd2, 0x6e, 0x24,
+    0x16, 0x82, 0x5f, 0xda, 0xe6, 0x75, 0xa2, 0xef, 0x2c, 0xb2, 0x1c, 0x9f,
+    0x5d, 0x6f, 0x80, 0x0a, 0x72, 0x44, 0x9b, 0x6c, 0x90, 0x0b, 0x5b, 0x33,
+    0x7d, 0x5a, 0x52, 0xf3, 0x61, 0xa1, 0xf7, 0xb0, 0xd6, 0x3f, 0x7c, 0x6d,
+    0xed, 0x14, 0xe0, 0xa5, 0x3d, 0x22, 0xb3, 0xf8, 0x89, 0xde, 0x71, 0x1a,
+    0xaf, 0xba, 0xb5, 0x81,
+};
+static constexpr SBox kSb3 = {
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e,
+    0x81, 0xf3, 0xd7, 0xfb, 0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87,
+    0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb, 0x54, 0x7b, 0x94, 0x32,
+    0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49,
+    0x6d, 0x8b, 0xd1, 0x25, 0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16,
+    0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92, 0x6c, 0x70, 0x48, 0x50,
+    0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05,
+    0xb8, 0xb3, 0x45, 0x06, 0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02,
+    0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b, 0x3a, 0x91, 0x11, 0x41,
+    0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8,
+    0x1c, 0x75, 0xdf, 0x6e, 0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89,
+    0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b, 0xfc, 0x56, 0x3e, 0x4b,
+    0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59,
+    0x27, 0x80, 0xec, 0x5f, 0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d,
+    0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef, 0xa0, 0xe0, 0x3b, 0x4d,
+    0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63,
+    0x55, 0x21, 0x0c, 0x7d,
+};
+static constexpr SBox kSb4 = {
+    0x30, 0x68, 0x99, 0x1b, 0x87, 0xb9, 0x21, 0x78, 0x50, 0x39, 0xdb, 0xe1,
+    0x72, 0x09, 0x62, 0x3c, 0x3e, 0x7e, 0x5e, 0x8e, 0xf1, 0xa0, 0xcc, 0xa3,
+    0x2a, 0x1d, 0xfb, 0xb6, 0xd6, 0x20, 0xc4, 0x8d, 0x81, 0x65, 0xf5, 0x89,
+    0xcb, 0x9d, 0x77, 0xc6, 0x57, 0x43, 0x56, 0x17, 0xd4, 0x40, 0x1a, 0x4d,
+    0xc0, 0x63, 0x6c, 0xe3, 0xb7, 0xc8, 0x64, 0x6a, 0x53, 0xaa, 0x38, 0x98,
+    0x0c, 0xf4, 0x9b, 0xed, 0x7f, 0x22, 0x76, 0xaf, 0xdd, 0x3a, 0x0b, 0x58,
+    0x67, 0x88, 0x06, 0xc3, 0x35, 0x0d, 0x01, 0x8b, 0x8c, 0xc2, 0xe6, 0x5f,
+    0x02, 0x24, 0x75, 0x93, 0x66, 0x1e, 0xe5, 0xe2, 0x54, 0xd8, 0x10, 0xce,
+    0x7a, 0xe8, 0x08, 0x2c, 0x12, 0x97, 0x32, 0xab, 0xb4, 0x27, 0x0a, 0x23,
+    0xdf, 0xef, 0xca, 0xd9, 0xb8, 0xfa, 0xdc, 0x31, 0x6b, 0xd1, 0xad, 0x19,
+    0x49, 0xbd, 0x51, 0x96, 0xee, 0xe4, 0xa8, 0x41, 0xda, 0xff, 0xcd, 0x55,
+    0x86, 0x36, 0xbe, 0x61, 0x52, 0xf8, 0xbb, 0x0e, 0x82, 0x48, 0x69, 0x9a,
+    0xe0, 0x47, 0x9e, 0x5c, 0x04, 0x4b, 0x34, 0x15, 0x79, 0x26, 0xa7, 0xde,
+    0x29, 0xae, 0x92, 0xd7, 0x84, 0xe9, 0xd2, 0xba, 0x5d, 0xf3, 0xc5, 0xb0,
+    0xbf, 0xa4, 0x3b, 0x71, 0x44, 0x46, 0x2b, 0xfc, 0xeb, 0x6f, 0xd5, 0xf6,
+    0x14, 0xfe, 0x7c, 0x70, 0x5a, 0x7d, 0xfd, 0x2f, 0x18, 0x83, 0x16, 0xa5,
+    0x91, 0x1f, 0x05, 0x95, 0x74, 0xa9, 0xc1, 0x5b, 0x4a, 0x85, 0x6d, 0x13,
+    0x07, 0x4f, 0x4e, 0x45, 0xb2, 0x0f, 0xc9, 0x1c, 0xa6, 0xbc, 0xec, 0x73,
+    0x90, 0x7b, 0xcf, 0x59, 0x8f, 0xa1, 0xf9, 0x2d, 0xf2, 0xb1, 0x00, 0x94,
+    0x37, 0x9f, 0xd0, 0x2e, 0x9c, 0x6e, 0x28, 0x3f, 0x80, 0xf0, 0x3d, 0xd3,
+    0x25, 0x8a, 0xb5, 0xe7, 0x42, 0xb3, 0xc7, 0xea, 0xf7, 0x4c, 0x11, 0x33,
+    0x03, 0xa2, 0xac, 0x60,
+};
+
+// 32-bit 테이블: S-box 출력을 워드 안의 다른 세 바이트로 퍼뜨린 값
+// (확산 계층의 워드 내부 단계를 미리 적용)
+static constexpr Table MakeTable(const SBox& sbox, std::uint32_t spread) {
+  Table table{};
+  for (std::size_t i = 0; i < table.size(); ++i) {
+    table[i] = sbox[i] * spread;
+  }
+  return table;
+}
+
+static constexpr Table kS1 = MakeTable(kSb1, 0x00010101);
+static constexpr Table kS2 = MakeTable(kSb2, 0x01000101);
+static constexpr Table kX1 = MakeTable(kSb3, 0x01010001);
+static constexpr Table kX2 = MakeTable(kSb4, 0x01010100);
+
+// 키 스케줄 상수 CK1 ~ CK3
+static constexpr std::array<Words, 3> kConstants = {{
+    {0x517cc1b7, 0x27220a94, 0xfe13abe8, 0xfa9a6ee0},
+    {0x6db14acc, 0x9e21c820, 0xff28b1d5, 0xef5de2b0},
+    {0xdb92371d, 0x2126e970, 0x03249775, 0x04e8c90e},
+}};
+
+static constexpr std::uint32_t Rotr(std::uint32_t x, std::uint32_t n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+// 16-bit 단위로 바이트 교환
+static constexpr std::uint32_t SwapPairs(std::uint32_t x) {
+  return ((x << 8) & 0xff00ff00) | ((x >> 8) & 0x00ff00ff);
+}
+
+static constexpr std::uint8_t Byte(std::uint32_t x, std::uint32_t index) {
+  return static_cast<std::uint8_t>(x >> (24 - (8 * index)));
+}
+
+static inline Words Load(const std::uint8_t* bytes) {
+  Words words{};
+  std::memcpy(words.data(), bytes, 16);
+  if constexpr (std::endian::native == std::endian::little) {
+    for (auto& word : words) {
+      word = std::byteswap(word);
+    }
+  }
+  return words;
+}
+
+static inline void Store(Words words, std::uint8_t* bytes) {
+  if constexpr (std::endian::native == std::endian::little) {
+    for (auto& word : words) {
+      word = std::byteswap(word);
+    }
+  }
+  std::memcpy(bytes, words.data(), 16);
+}
+
+static inline void XorWords(Words& t, const Words& k) {
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    t[i] ^= k[i];
+  }
+}
+
+// 워드 간 확산: (a, b, c, d) -> (a^b^c, a^c^d, a^b^d, b^c^d)
+static inline void MixWords(Words& t) {
+  t[1] ^= t[2];
+  t[2] ^= t[3];
+  t[0] ^= t[1];
+  t[3] ^= t[1];
+  t[2] ^= t[0];
+  t[1] ^= t[2];
+}
+
+// 홀수 라운드: SL1 + A
+static inline void RoundOdd(Words& t) {
+  for (auto& word : t) {
+    word = kS1[Byte(word, 0)] ^ kS2[Byte(word, 1)] ^ kX1[Byte(word, 2)] ^
+           kX2[Byte(word, 3)];
+  }
+  MixWords(t);
+  t[1] = SwapPairs(t[1]);
+  t[2] = Rotr(t[2], 16);
+  t[3] = std::byteswap(t[3]);
+  MixWords(t);
+}
+
+// 짝수 라운드: SL2 + A
+static inline void RoundEven(Words& t) {
+  for (auto& word : t) {
+    word = kX1[Byte(word, 0)] ^ kX2[Byte(word, 1)] ^ kS1[Byte(word, 2)] ^
+           kS2[Byte(word, 3)];
+  }
+  MixWords(t);
+  t[3] = SwapPairs(t[3]);
+  t[0] = Rotr(t[0], 16);
+  t[1] = std::byteswap(t[1]);
+  MixWords(t);
+}
+
+// 확산 계층 A만 적용 (복호화 라운드 키 계산용)
+static void Diffuse(Words& t) {
+  for (auto& word : t) {
+    word = Rotr(word, 8) ^ Rotr(word, 16) ^ Rotr(word, 24);
+  }
+  MixWords(t);
+  t[1] = SwapPairs(t[1]);
+  t[2] = Rotr(t[2], 16);
+  t[3] = std::byteswap(t[3]);
+  MixWords(t);
+}
+
+// 128-bit 값 오른쪽 회전
+static Words RotateRight(const Words& x, std::uint32_t n) {
+  const std::uint32_t words = n / 32;
+  const std::uint32_t bits = n % 32;
+  Words out{};
+  for (std::uint32_t i = 0; i < 4; ++i) {
+    const std::uint32_t hi = x[(i + 4 - words) % 4];
+    const std::uint32_t lo = x[(i + 3 - words) % 4];
+    out[i] = bits == 0 ? hi : (hi >> bits) | (lo << (32 - bits));
+  }
+  return out;
+}
+
+namespace aria {
+
+void CryptBlocksTable(const std::uint8_t* round_keys, std::size_t nr,
+                      const std::uint8_t* in, std::uint8_t* out,
+                      std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    Words t = Load(in + (block * 16));
+
+    for (std::size_t round = 0; round + 1 < nr; ++round) {
+      XorWords(t, Load(round_keys + (round * 16)));
+      if (round % 2 == 0) {
+        RoundOdd(t);
+      } else {
+        RoundEven(t);
+      }
+    }
+
+    // 마지막 라운드: SL2 후 키 덧셈 (확산 없음)
+    XorWords(t, Load(round_keys + ((nr - 1) * 16)));
+    for (auto& word : t) {
+      word = (static_cast<std::uint32_t>(kSb3[Byte(word, 0)]) << 24) |
+             (static_cast<std::uint32_t>(kSb4[Byte(word, 1)]) << 16) |
+             (static_cast<std::uint32_t>(kSb1[Byte(word, 2)]) << 8) |
+             static_cast<std::uint32_t>(kSb2[Byte(word, 3)]);
+    }
+    XorWords(t, Load(round_keys + (nr * 16)));
+
+    Store(t, out + (block * 16));
+  }
+}
+
+}  // namespace aria
+
+static const std::uint8_t* RoundKeys(
+    const std::vector<std::array<std::uint8_t, 16>>& round_keys) {
+  return round_keys.data()->data();
+}
+
+Aria::Aria() {
+  if (IntrinEnabled(kAESNI) && IntrinEnabled(kSSSE3)) {
+    crypt_blocks_ = aria::CryptBlocksAesNi;
+  } else {
+    crypt_blocks_ = aria::CryptBlocksTable;
+  }
+}
+
+Aria::~Aria() noexcept = default;
+
+ErrorStatus Aria::KeyExpantion(std::span<const std::uint8_t> key,
+                               BlockCipherCTX& ctx) const noexcept {
+  if (key.size() != 16 && key.size() != 24 && key.size() != 32) {
+    return ErrorStatus::kFailure;
+  }
+
+  // 라운드 수: 12 / 14 / 16
+  const std::size_t nr = (key.size() / 4) + 8;
+  const std::size_t first = (key.size() - 16) / 8;
+
+  std::array<std::uint8_t, 32> key_bytes{};
+  std::ranges::copy(key, key_bytes.begin());
+  const Words kl = Load(key_bytes.data());
+  const Words kr = Load(key_bytes.data() + 16);
+
+  // W0 = KL, W1 = FO(W0, CK1) ^ KR, W2 = FE(W1, CK2) ^ W0,
+  // W3 = FO(W2, CK3) ^ W1
+  std::array<Words, 4> w{};
+  w[0] = kl;
+  for (std::size_t i = 1; i < 4; ++i) {
+    w[i] = w[i - 1];
+    XorWords(w[i], kConstants[(first + i - 1) % 3]);
+    if (i == 2) {
+      RoundEven(w[i]);
+    } else {
+      RoundOdd(w[i]);
+    }
+    XorWords(w[i], i == 1 ? kr : w[i - 2]);
+  }
+
+  // ek[4g + j] = W[j] ^ (W[j+1] >>> 회전량[g])
+  constexpr std::array<std::uint32_t, 5> kRotations = {19, 31, 128 - 61,
+                                                       128 - 31, 128 - 19};
+  std::array<Words, 17> enc{};
+  for (std::size_t i = 0; i <= nr; ++i) {
+    enc[i] = w[i % 4];
+    XorWords(enc[i], RotateRight(w[(i + 1) % 4], kRotations[i / 4]));
+  }
+
+  ctx.enc_round_keys.resize(nr + 1);
+  ctx.dec_round_keys.resize(nr + 1);
+  for (std::size_t i = 0; i <= nr; ++i) {
+    Words dec = enc[nr - i];
+    if (i != 0 && i != nr) {
+      Diffuse(dec);
+    }
+    Store(enc[i], ctx.enc_round_keys[i].data());
+    Store(dec, ctx.dec_round_keys[i].data());
+  }
+  ctx.nr = nr;
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Aria::Encrypt(BlockCipherCTX& ctx,
+                          std::span<const std::uint8_t> block,
+                          std::span<std::uint8_t> out) const noexcept {
+  if (!ctx.IsValid() || block.size() != 16 || out.size() < 16) {
+    return ErrorStatus::kFailure;
+  }
+
+  aria::CryptBlocksTable(RoundKeys(ctx.enc_round_keys), ctx.nr, block.data(),
+                         out.data(), 1);
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Aria::Decrypt(BlockCipherCTX& ctx,
+                          std::span<const std::uint8_t> block,
+                          std::span<std::uint8_t> out) const noexcept {
+  if (!ctx.IsValid() || block.size() != 16 || out.size() < 16) {
+    return ErrorStatus::kFailure;
+  }
+
+  aria::CryptBlocksTable(RoundKeys(ctx.dec_round_keys), ctx.nr, block.data(),
+                         out.data(), 1);
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Aria::EncryptBlocks(BlockCipherCTX& ctx,
+                                std::span<const std::uint8_t> blocks,
+                                std::span<std::uint8_t> out) const noexcept {
+  if (!ctx.IsValid() || blocks.size() % 16 != 0 || out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  crypt_blocks_(RoundKeys(ctx.enc_round_keys), ctx.nr, blocks.data(),
+                out.data(), blocks.size() / 16);
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Aria::DecryptBlocks(BlockCipherCTX& ctx,
+                                std::span<const std::uint8_t> blocks,
+                                std::span<std::uint8_t> out) const noexcept {
+  if (!ctx.IsValid() || blocks.size() % 16 != 0 || out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  crypt_blocks_(RoundKeys(ctx.dec_round_keys), ctx.nr, blocks.data(),
+                out.data(), blocks.size() / 16);
+
+  return ErrorStatus::kSuccess;
+}
+
+}  // namespace bedrock::cipher
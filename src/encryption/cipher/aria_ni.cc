@@ -0,0 +1,169 @@
+#include <emmintrin.h>
+#include <immintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#include "encryption/cipher/aria.h"
+
+namespace bedrock::cipher::aria {
+
+// SB1(x) = S(x), SB2(x) = M2(S(x)), SB3(x) = S^-1(x), SB4(x) = S^-1(M4(x))
+// (S = AES S-box, M2 / M4 = GF(2) 아핀 변환, 니블 테이블 두 개로 pshufb 계산)
+// S와 S^-1은 ShiftRows를 미리 되돌린 뒤 aesenclast / aesdeclast(키 0)로 구함
+struct Constants {
+  __m128i shift_rows;
+  __m128i inv_shift_rows;
+  __m128i low_nibble;
+  __m128i m2_lo;
+  __m128i m2_hi;
+  __m128i m4_lo;
+  __m128i m4_hi;
+  // 바이트 위치(i mod 4)별 선택 마스크. forward = SB1/SB2 자리
+  __m128i odd_forward;
+  __m128i odd_m2;
+  __m128i odd_m4;
+  __m128i even_forward;
+  __m128i even_m2;
+  __m128i even_m4;
+  // 확산 계층 A = 바이트 치환 7개의 XOR
+  __m128i diffusion[7];
+};
+
+static Constants MakeConstants() {
+  Constants c{};
+  c.shift_rows =
+      _mm_setr_epi8(0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11);
+  c.inv_shift_rows =
+      _mm_setr_epi8(0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3);
+  c.low_nibble = _mm_set1_epi8(0x0f);
+  c.m2_lo = _mm_setr_epi8(
+      static_cast<char>(0x88), 0x0d, 0x37, static_cast<char>(0xb2), 0x00,
+      static_cast<char>(0x85), static_cast<char>(0xbf), 0x3a,
+      static_cast<char>(0xa8), 0x2d, 0x17, static_cast<char>(0x92), 0x20,
+      static_cast<char>(0xa5), static_cast<char>(0x9f), 0x1a);
+  c.m2_hi = _mm_setr_epi8(
+      0x00, 0x3e, static_cast<char>(0xd4), static_cast<char>(0xea),
+      static_cast<char>(0x84), static_cast<char>(0xba), 0x50, 0x6e,
+      static_cast<char>(0xcd), static_cast<char>(0xf3), 0x19, 0x27, 0x49, 0x77,
+      static_cast<char>(0x9d), static_cast<char>(0xa3));
+  c.m4_lo = _mm_setr_epi8(
+      0x04, 0x45, static_cast<char>(0xee), static_cast<char>(0xaf), 0x17, 0x56,
+      static_cast<char>(0xfd), static_cast<char>(0xbc), 0x53, 0x12,
+      static_cast<char>(0xb9), static_cast<char>(0xf8), 0x40, 0x01,
+      static_cast<char>(0xaa), static_cast<char>(0xeb));
+  c.m4_hi = _mm_setr_epi8(
+      0x00, static_cast<char>(0xb6), 0x08, static_cast<char>(0xbe),
+      static_cast<char>(0xd6), 0x60, static_cast<char>(0xde), 0x68, 0x53,
+      static_cast<char>(0xe5), 0x5b, static_cast<char>(0xed),
+      static_cast<char>(0x85), 0x33, static_cast<char>(0x8d), 0x3b);
+
+  // SL1: SB1 SB2 SB3 SB4, SL2: SB3 SB4 SB1 SB2
+  c.odd_forward = _mm_set1_epi32(0x0000ffff);
+  c.odd_m2 = _mm_set1_epi32(0x0000ff00);
+  c.odd_m4 = _mm_set1_epi32(static_cast<int>(0xff000000));
+  c.even_forward = _mm_set1_epi32(static_cast<int>(0xffff0000));
+  c.even_m2 = _mm_set1_epi32(static_cast<int>(0xff000000));
+  c.even_m4 = _mm_set1_epi32(0x0000ff00);
+
+  c.diffusion[0] =
+      _mm_setr_epi8(8, 7, 4, 11, 14, 10, 9, 13, 15, 6, 3, 2, 12, 0, 5, 1);
+  c.diffusion[1] =
+      _mm_setr_epi8(14, 12, 10, 7, 15, 1, 0, 11, 4, 5, 13, 9, 6, 8, 3, 2);
+  c.diffusion[2] =
+      _mm_setr_epi8(3, 5, 11, 10, 0, 15, 7, 1, 13, 14, 8, 12, 2, 6, 9, 4);
+  c.diffusion[3] =
+      _mm_setr_epi8(13, 9, 1, 0, 8, 14, 2, 6, 7, 12, 15, 3, 11, 10, 4, 5);
+  c.diffusion[4] =
+      _mm_setr_epi8(6, 2, 15, 13, 11, 9, 10, 12, 1, 0, 5, 4, 7, 3, 14, 8);
+  c.diffusion[5] =
+      _mm_setr_epi8(4, 15, 12, 5, 2, 3, 13, 8, 0, 1, 6, 14, 9, 7, 11, 10);
+  c.diffusion[6] =
+      _mm_setr_epi8(9, 8, 6, 14, 5, 4, 12, 3, 10, 11, 2, 7, 1, 13, 0, 15);
+  return c;
+}
+
+static inline __m128i Affine(__m128i x, __m128i lo, __m128i hi,
+                             __m128i low_nibble) {
+  const __m128i low = _mm_and_si128(x, low_nibble);
+  const __m128i high = _mm_and_si128(_mm_srli_epi16(x, 4), low_nibble);
+  return _mm_xor_si128(_mm_shuffle_epi8(lo, low), _mm_shuffle_epi8(hi, high));
+}
+
+// mask 바이트가 0xff인 자리는 a, 나머지는 b
+static inline __m128i Select(__m128i mask, __m128i a, __m128i b) {
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static inline __m128i Substitute(const Constants& c, __m128i x,
+                                 __m128i forward, __m128i m2, __m128i m4) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i s = _mm_aesenclast_si128(_mm_shuffle_epi8(x, c.inv_shift_rows), zero);
+  s = Select(m2, Affine(s, c.m2_lo, c.m2_hi, c.low_nibble), s);
+
+  const __m128i u =
+      Select(m4, Affine(x, c.m4_lo, c.m4_hi, c.low_nibble), x);
+  const __m128i v =
+      _mm_aesdeclast_si128(_mm_shuffle_epi8(u, c.shift_rows), zero);
+
+  return Select(forward, s, v);
+}
+
+static inline __m128i Diffuse(const Constants& c, __m128i x) {
+  __m128i y = _mm_shuffle_epi8(x, c.diffusion[0]);
+  for (std::size_t i = 1; i < 7; ++i) {
+    y = _mm_xor_si128(y, _mm_shuffle_epi8(x, c.diffusion[i]));
+  }
+  return y;
+}
+
+template <std::size_t kLanes>
+static inline void CryptLanes(const Constants& c, const __m128i* rk,
+                              std::size_t nr, const std::uint8_t* in,
+                              std::uint8_t* out) {
+  const auto* in_ptr = reinterpret_cast<const __m128i*>(in);
+  auto* out_ptr = reinterpret_cast<__m128i*>(out);
+  __m128i x[kLanes];
+  for (std::size_t i = 0; i < kLanes; ++i) {
+    x[i] = _mm_loadu_si128(in_ptr + i);
+  }
+
+  for (std::size_t round = 0; round + 1 < nr; ++round) {
+    const __m128i key = _mm_loadu_si128(rk + round);
+    const bool odd = round % 2 == 0;
+    const __m128i forward = odd ? c.odd_forward : c.even_forward;
+    const __m128i m2 = odd ? c.odd_m2 : c.even_m2;
+    const __m128i m4 = odd ? c.odd_m4 : c.even_m4;
+    for (auto& lane : x) {
+      lane = Diffuse(
+          c, Substitute(c, _mm_xor_si128(lane, key), forward, m2, m4));
+    }
+  }
+
+  // 마지막 라운드: SL2 후 키 덧셈 (확산 없음)
+  const __m128i key = _mm_loadu_si128(rk + nr - 1);
+  const __m128i last = _mm_loadu_si128(rk + nr);
+  for (std::size_t i = 0; i < kLanes; ++i) {
+    const __m128i y = Substitute(c, _mm_xor_si128(x[i], key), c.even_forward,
+                                 c.even_m2, c.even_m4);
+    _mm_storeu_si128(out_ptr + i, _mm_xor_si128(y, last));
+  }
+}
+
+void CryptBlocksAesNi(const std::uint8_t* round_keys, std::size_t nr,
+                      const std::uint8_t* in, std::uint8_t* out,
+                      std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 4;
+  // 호출마다 다시 만들지 않도록 처음 한 번만 계산
+  static const Constants c = MakeConstants();
+  const auto* rk = reinterpret_cast<const __m128i*>(round_keys);
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    CryptLanes<kLanes>(c, rk, nr, in + (block * 16), out + (block * 16));
+  }
+  for (; block < blocks; ++block) {
+    CryptLanes<1>(c, rk, nr, in + (block * 16), out + (block * 16));
+  }
+}
+
+}  // namespace bedrock::cipher::aria
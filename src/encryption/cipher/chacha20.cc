@@ -0,0 +1,282 @@
+#include "encryption/cipher/chacha20.h"
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/intrinsics.h"
+
+namespace bedrock::cipher {
+
+enum ChaCha20IntrinSet { kSSSE3, kAVX2, kAVX512F };
+
+static bool IntrinEnabled(ChaCha20IntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 3> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSSE3"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX512F")};
+
+  switch (target) {
+    case kSSSE3:
+      return enabled[target];
+    case kAVX2:
+      return enabled[target];
+    case kAVX512F:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+// "expand 32-byte k"
+static constexpr std::array<std::uint32_t, 4> kSigma = {
+    0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+
+// 32-bit 블록 카운터로 셀 수 있는 블록 수
+static constexpr std::uint64_t kCounterSpace = std::uint64_t{1} << 32;
+
+static constexpr std::uint32_t Rotl(std::uint32_t x, int n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+static constexpr void QuarterRound(std::uint32_t& a, std::uint32_t& b,
+                                   std::uint32_t& c, std::uint32_t& d) {
+  a += b;
+  d = Rotl(d ^ a, 16);
+  c += d;
+  b = Rotl(b ^ c, 12);
+  a += b;
+  d = Rotl(d ^ a, 8);
+  c += d;
+  b = Rotl(b ^ c, 7);
+}
+
+static std::uint32_t LoadLittleEndian32(const std::uint8_t* p) {
+  return static_cast<std::uint32_t>(p[0]) |
+         (static_cast<std::uint32_t>(p[1]) << 8) |
+         (static_cast<std::uint32_t>(p[2]) << 16) |
+         (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+namespace chacha20 {
+
+void XorBlocksScalar(const std::uint32_t* state, const std::uint8_t* in,
+                     std::uint8_t* out, std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    std::array<std::uint32_t, 16> input{};
+    std::copy_n(state, 16, input.begin());
+    input[12] += static_cast<std::uint32_t>(block);
+
+    std::array<std::uint32_t, 16> x = input;
+    for (int i = 0; i < 10; ++i) {
+      QuarterRound(x[0], x[4], x[8], x[12]);
+      QuarterRound(x[1], x[5], x[9], x[13]);
+      QuarterRound(x[2], x[6], x[10], x[14]);
+      QuarterRound(x[3], x[7], x[11], x[15]);
+      QuarterRound(x[0], x[5], x[10], x[15]);
+      QuarterRound(x[1], x[6], x[11], x[12]);
+      QuarterRound(x[2], x[7], x[8], x[13]);
+      QuarterRound(x[3], x[4], x[9], x[14]);
+    }
+
+    for (std::size_t i = 0; i < 16; ++i) {
+      const std::uint32_t word = x[i] + input[i];
+      for (std::size_t j = 0; j < 4; ++j) {
+        const std::size_t pos = (block * 64) + (i * 4) + j;
+        out[pos] = static_cast<std::uint8_t>(in[pos] ^ (word >> (j * 8)));
+      }
+    }
+  }
+}
+
+static inline __m128i Rotl16(__m128i x) {
+  return _mm_shuffle_epi8(
+      x, _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+}
+static inline __m128i Rotl8(__m128i x) {
+  return _mm_shuffle_epi8(
+      x, _mm_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14));
+}
+static inline __m128i Rotl12(__m128i x) {
+  return _mm_or_si128(_mm_slli_epi32(x, 12), _mm_srli_epi32(x, 20));
+}
+static inline __m128i Rotl7(__m128i x) {
+  return _mm_or_si128(_mm_slli_epi32(x, 7), _mm_srli_epi32(x, 25));
+}
+
+static inline void QuarterRound(__m128i& a, __m128i& b, __m128i& c,
+                                __m128i& d) {
+  a = _mm_add_epi32(a, b);
+  d = Rotl16(_mm_xor_si128(d, a));
+  c = _mm_add_epi32(c, d);
+  b = Rotl12(_mm_xor_si128(b, c));
+  a = _mm_add_epi32(a, b);
+  d = Rotl8(_mm_xor_si128(d, a));
+  c = _mm_add_epi32(c, d);
+  b = Rotl7(_mm_xor_si128(b, c));
+}
+
+// 레지스터 i = 4개 블록의 i번째 워드. 블록 간에 의존성이 없어 그대로 병렬 처리
+void XorBlocksSsse3(const std::uint32_t* state, const std::uint8_t* in,
+                    std::uint8_t* out, std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 4;
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m128i input[16];
+    for (std::size_t i = 0; i < 16; ++i) {
+      input[i] = _mm_set1_epi32(static_cast<int>(state[i]));
+    }
+    input[12] = _mm_add_epi32(
+        input[12],
+        _mm_add_epi32(_mm_set1_epi32(static_cast<int>(block)),
+                      _mm_setr_epi32(0, 1, 2, 3)));
+
+    __m128i x[16];
+    std::copy_n(input, 16, x);
+    for (int i = 0; i < 10; ++i) {
+      QuarterRound(x[0], x[4], x[8], x[12]);
+      QuarterRound(x[1], x[5], x[9], x[13]);
+      QuarterRound(x[2], x[6], x[10], x[14]);
+      QuarterRound(x[3], x[7], x[11], x[15]);
+      QuarterRound(x[0], x[5], x[10], x[15]);
+      QuarterRound(x[1], x[6], x[11], x[12]);
+      QuarterRound(x[2], x[7], x[8], x[13]);
+      QuarterRound(x[3], x[4], x[9], x[14]);
+    }
+    for (std::size_t i = 0; i < 16; ++i) {
+      x[i] = _mm_add_epi32(x[i], input[i]);
+    }
+
+    // 워드 4개 묶음마다 4x4 전치하여 블록별 16바이트 조각으로 만듦
+    for (std::size_t group = 0; group < 4; ++group) {
+      const __m128i t0 = _mm_unpacklo_epi32(x[group * 4], x[(group * 4) + 1]);
+      const __m128i t1 =
+          _mm_unpacklo_epi32(x[(group * 4) + 2], x[(group * 4) + 3]);
+      const __m128i t2 = _mm_unpackhi_epi32(x[group * 4], x[(group * 4) + 1]);
+      const __m128i t3 =
+          _mm_unpackhi_epi32(x[(group * 4) + 2], x[(group * 4) + 3]);
+      const __m128i rows[4] = {
+          _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+          _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3)};
+
+      for (std::size_t lane = 0; lane < kLanes; ++lane) {
+        const std::size_t offset = ((block + lane) * 64) + (group * 16);
+        const __m128i data =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + offset),
+                         _mm_xor_si128(data, rows[lane]));
+      }
+    }
+  }
+
+  if (block < blocks) {
+    std::array<std::uint32_t, 16> rest{};
+    std::copy_n(state, 16, rest.begin());
+    rest[12] += static_cast<std::uint32_t>(block);
+    XorBlocksScalar(rest.data(), in + (block * 64), out + (block * 64),
+                    blocks - block);
+  }
+}
+
+}  // namespace chacha20
+
+ChaCha20::ChaCha20() {
+  if (IntrinEnabled(kAVX512F) && IntrinEnabled(kAVX2)) {
+    xor_blocks_ = chacha20::XorBlocksAvx512;
+  } else if (IntrinEnabled(kAVX2)) {
+    xor_blocks_ = chacha20::XorBlocksAvx2;
+  } else if (IntrinEnabled(kSSSE3)) {
+    xor_blocks_ = chacha20::XorBlocksSsse3;
+  } else {
+    xor_blocks_ = chacha20::XorBlocksScalar;
+  }
+}
+
+ErrorStatus ChaCha20::SetKey(std::span<const std::uint8_t> key,
+                             std::span<const std::uint8_t> nonce,
+                             std::uint32_t counter) noexcept {
+  if (key.size() != kKeyBytes || nonce.size() != kNonceBytes) {
+    valid_ = false;
+    return ErrorStatus::kFailure;
+  }
+
+  std::ranges::copy(kSigma, state_.begin());
+  for (std::size_t i = 0; i < 8; ++i) {
+    state_[4 + i] = LoadLittleEndian32(key.data() + (i * 4));
+  }
+  state_[12] = counter;
+  blocks_left_ = kCounterSpace - counter;
+  for (std::size_t i = 0; i < 3; ++i) {
+    state_[13 + i] = LoadLittleEndian32(nonce.data() + (i * 4));
+  }
+  keystream_pos_ = kBlockBytes;
+  valid_ = true;
+
+  return ErrorStatus::kSuccess;
+}
+
+void ChaCha20::Seek(std::uint32_t counter) noexcept {
+  state_[12] = counter;
+  blocks_left_ = kCounterSpace - counter;
+  keystream_pos_ = kBlockBytes;
+}
+
+void ChaCha20::KeystreamBlock(
+    std::uint32_t counter,
+    std::span<std::uint8_t, kBlockBytes> out) const noexcept {
+  std::array<std::uint32_t, 16> state = state_;
+  state[12] = counter;
+  const std::array<std::uint8_t, kBlockBytes> zero{};
+  chacha20::XorBlocksScalar(state.data(), zero.data(), out.data(), 1);
+}
+
+ErrorStatus ChaCha20::Process(std::span<const std::uint8_t> input,
+                              std::span<std::uint8_t> output) noexcept {
+  if (!valid_ || output.size() != input.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  // 남은 키스트림 뒤에 필요한 블록 수가 카운터 공간을 넘으면 거부
+  const std::size_t buffered =
+      std::min(input.size(), kBlockBytes - keystream_pos_);
+  const std::uint64_t needed =
+      ((input.size() - buffered) + kBlockBytes - 1) / kBlockBytes;
+  if (needed > blocks_left_) {
+    return ErrorStatus::kFailure;
+  }
+  blocks_left_ -= needed;
+
+  std::size_t offset = 0;
+
+  // 이전 호출에서 남은 키스트림부터 사용
+  for (; offset < input.size() && keystream_pos_ < kBlockBytes; ++offset) {
+    output[offset] =
+        static_cast<std::uint8_t>(input[offset] ^ keystream_[keystream_pos_++]);
+  }
+
+  const std::size_t blocks = (input.size() - offset) / kBlockBytes;
+  if (blocks != 0) {
+    xor_blocks_(state_.data(), input.data() + offset, output.data() + offset,
+                blocks);
+    state_[12] += static_cast<std::uint32_t>(blocks);
+    offset += blocks * kBlockBytes;
+  }
+
+  if (offset < input.size()) {
+    KeystreamBlock(state_[12]++, keystream_);
+    for (keystream_pos_ = 0; offset < input.size(); ++offset) {
+      output[offset] = static_cast<std::uint8_t>(input[offset] ^
+                                                 keystream_[keystream_pos_++]);
+    }
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,121 @@
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+
+#include "encryption/cipher/chacha20.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::cipher::chacha20 {
+
+static inline __m256i Rotl16(__m256i x) {
+  return _mm256_shuffle_epi8(
+      x, _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12,
+                          13));
+}
+static inline __m256i Rotl8(__m256i x) {
+  return _mm256_shuffle_epi8(
+      x, _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+                          3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13,
+                          14));
+}
+static inline __m256i Rotl12(__m256i x) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, 12), _mm256_srli_epi32(x, 20));
+}
+static inline __m256i Rotl7(__m256i x) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, 7), _mm256_srli_epi32(x, 25));
+}
+
+static inline void QuarterRound(__m256i& a, __m256i& b, __m256i& c,
+                                __m256i& d) {
+  a = _mm256_add_epi32(a, b);
+  d = Rotl16(_mm256_xor_si256(d, a));
+  c = _mm256_add_epi32(c, d);
+  b = Rotl12(_mm256_xor_si256(b, c));
+  a = _mm256_add_epi32(a, b);
+  d = Rotl8(_mm256_xor_si256(d, a));
+  c = _mm256_add_epi32(c, d);
+  b = Rotl7(_mm256_xor_si256(b, c));
+}
+
+static inline void XorStore(const std::uint8_t* in, std::uint8_t* out,
+                            __m256i keystream) {
+  const __m256i data =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                      _mm256_xor_si256(data, keystream));
+}
+
+void XorBlocksAvx2(const std::uint32_t* state, const std::uint8_t* in,
+                   std::uint8_t* out, std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 8;
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m256i input[16];
+    for (std::size_t i = 0; i < 16; ++i) {
+      input[i] = _mm256_set1_epi32(static_cast<int>(state[i]));
+    }
+    input[12] = _mm256_add_epi32(
+        input[12], _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(block)),
+                                    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+
+    __m256i x[16];
+    std::copy_n(input, 16, x);
+    for (int i = 0; i < 10; ++i) {
+      QuarterRound(x[0], x[4], x[8], x[12]);
+      QuarterRound(x[1], x[5], x[9], x[13]);
+      QuarterRound(x[2], x[6], x[10], x[14]);
+      QuarterRound(x[3], x[7], x[11], x[15]);
+      QuarterRound(x[0], x[5], x[10], x[15]);
+      QuarterRound(x[1], x[6], x[11], x[12]);
+      QuarterRound(x[2], x[7], x[8], x[13]);
+      QuarterRound(x[3], x[4], x[9], x[14]);
+    }
+    for (std::size_t i = 0; i < 16; ++i) {
+      x[i] = _mm256_add_epi32(x[i], input[i]);
+    }
+
+    // 128-bit 레인 안에서 4x4 전치하면 rows[group][k] = [블록 k | 블록 k+4]의
+    // 워드 4*group ~ 4*group+3
+    __m256i rows[4][4];
+    for (std::size_t group = 0; group < 4; ++group) {
+      const __m256i t0 =
+          _mm256_unpacklo_epi32(x[group * 4], x[(group * 4) + 1]);
+      const __m256i t1 =
+          _mm256_unpacklo_epi32(x[(group * 4) + 2], x[(group * 4) + 3]);
+      const __m256i t2 =
+          _mm256_unpackhi_epi32(x[group * 4], x[(group * 4) + 1]);
+      const __m256i t3 =
+          _mm256_unpackhi_epi32(x[(group * 4) + 2], x[(group * 4) + 3]);
+      rows[group][0] = _mm256_unpacklo_epi64(t0, t1);
+      rows[group][1] = _mm256_unpackhi_epi64(t0, t1);
+      rows[group][2] = _mm256_unpacklo_epi64(t2, t3);
+      rows[group][3] = _mm256_unpackhi_epi64(t2, t3);
+    }
+
+    for (std::size_t k = 0; k < 4; ++k) {
+      const std::size_t low = (block + k) * 64;
+      const std::size_t high = (block + k + 4) * 64;
+      XorStore(in + low, out + low,
+               _mm256_permute2x128_si256(rows[0][k], rows[1][k], 0x20));
+      XorStore(in + low + 32, out + low + 32,
+               _mm256_permute2x128_si256(rows[2][k], rows[3][k], 0x20));
+      XorStore(in + high, out + high,
+               _mm256_permute2x128_si256(rows[0][k], rows[1][k], 0x31));
+      XorStore(in + high + 32, out + high + 32,
+               _mm256_permute2x128_si256(rows[2][k], rows[3][k], 0x31));
+    }
+  }
+
+  if (block < blocks) {
+    std::array<std::uint32_t, 16> rest{};
+    std::copy_n(state, 16, rest.begin());
+    rest[12] += static_cast<std::uint32_t>(block);
+    XorBlocksSsse3(rest.data(), in + (block * 64), out + (block * 64),
+                   blocks - block);
+  }
+}
+
+}  // namespace bedrock::cipher::chacha20
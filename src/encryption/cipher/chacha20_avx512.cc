@@ -0,0 +1,102 @@
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+
+#include "encryption/cipher/chacha20.h"
+
+// 이 파일만 -mavx512f로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::cipher::chacha20 {
+
+static inline void QuarterRound(__m512i& a, __m512i& b, __m512i& c,
+                                __m512i& d) {
+  a = _mm512_add_epi32(a, b);
+  d = _mm512_rol_epi32(_mm512_xor_si512(d, a), 16);
+  c = _mm512_add_epi32(c, d);
+  b = _mm512_rol_epi32(_mm512_xor_si512(b, c), 12);
+  a = _mm512_add_epi32(a, b);
+  d = _mm512_rol_epi32(_mm512_xor_si512(d, a), 8);
+  c = _mm512_add_epi32(c, d);
+  b = _mm512_rol_epi32(_mm512_xor_si512(b, c), 7);
+}
+
+void XorBlocksAvx512(const std::uint32_t* state, const std::uint8_t* in,
+                     std::uint8_t* out, std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 16;
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m512i input[16];
+    for (std::size_t i = 0; i < 16; ++i) {
+      input[i] = _mm512_set1_epi32(static_cast<int>(state[i]));
+    }
+    input[12] = _mm512_add_epi32(
+        input[12],
+        _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(block)),
+                         _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                           11, 12, 13, 14, 15)));
+
+    __m512i x[16];
+    std::copy_n(input, 16, x);
+    for (int i = 0; i < 10; ++i) {
+      QuarterRound(x[0], x[4], x[8], x[12]);
+      QuarterRound(x[1], x[5], x[9], x[13]);
+      QuarterRound(x[2], x[6], x[10], x[14]);
+      QuarterRound(x[3], x[7], x[11], x[15]);
+      QuarterRound(x[0], x[5], x[10], x[15]);
+      QuarterRound(x[1], x[6], x[11], x[12]);
+      QuarterRound(x[2], x[7], x[8], x[13]);
+      QuarterRound(x[3], x[4], x[9], x[14]);
+    }
+    for (std::size_t i = 0; i < 16; ++i) {
+      x[i] = _mm512_add_epi32(x[i], input[i]);
+    }
+
+    // 128-bit 레인 안에서 4x4 전치하면 rows[group][k]의 레인 l은
+    // 블록 k+4l의 워드 4*group ~ 4*group+3
+    __m512i rows[4][4];
+    for (std::size_t group = 0; group < 4; ++group) {
+      const __m512i t0 =
+          _mm512_unpacklo_epi32(x[group * 4], x[(group * 4) + 1]);
+      const __m512i t1 =
+          _mm512_unpacklo_epi32(x[(group * 4) + 2], x[(group * 4) + 3]);
+      const __m512i t2 =
+          _mm512_unpackhi_epi32(x[group * 4], x[(group * 4) + 1]);
+      const __m512i t3 =
+          _mm512_unpackhi_epi32(x[(group * 4) + 2], x[(group * 4) + 3]);
+      rows[group][0] = _mm512_unpacklo_epi64(t0, t1);
+      rows[group][1] = _mm512_unpackhi_epi64(t0, t1);
+      rows[group][2] = _mm512_unpacklo_epi64(t2, t3);
+      rows[group][3] = _mm512_unpackhi_epi64(t2, t3);
+    }
+
+    // 레인 단위 4x4 전치로 블록 하나(64바이트)씩 모음
+    for (std::size_t k = 0; k < 4; ++k) {
+      const __m512i a0 = _mm512_shuffle_i32x4(rows[0][k], rows[1][k], 0x44);
+      const __m512i a1 = _mm512_shuffle_i32x4(rows[0][k], rows[1][k], 0xEE);
+      const __m512i b0 = _mm512_shuffle_i32x4(rows[2][k], rows[3][k], 0x44);
+      const __m512i b1 = _mm512_shuffle_i32x4(rows[2][k], rows[3][k], 0xEE);
+      const __m512i keystream[4] = {_mm512_shuffle_i32x4(a0, b0, 0x88),
+                                    _mm512_shuffle_i32x4(a0, b0, 0xDD),
+                                    _mm512_shuffle_i32x4(a1, b1, 0x88),
+                                    _mm512_shuffle_i32x4(a1, b1, 0xDD)};
+
+      for (std::size_t lane = 0; lane < 4; ++lane) {
+        const std::size_t offset = (block + k + (lane * 4)) * 64;
+        const __m512i data = _mm512_loadu_si512(in + offset);
+        _mm512_storeu_si512(out + offset,
+                            _mm512_xor_si512(data, keystream[lane]));
+      }
+    }
+  }
+
+  if (block < blocks) {
+    std::array<std::uint32_t, 16> rest{};
+    std::copy_n(state, 16, rest.begin());
+    rest[12] += static_cast<std::uint32_t>(block);
+    XorBlocksAvx2(rest.data(), in + (block * 64), out + (block * 64),
+                  blocks - block);
+  }
+}
+
+}  // namespace bedrock::cipher::chacha20
@@ -0,0 +1,324 @@
+#include "encryption/cipher/lea.h"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/intrinsics.h"
+
+namespace bedrock::cipher {
+
+enum LeaIntrinSet { kSSE2, kAVX2 };
+
+static bool IntrinEnabled(LeaIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 2> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSE2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kSSE2:
+      return enabled[target];
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+static constexpr std::array<std::uint32_t, 8> kDelta = {
+    0xc3efe9db, 0x44626b02, 0x79e27c8a, 0x78df30ec,
+    0x715ea49e, 0xc785da0a, 0xe04ef22a, 0xe5c40957};
+
+static constexpr std::uint32_t Rotl(std::uint32_t x, std::uint32_t n) {
+  n &= 31U;
+  return n == 0 ? x : (x << n) | (x >> (32 - n));
+}
+static constexpr std::uint32_t Rotr(std::uint32_t x, std::uint32_t n) {
+  return Rotl(x, 32 - (n & 31U));
+}
+
+namespace lea {
+
+void EncryptBlocksScalar(const std::uint8_t* round_keys, std::size_t nr,
+                         const std::uint8_t* in, std::uint8_t* out,
+                         std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    std::array<std::uint32_t, 4> x{};
+    std::memcpy(x.data(), in + (block * 16), 16);
+
+    for (std::size_t round = 0; round < nr; ++round) {
+      const auto rk = RoundKey(round_keys, round);
+      const std::uint32_t x0 = x[0];
+      x[0] = Rotl((x[0] ^ rk[0]) + (x[1] ^ rk[1]), 9);
+      x[1] = Rotr((x[1] ^ rk[2]) + (x[2] ^ rk[3]), 5);
+      x[2] = Rotr((x[2] ^ rk[4]) + (x[3] ^ rk[5]), 3);
+      x[3] = x0;
+    }
+
+    std::memcpy(out + (block * 16), x.data(), 16);
+  }
+}
+
+void DecryptBlocksScalar(const std::uint8_t* round_keys, std::size_t nr,
+                         const std::uint8_t* in, std::uint8_t* out,
+                         std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    std::array<std::uint32_t, 4> x{};
+    std::memcpy(x.data(), in + (block * 16), 16);
+
+    for (std::size_t round = nr; round-- > 0;) {
+      const auto rk = RoundKey(round_keys, round);
+      const std::uint32_t x0 = x[3];
+      const std::uint32_t x1 = (Rotr(x[0], 9) - (x0 ^ rk[0])) ^ rk[1];
+      const std::uint32_t x2 = (Rotl(x[1], 5) - (x1 ^ rk[2])) ^ rk[3];
+      const std::uint32_t x3 = (Rotl(x[2], 3) - (x2 ^ rk[4])) ^ rk[5];
+      x = {x0, x1, x2, x3};
+    }
+
+    std::memcpy(out + (block * 16), x.data(), 16);
+  }
+}
+
+template <int N>
+static inline __m128i Rotl(__m128i x) {
+  return _mm_or_si128(_mm_slli_epi32(x, N), _mm_srli_epi32(x, 32 - N));
+}
+
+// 블록 4개를 읽어 레지스터 w에 4개 블록의 w번째 워드가 오도록 전치
+// (같은 연산이 역변환이기도 함)
+static inline void Transpose(__m128i& a, __m128i& b, __m128i& c, __m128i& d) {
+  const __m128i t0 = _mm_unpacklo_epi32(a, b);
+  const __m128i t1 = _mm_unpacklo_epi32(c, d);
+  const __m128i t2 = _mm_unpackhi_epi32(a, b);
+  const __m128i t3 = _mm_unpackhi_epi32(c, d);
+  a = _mm_unpacklo_epi64(t0, t1);
+  b = _mm_unpackhi_epi64(t0, t1);
+  c = _mm_unpacklo_epi64(t2, t3);
+  d = _mm_unpackhi_epi64(t2, t3);
+}
+
+static inline __m128i Broadcast(std::uint32_t word) {
+  return _mm_set1_epi32(static_cast<int>(word));
+}
+
+void EncryptBlocksSse2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 4;
+  const auto* in_ptr = reinterpret_cast<const __m128i*>(in);
+  auto* out_ptr = reinterpret_cast<__m128i*>(out);
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m128i x0 = _mm_loadu_si128(in_ptr + block);
+    __m128i x1 = _mm_loadu_si128(in_ptr + block + 1);
+    __m128i x2 = _mm_loadu_si128(in_ptr + block + 2);
+    __m128i x3 = _mm_loadu_si128(in_ptr + block + 3);
+    Transpose(x0, x1, x2, x3);
+
+    for (std::size_t round = 0; round < nr; ++round) {
+      const auto rk = RoundKey(round_keys, round);
+      const __m128i prev0 = x0;
+      x0 = Rotl<9>(_mm_add_epi32(_mm_xor_si128(x0, Broadcast(rk[0])),
+                                 _mm_xor_si128(x1, Broadcast(rk[1]))));
+      x1 = Rotl<27>(_mm_add_epi32(_mm_xor_si128(x1, Broadcast(rk[2])),
+                                  _mm_xor_si128(x2, Broadcast(rk[3]))));
+      x2 = Rotl<29>(_mm_add_epi32(_mm_xor_si128(x2, Broadcast(rk[4])),
+                                  _mm_xor_si128(x3, Broadcast(rk[5]))));
+      x3 = prev0;
+    }
+
+    Transpose(x0, x1, x2, x3);
+    _mm_storeu_si128(out_ptr + block, x0);
+    _mm_storeu_si128(out_ptr + block + 1, x1);
+    _mm_storeu_si128(out_ptr + block + 2, x2);
+    _mm_storeu_si128(out_ptr + block + 3, x3);
+  }
+
+  EncryptBlocksScalar(round_keys, nr, in + (block * 16), out + (block * 16),
+                      blocks - block);
+}
+
+void DecryptBlocksSse2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 4;
+  const auto* in_ptr = reinterpret_cast<const __m128i*>(in);
+  auto* out_ptr = reinterpret_cast<__m128i*>(out);
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m128i x0 = _mm_loadu_si128(in_ptr + block);
+    __m128i x1 = _mm_loadu_si128(in_ptr + block + 1);
+    __m128i x2 = _mm_loadu_si128(in_ptr + block + 2);
+    __m128i x3 = _mm_loadu_si128(in_ptr + block + 3);
+    Transpose(x0, x1, x2, x3);
+
+    for (std::size_t round = nr; round-- > 0;) {
+      const auto rk = RoundKey(round_keys, round);
+      const __m128i next0 = x3;
+      const __m128i next1 = _mm_xor_si128(
+          _mm_sub_epi32(Rotl<23>(x0), _mm_xor_si128(next0, Broadcast(rk[0]))),
+          Broadcast(rk[1]));
+      const __m128i next2 = _mm_xor_si128(
+          _mm_sub_epi32(Rotl<5>(x1), _mm_xor_si128(next1, Broadcast(rk[2]))),
+          Broadcast(rk[3]));
+      x3 = _mm_xor_si128(
+          _mm_sub_epi32(Rotl<3>(x2), _mm_xor_si128(next2, Broadcast(rk[4]))),
+          Broadcast(rk[5]));
+      x0 = next0;
+      x1 = next1;
+      x2 = next2;
+    }
+
+    Transpose(x0, x1, x2, x3);
+    _mm_storeu_si128(out_ptr + block, x0);
+    _mm_storeu_si128(out_ptr + block + 1, x1);
+    _mm_storeu_si128(out_ptr + block + 2, x2);
+    _mm_storeu_si128(out_ptr + block + 3, x3);
+  }
+
+  DecryptBlocksScalar(round_keys, nr, in + (block * 16), out + (block * 16),
+                      blocks - block);
+}
+
+}  // namespace lea
+
+// KeyExpantion이 채운 라운드 키가 nr 라운드만큼 있는지
+static bool HasRoundKeys(const BlockCipherCTX& ctx) noexcept {
+  return ctx.IsValid() && ctx.nr != 0 && ctx.nr <= 32 &&
+         ctx.enc_round_keys.size() * 16 >= ctx.nr * lea::kRoundKeyWords * 4;
+}
+
+// 커널은 라운드 키를 바이트로 받아 lea::RoundKey로 워드를 읽음
+static const std::uint8_t* RoundKeyBytes(const BlockCipherCTX& ctx) noexcept {
+  return ctx.enc_round_keys.front().data();
+}
+
+Lea::Lea() {
+  if (IntrinEnabled(kAVX2)) {
+    encrypt_blocks_ = lea::EncryptBlocksAvx2;
+    decrypt_blocks_ = lea::DecryptBlocksAvx2;
+  } else if (IntrinEnabled(kSSE2)) {
+    encrypt_blocks_ = lea::EncryptBlocksSse2;
+    decrypt_blocks_ = lea::DecryptBlocksSse2;
+  } else {
+    encrypt_blocks_ = lea::EncryptBlocksScalar;
+    decrypt_blocks_ = lea::DecryptBlocksScalar;
+  }
+}
+
+Lea::~Lea() noexcept = default;
+
+ErrorStatus Lea::KeyExpantion(std::span<const std::uint8_t> key,
+                              BlockCipherCTX& ctx) const noexcept {
+  const std::size_t key_words = key.size() / 4;
+  if (key.size() != 16 && key.size() != 24 && key.size() != 32) {
+    return ErrorStatus::kFailure;
+  }
+
+  std::array<std::uint32_t, 8> t{};
+  std::memcpy(t.data(), key.data(), key.size());
+
+  // 라운드 수: 24 / 28 / 32
+  const std::size_t nr = (key_words * 2) + 16;
+  std::array<std::uint32_t, 32 * lea::kRoundKeyWords> round_keys{};
+
+  for (std::size_t i = 0; i < nr; ++i) {
+    auto* rk = round_keys.data() + (i * lea::kRoundKeyWords);
+    const auto shift = static_cast<std::uint32_t>(i);
+
+    if (key_words == 4) {
+      const std::uint32_t delta = kDelta[i % 4];
+      t[0] = Rotl(t[0] + Rotl(delta, shift), 1);
+      t[1] = Rotl(t[1] + Rotl(delta, shift + 1), 3);
+      t[2] = Rotl(t[2] + Rotl(delta, shift + 2), 6);
+      t[3] = Rotl(t[3] + Rotl(delta, shift + 3), 11);
+      rk[0] = t[0];
+      rk[1] = t[1];
+      rk[2] = t[2];
+      rk[3] = t[1];
+      rk[4] = t[3];
+      rk[5] = t[1];
+    } else {
+      // 192: T[0..5]를 고정 위치로, 256: T[6i mod 8]부터 6개를 순환
+      constexpr std::array<std::uint32_t, 6> kShift = {1, 3, 6, 11, 13, 17};
+      const std::uint32_t delta = kDelta[i % key_words];
+      const std::size_t base = key_words == 6 ? 0 : (6 * i) % 8;
+      for (std::size_t j = 0; j < 6; ++j) {
+        const std::size_t idx = (base + j) % key_words;
+        const auto step = shift + static_cast<std::uint32_t>(j);
+        t[idx] = Rotl(t[idx] + Rotl(delta, step), kShift[j]);
+        rk[j] = t[idx];
+      }
+    }
+  }
+
+  // 라운드당 24바이트 = 16바이트 슬롯 1.5개
+  ctx.enc_round_keys.resize((nr * lea::kRoundKeyWords * 4) / 16);
+  std::memcpy(ctx.enc_round_keys.data(), round_keys.data(),
+              nr * lea::kRoundKeyWords * 4);
+  ctx.nr = nr;
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Lea::Encrypt(BlockCipherCTX& ctx,
+                         std::span<const std::uint8_t> block,
+                         std::span<std::uint8_t> out) const noexcept {
+  if (!HasRoundKeys(ctx) || block.size() != 16 || out.size() < 16) {
+    return ErrorStatus::kFailure;
+  }
+
+  lea::EncryptBlocksScalar(RoundKeyBytes(ctx), ctx.nr, block.data(),
+                           out.data(), 1);
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Lea::Decrypt(BlockCipherCTX& ctx,
+                         std::span<const std::uint8_t> block,
+                         std::span<std::uint8_t> out) const noexcept {
+  if (!HasRoundKeys(ctx) || block.size() != 16 || out.size() < 16) {
+    return ErrorStatus::kFailure;
+  }
+
+  lea::DecryptBlocksScalar(RoundKeyBytes(ctx), ctx.nr, block.data(),
+                           out.data(), 1);
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Lea::EncryptBlocks(BlockCipherCTX& ctx,
+                               std::span<const std::uint8_t> blocks,
+                               std::span<std::uint8_t> out) const noexcept {
+  if (!HasRoundKeys(ctx) || blocks.size() % 16 != 0 ||
+      out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  encrypt_blocks_(RoundKeyBytes(ctx), ctx.nr, blocks.data(), out.data(),
+                  blocks.size() / 16);
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus Lea::DecryptBlocks(BlockCipherCTX& ctx,
+                               std::span<const std::uint8_t> blocks,
+                               std::span<std::uint8_t> out) const noexcept {
+  if (!HasRoundKeys(ctx) || blocks.size() % 16 != 0 ||
+      out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  decrypt_blocks_(RoundKeyBytes(ctx), ctx.nr, blocks.data(), out.data(),
+                  blocks.size() / 16);
+
+  return ErrorStatus::kSuccess;
+}
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,122 @@
+#include <immintrin.h>
+
+#include "encryption/cipher/lea.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::cipher::lea {
+
+template <int N>
+static inline __m256i Rotl(__m256i x) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, N), _mm256_srli_epi32(x, 32 - N));
+}
+
+static inline __m256i Broadcast(std::uint32_t word) {
+  return _mm256_set1_epi32(static_cast<int>(word));
+}
+
+// 128-bit 레인 안에서 4x4 전치 (역변환도 같은 연산)
+static inline void Transpose(__m256i& a, __m256i& b, __m256i& c, __m256i& d) {
+  const __m256i t0 = _mm256_unpacklo_epi32(a, b);
+  const __m256i t1 = _mm256_unpacklo_epi32(c, d);
+  const __m256i t2 = _mm256_unpackhi_epi32(a, b);
+  const __m256i t3 = _mm256_unpackhi_epi32(c, d);
+  a = _mm256_unpacklo_epi64(t0, t1);
+  b = _mm256_unpackhi_epi64(t0, t1);
+  c = _mm256_unpacklo_epi64(t2, t3);
+  d = _mm256_unpackhi_epi64(t2, t3);
+}
+
+// 레지스터 j = [블록 j | 블록 j+4]
+static inline void Load(const std::uint8_t* in, __m256i& x0, __m256i& x1,
+                        __m256i& x2, __m256i& x3) {
+  const auto* ptr = reinterpret_cast<const __m128i*>(in);
+  x0 = _mm256_loadu2_m128i(ptr + 4, ptr);
+  x1 = _mm256_loadu2_m128i(ptr + 5, ptr + 1);
+  x2 = _mm256_loadu2_m128i(ptr + 6, ptr + 2);
+  x3 = _mm256_loadu2_m128i(ptr + 7, ptr + 3);
+  Transpose(x0, x1, x2, x3);
+}
+
+static inline void Store(std::uint8_t* out, __m256i x0, __m256i x1,
+                         __m256i x2, __m256i x3) {
+  Transpose(x0, x1, x2, x3);
+  auto* ptr = reinterpret_cast<__m128i*>(out);
+  _mm256_storeu2_m128i(ptr + 4, ptr, x0);
+  _mm256_storeu2_m128i(ptr + 5, ptr + 1, x1);
+  _mm256_storeu2_m128i(ptr + 6, ptr + 2, x2);
+  _mm256_storeu2_m128i(ptr + 7, ptr + 3, x3);
+}
+
+void EncryptBlocksAvx2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 8;
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m256i x0;
+    __m256i x1;
+    __m256i x2;
+    __m256i x3;
+    Load(in + (block * 16), x0, x1, x2, x3);
+
+    for (std::size_t round = 0; round < nr; ++round) {
+      const auto rk = RoundKey(round_keys, round);
+      const __m256i prev0 = x0;
+      x0 = Rotl<9>(_mm256_add_epi32(_mm256_xor_si256(x0, Broadcast(rk[0])),
+                                    _mm256_xor_si256(x1, Broadcast(rk[1]))));
+      x1 = Rotl<27>(_mm256_add_epi32(_mm256_xor_si256(x1, Broadcast(rk[2])),
+                                     _mm256_xor_si256(x2, Broadcast(rk[3]))));
+      x2 = Rotl<29>(_mm256_add_epi32(_mm256_xor_si256(x2, Broadcast(rk[4])),
+                                     _mm256_xor_si256(x3, Broadcast(rk[5]))));
+      x3 = prev0;
+    }
+
+    Store(out + (block * 16), x0, x1, x2, x3);
+  }
+
+  EncryptBlocksSse2(round_keys, nr, in + (block * 16), out + (block * 16),
+                    blocks - block);
+}
+
+void DecryptBlocksAvx2(const std::uint8_t* round_keys, std::size_t nr,
+                       const std::uint8_t* in, std::uint8_t* out,
+                       std::size_t blocks) noexcept {
+  constexpr std::size_t kLanes = 8;
+  std::size_t block = 0;
+
+  for (; block + kLanes <= blocks; block += kLanes) {
+    __m256i x0;
+    __m256i x1;
+    __m256i x2;
+    __m256i x3;
+    Load(in + (block * 16), x0, x1, x2, x3);
+
+    for (std::size_t round = nr; round-- > 0;) {
+      const auto rk = RoundKey(round_keys, round);
+      const __m256i next0 = x3;
+      const __m256i next1 = _mm256_xor_si256(
+          _mm256_sub_epi32(Rotl<23>(x0),
+                           _mm256_xor_si256(next0, Broadcast(rk[0]))),
+          Broadcast(rk[1]));
+      const __m256i next2 = _mm256_xor_si256(
+          _mm256_sub_epi32(Rotl<5>(x1),
+                           _mm256_xor_si256(next1, Broadcast(rk[2]))),
+          Broadcast(rk[3]));
+      x3 = _mm256_xor_si256(
+          _mm256_sub_epi32(Rotl<3>(x2),
+                           _mm256_xor_si256(next2, Broadcast(rk[4]))),
+          Broadcast(rk[5]));
+      x0 = next0;
+      x1 = next1;
+      x2 = next2;
+    }
+
+    Store(out + (block * 16), x0, x1, x2, x3);
+  }
+
+  DecryptBlocksSse2(round_keys, nr, in + (block * 16), out + (block * 16),
+                    blocks - block);
+}
+
+}  // namespace bedrock::cipher::lea
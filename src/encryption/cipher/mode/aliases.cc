@@ -5,5 +5,9 @@ namespace bedrock::cipher {
 AesCbc::~AesCbc() = default;
 AesCtr::~AesCtr() = default;
 AesEcb::~AesEcb() = default;
+AesCfb1::~AesCfb1() = default;
+AesCfb8::~AesCfb8() = default;
+AesCfb128::~AesCfb128() = default;
+AesOfb::~AesOfb() = default;
 
 }  // namespace bedrock::cipher
@@ -1,34 +1,75 @@
 #include "encryption/cipher/mode/cbc.h"
 
 #include <algorithm>
+#include <array>
 
 #include "encryption/util/helper.h"
 
 namespace bedrock::cipher::op_mode {
 
+// 복호화 시 한번에 DecryptBlocks로 넘기는 블록 수
+static constexpr std::size_t kParallelBlocks = 8;
+static constexpr std::size_t kMaxBlockBytes = 16;
+
 ErrorStatus CBC::Process(
     std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
     ModeContext& ctx, const std::span<const std::uint8_t> input,
     std::span<std::uint8_t> output, bool final) {
-  if (impl == nullptr || !ctx.IsValid() || input.size() != ctx.block_size / 8 ||
-      output.size() != ctx.block_size / 8) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+  if (impl == nullptr || !ctx.IsValid() || block_bytes == 0 ||
+      block_bytes > kMaxBlockBytes || input.empty() ||
+      input.size() % block_bytes != 0 || output.size() != input.size()) {
     return ErrorStatus::kFailure;
   }
 
   if (ctx.mode == bedrock::cipher::op_mode::CipherMode::kEncrypt) {
-    std::ranges::copy(input, ctx.buffer.begin());
-    util::XorInplace(ctx.buffer, ctx.prev_vector);
-    impl->Encrypt(ctx, ctx.buffer, ctx.prev_vector);
+    for (std::size_t offset = 0; offset < input.size();
+         offset += block_bytes) {
+      std::ranges::copy(input.subspan(offset, block_bytes),
+                        ctx.buffer.begin());
+      util::XorInplace(ctx.buffer, ctx.prev_vector);
+      if (impl->Encrypt(ctx, ctx.buffer, ctx.prev_vector) !=
+          ErrorStatus::kSuccess) {
+        return ErrorStatus::kFailure;
+      }
+      std::ranges::copy(ctx.prev_vector, output.subspan(offset).begin());
+    }
     ctx.buffer = ctx.prev_vector;
-  } else {
-    impl->Decrypt(ctx, input, ctx.buffer);
-    util::XorInplace(ctx.buffer, ctx.prev_vector);
-    std::ranges::copy(input, ctx.prev_vector.begin());
+    return ErrorStatus::kSuccess;
   }
 
-  std::ranges::copy(ctx.buffer, output.begin());
+  // P_i = D(C_i) ^ C_{i-1} 에서 D(C_i)끼리는 독립이므로 묶어서 복호화
+  std::array<std::uint8_t, (kParallelBlocks + 1) * kMaxBlockBytes> feedback{};
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> decrypted{};
+
+  for (std::size_t offset = 0; offset < input.size();) {
+    const std::size_t chunk =
+        (std::min)(kParallelBlocks * block_bytes, input.size() - offset);
+
+    // in-place 처리 시 output이 input을 덮어쓰기 전에 암호문 보관
+    std::ranges::copy(ctx.prev_vector, feedback.begin());
+    std::ranges::copy(input.subspan(offset, chunk),
+                      std::span(feedback).subspan(block_bytes).begin());
+
+    if (impl->DecryptBlocks(ctx, std::span(feedback).subspan(block_bytes, chunk),
+                            std::span(decrypted).first(chunk)) !=
+        ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+
+    for (std::size_t i = 0; i < chunk; ++i) {
+      output[offset + i] =
+          static_cast<std::uint8_t>(decrypted[i] ^ feedback[i]);
+    }
+    std::ranges::copy(std::span(feedback).subspan(chunk, block_bytes),
+                      ctx.prev_vector.begin());
+    std::ranges::copy(std::span(output).subspan(offset + chunk - block_bytes,
+                                                block_bytes),
+                      ctx.buffer.begin());
+    offset += chunk;
+  }
 
   return ErrorStatus::kSuccess;
 }
 
-}  // namespace bedrock::cipher::op_mode
\ No newline at end of file
+}  // namespace bedrock::cipher::op_mode
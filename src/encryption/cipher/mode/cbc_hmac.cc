@@ -0,0 +1,248 @@
+#include "encryption/cipher/mode/cbc_hmac.h"
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/hmac.h"
+
+namespace bedrock::cipher {
+
+namespace sha256 = bedrock::hash::sha256;
+
+// AES 블록 하나당 진행하는 SHA-256 라운드 수 (MAC 블록 64B = AES 블록 4개)
+static constexpr std::size_t kShaRoundsPerBlock = 16;
+// aesenc/aesdec 한 라운드 뒤에 끼워 넣는 SHA-256 라운드 수
+static constexpr std::size_t kShaRoundsPerAesRound = 2;
+static constexpr std::size_t kAesBlockBytes = 16;
+
+static bool AesNiEnabled() {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+  static bool enabled =
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AESNI") &&
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSE2") &&
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSSE3");
+  return enabled;
+}
+
+// 남은 메시지와 전체 길이로 패딩 후 최종 다이제스트 계산
+static std::array<std::uint8_t, sha256::kDigestBytes> FinalizeDigest(
+    sha256::State h, std::span<const std::uint8_t> tail,
+    std::uint64_t total_bytes) noexcept {
+  std::array<std::uint8_t, sha256::kBlockBytes * 2> last{};
+  std::ranges::copy(tail, last.begin());
+  last[tail.size()] = 0x80;
+
+  const std::size_t last_bytes =
+      tail.size() < 56 ? sha256::kBlockBytes : sha256::kBlockBytes * 2;
+  const std::uint64_t bit_length = total_bytes * 8;
+  for (std::size_t i = 0; i < 8; i++) {
+    last[last_bytes - 1 - i] = static_cast<std::uint8_t>(bit_length >> (i * 8));
+  }
+
+  for (std::size_t offset = 0; offset < last_bytes;
+       offset += sha256::kBlockBytes) {
+    sha256::CompressBytes(h, last.data() + offset);
+  }
+
+  std::array<std::uint8_t, sha256::kDigestBytes> digest{};
+  for (std::size_t i = 0; i < 8; i++) {
+    sha256::StoreBigEndian32(digest.data() + (i * 4), h[i]);
+  }
+  return digest;
+}
+
+AesCbcHmacSha256::AesCbcHmacSha256(std::span<const std::uint8_t> key,
+                                   std::span<const std::uint8_t> iv,
+                                   std::span<const std::uint8_t> mac_key)
+    : aesni_(AesNiEnabled()),
+      impl_(aesni_ ? std::shared_ptr<AESImpl>(std::make_shared<AesNi>())
+                   : std::shared_ptr<AESImpl>(std::make_shared<AesSoft>())),
+      ctx_(impl_, key, iv, op_mode::CipherMode::kEncrypt, 0, false) {
+  // ipad/opad 블록은 키에만 의존하므로 압축 결과를 미리 저장
+  const hash::HmacSha256 mac(mac_key);
+  inner_midstate_ = mac.InnerMidstate();
+  outer_midstate_ = mac.OuterMidstate();
+
+  Restart();
+}
+
+AesCbcHmacSha256::~AesCbcHmacSha256() = default;
+
+void AesCbcHmacSha256::Restart() noexcept {
+  inner_ = inner_midstate_;
+  mac_buffered_ = 0;
+  mac_bytes_ = 0;
+  pending_round_ = 64;
+
+  if (!ctx_.IsValid()) {
+    return;
+  }
+  ctx_.prev_vector = ctx_.iv;
+  AbsorbCipherBlock(ctx_.iv.data());
+}
+
+AesCbcHmacSha256& AesCbcHmacSha256::operator<<(
+    const op_mode::CipherMode& mode) {
+  ctx_.SetMode(mode);
+  Restart();
+  return *this;
+}
+
+void AesCbcHmacSha256::RunPendingRounds(std::size_t count) noexcept {
+  if (pending_round_ == 64) {
+    return;
+  }
+
+  const std::size_t end = (std::min)(pending_round_ + count, std::size_t{64});
+  for (; pending_round_ < end; ++pending_round_) {
+    sha256::Round(pending_v_,
+                  sha256::kK[pending_round_] + pending_w_[pending_round_]);
+  }
+  if (pending_round_ == 64) {
+    for (std::size_t i = 0; i < 8; i++) {
+      inner_[i] += pending_v_[i];
+    }
+  }
+}
+
+void AesCbcHmacSha256::AbsorbCipherBlock(const std::uint8_t* block) noexcept {
+  std::memcpy(mac_buffer_.data() + mac_buffered_, block, kAesBlockBytes);
+  mac_buffered_ += kAesBlockBytes;
+  mac_bytes_ += kAesBlockBytes;
+
+  if (mac_buffered_ == sha256::kBlockBytes) {
+    // 이전 블록이 남아 있으면 먼저 끝내고 새 블록의 라운드를 시작
+    RunPendingRounds(64);
+    pending_w_ = sha256::ExpandSchedule(sha256::LoadBlock(mac_buffer_.data()));
+    pending_v_ = inner_;
+    pending_round_ = 0;
+    mac_buffered_ = 0;
+  }
+}
+
+bool AesCbcHmacSha256::StitchedBlock(const std::uint8_t* in,
+                                     std::uint8_t* out) noexcept {
+  std::size_t sha_budget = kShaRoundsPerBlock;
+  auto sha_step = [&]() {
+    const std::size_t count = (std::min)(kShaRoundsPerAesRound, sha_budget);
+    RunPendingRounds(count);
+    sha_budget -= count;
+  };
+
+  std::array<std::uint8_t, kAesBlockBytes> cipher_block{};
+
+  if (ctx_.mode == op_mode::CipherMode::kEncrypt) {
+    if (aesni_) {
+      const auto* round_keys =
+          reinterpret_cast<const __m128i*>(ctx_.enc_round_keys.data());
+      __m128i state = _mm_xor_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)),
+          _mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(ctx_.prev_vector.data())));
+      state = _mm_xor_si128(state, _mm_loadu_si128(round_keys));
+      for (std::size_t round = 1; round < ctx_.nr; ++round) {
+        state = _mm_aesenc_si128(state, _mm_loadu_si128(round_keys + round));
+        sha_step();
+      }
+      state = _mm_aesenclast_si128(state,
+                                   _mm_loadu_si128(round_keys + ctx_.nr));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(cipher_block.data()), state);
+    } else {
+      std::array<std::uint8_t, kAesBlockBytes> plain{};
+      for (std::size_t i = 0; i < kAesBlockBytes; i++) {
+        plain[i] = static_cast<std::uint8_t>(in[i] ^ ctx_.prev_vector[i]);
+      }
+      if (impl_->Encrypt(ctx_, plain, cipher_block) != ErrorStatus::kSuccess) {
+        return false;
+      }
+    }
+    std::ranges::copy(cipher_block, ctx_.prev_vector.begin());
+    std::memcpy(out, cipher_block.data(), kAesBlockBytes);
+  } else {
+    // in-place 처리 시 out이 덮어쓰기 전에 암호문을 보관
+    std::memcpy(cipher_block.data(), in, kAesBlockBytes);
+    std::array<std::uint8_t, kAesBlockBytes> plain{};
+    if (aesni_) {
+      const auto* round_keys =
+          reinterpret_cast<const __m128i*>(ctx_.dec_round_keys.data());
+      __m128i state = _mm_xor_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(cipher_block.data())),
+          _mm_loadu_si128(round_keys + ctx_.nr));
+      for (std::size_t round = ctx_.nr - 1; round > 0; --round) {
+        state = _mm_aesdec_si128(state, _mm_loadu_si128(round_keys + round));
+        sha_step();
+      }
+      state = _mm_aesdeclast_si128(state, _mm_loadu_si128(round_keys));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(plain.data()), state);
+    } else {
+      if (impl_->Decrypt(ctx_, cipher_block, plain) != ErrorStatus::kSuccess) {
+        return false;
+      }
+    }
+    for (std::size_t i = 0; i < kAesBlockBytes; i++) {
+      out[i] = static_cast<std::uint8_t>(plain[i] ^ ctx_.prev_vector[i]);
+    }
+    std::ranges::copy(cipher_block, ctx_.prev_vector.begin());
+  }
+
+  RunPendingRounds(sha_budget);
+  AbsorbCipherBlock(cipher_block.data());
+  return true;
+}
+
+ErrorStatus AesCbcHmacSha256::Process(std::span<const std::uint8_t> input,
+                                      std::span<std::uint8_t> output) {
+  if (!ctx_.IsValid() || input.size() % kAesBlockBytes != 0 ||
+      output.size() != input.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  for (std::size_t offset = 0; offset < input.size();
+       offset += kAesBlockBytes) {
+    if (!StitchedBlock(input.data() + offset, output.data() + offset)) {
+      return ErrorStatus::kFailure;
+    }
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+std::array<std::uint8_t, AesCbcHmacSha256::kTagBytes> AesCbcHmacSha256::Tag()
+    const noexcept {
+  sha256::State inner = inner_;
+  if (pending_round_ != 64) {
+    sha256::State v = pending_v_;
+    for (std::size_t t = pending_round_; t < 64; t++) {
+      sha256::Round(v, sha256::kK[t] + pending_w_[t]);
+    }
+    for (std::size_t i = 0; i < 8; i++) {
+      inner[i] += v[i];
+    }
+  }
+
+  const auto inner_digest =
+      FinalizeDigest(inner, std::span(mac_buffer_).first(mac_buffered_),
+                     sha256::kBlockBytes + mac_bytes_);
+  return FinalizeDigest(outer_midstate_, inner_digest,
+                        sha256::kBlockBytes + sha256::kDigestBytes);
+}
+
+bool AesCbcHmacSha256::Verify(std::span<const std::uint8_t> tag) const noexcept {
+  if (tag.size() != kTagBytes) {
+    return false;
+  }
+
+  const auto expected = Tag();
+  std::uint8_t diff = 0;
+  for (std::size_t i = 0; i < kTagBytes; i++) {
+    diff = static_cast<std::uint8_t>(diff | (expected[i] ^ tag[i]));
+  }
+  return diff == 0;
+}
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,231 @@
+#include "encryption/cipher/mode/cfb.h"
+
+#include <algorithm>
+#include <array>
+
+#include "encryption/util/helper.h"
+
+namespace bedrock::cipher::op_mode {
+
+// 복호화 시 한번에 EncryptBlocks로 넘기는 블록 수
+static constexpr std::size_t kParallelBlocks = 8;
+static constexpr std::size_t kMaxBlockBytes = 16;
+
+CFB::CFB(std::uint32_t segment_bits) : segment_bits_(segment_bits) {
+  switch (segment_bits_) {
+    case 1:
+      algorithm_name = "CFB1";
+      break;
+    case 8:
+      algorithm_name = "CFB8";
+      break;
+    default:
+      segment_bits_ = 128;
+      algorithm_name = "CFB";
+      break;
+  }
+}
+
+static ErrorStatus ProcessCfb128(
+    const std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm>& impl,
+    ModeContext& ctx, std::span<const std::uint8_t> input,
+    std::span<std::uint8_t> output) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+  if (input.size() % block_bytes != 0) {
+    return ErrorStatus::kFailure;
+  }
+
+  if (ctx.mode == CipherMode::kEncrypt) {
+    for (std::size_t offset = 0; offset < input.size();
+         offset += block_bytes) {
+      if (impl->Encrypt(ctx, ctx.prev_vector, ctx.buffer) !=
+          ErrorStatus::kSuccess) {
+        return ErrorStatus::kFailure;
+      }
+      bedrock::util::XorInplace(ctx.buffer,
+                                input.subspan(offset, block_bytes));
+      ctx.prev_vector = ctx.buffer;
+      std::ranges::copy(ctx.buffer, output.subspan(offset).begin());
+    }
+    return ErrorStatus::kSuccess;
+  }
+
+  // 키스트림 입력 = [prev, C_0, ..., C_{n-2}] 이므로 모두 미리 알 수 있음
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> feedback{};
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> keystream{};
+
+  for (std::size_t offset = 0; offset < input.size();) {
+    const std::size_t chunk =
+        (std::min)(kParallelBlocks * block_bytes, input.size() - offset);
+    auto in_chunk = input.subspan(offset, chunk);
+
+    std::ranges::copy(ctx.prev_vector, feedback.begin());
+    std::ranges::copy(in_chunk.first(chunk - block_bytes),
+                      std::span(feedback).subspan(block_bytes).begin());
+    // in-place 처리 시 output이 input을 덮어쓰기 전에 feedback 갱신
+    std::ranges::copy(in_chunk.last(block_bytes), ctx.prev_vector.begin());
+
+    if (impl->EncryptBlocks(ctx, std::span(feedback).first(chunk),
+                            std::span(keystream).first(chunk)) !=
+        ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+
+    for (std::size_t i = 0; i < chunk; ++i) {
+      output[offset + i] =
+          static_cast<std::uint8_t>(in_chunk[i] ^ keystream[i]);
+    }
+    offset += chunk;
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+static ErrorStatus ProcessCfb8(
+    const std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm>& impl,
+    ModeContext& ctx, std::span<const std::uint8_t> input,
+    std::span<std::uint8_t> output) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+
+  if (ctx.mode == CipherMode::kEncrypt) {
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      if (impl->Encrypt(ctx, ctx.prev_vector, ctx.buffer) !=
+          ErrorStatus::kSuccess) {
+        return ErrorStatus::kFailure;
+      }
+      const auto cipher_byte =
+          static_cast<std::uint8_t>(input[i] ^ ctx.buffer[0]);
+      std::shift_left(ctx.prev_vector.begin(), ctx.prev_vector.end(), 1);
+      ctx.prev_vector.back() = cipher_byte;
+      output[i] = cipher_byte;
+    }
+    return ErrorStatus::kSuccess;
+  }
+
+  // i번째 바이트의 키스트림 입력은 (prev || C)[i, i + block_bytes) 구간
+  std::array<std::uint8_t, kMaxBlockBytes + kParallelBlocks> window{};
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> feedback{};
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> keystream{};
+
+  for (std::size_t offset = 0; offset < input.size();) {
+    const std::size_t chunk =
+        (std::min)(kParallelBlocks, input.size() - offset);
+
+    std::ranges::copy(ctx.prev_vector, window.begin());
+    std::ranges::copy(input.subspan(offset, chunk),
+                      std::span(window).subspan(block_bytes).begin());
+    for (std::size_t i = 0; i < chunk; ++i) {
+      std::ranges::copy(
+          std::span(window).subspan(i, block_bytes),
+          std::span(feedback).subspan(i * block_bytes).begin());
+    }
+    std::ranges::copy(std::span(window).subspan(chunk, block_bytes),
+                      ctx.prev_vector.begin());
+
+    if (impl->EncryptBlocks(ctx, std::span(feedback).first(chunk * block_bytes),
+                            std::span(keystream).first(chunk * block_bytes)) !=
+        ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+
+    for (std::size_t i = 0; i < chunk; ++i) {
+      output[offset + i] = static_cast<std::uint8_t>(
+          window[block_bytes + i] ^ keystream[i * block_bytes]);
+    }
+    offset += chunk;
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+static ErrorStatus ProcessCfb1(
+    const std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm>& impl,
+    ModeContext& ctx, std::span<const std::uint8_t> input,
+    std::span<std::uint8_t> output) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+
+  if (ctx.mode == CipherMode::kEncrypt) {
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      std::uint8_t cipher_byte = 0;
+      for (int bit = 7; bit >= 0; --bit) {
+        if (impl->Encrypt(ctx, ctx.prev_vector, ctx.buffer) !=
+            ErrorStatus::kSuccess) {
+          return ErrorStatus::kFailure;
+        }
+        const auto cipher_bit = static_cast<std::uint8_t>(
+            ((input[i] >> bit) ^ (ctx.buffer[0] >> 7)) & 1U);
+        // 레지스터를 1 bit 왼쪽으로 밀고 암호문 bit를 LSB에 채움
+        for (std::size_t j = 0; j + 1 < block_bytes; ++j) {
+          ctx.prev_vector[j] = static_cast<std::uint8_t>(
+              (ctx.prev_vector[j] << 1) | (ctx.prev_vector[j + 1] >> 7));
+        }
+        ctx.prev_vector.back() = static_cast<std::uint8_t>(
+            (ctx.prev_vector.back() << 1) | cipher_bit);
+        cipher_byte =
+            static_cast<std::uint8_t>(cipher_byte | (cipher_bit << bit));
+      }
+      output[i] = cipher_byte;
+    }
+    return ErrorStatus::kSuccess;
+  }
+
+  // 암호문 1바이트의 8개 bit에 대한 키스트림 입력은 (prev || C_i)를
+  // 0~7 bit 밀어낸 값이므로 한번의 EncryptBlocks로 처리
+  std::array<std::uint8_t, kMaxBlockBytes + 1> window{};
+  std::array<std::uint8_t, 8 * kMaxBlockBytes> feedback{};
+  std::array<std::uint8_t, 8 * kMaxBlockBytes> keystream{};
+
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    const std::uint8_t cipher_byte = input[i];
+    std::ranges::copy(ctx.prev_vector, window.begin());
+    window[block_bytes] = cipher_byte;
+
+    for (std::size_t shift = 0; shift < 8; ++shift) {
+      for (std::size_t j = 0; j < block_bytes; ++j) {
+        feedback[(shift * block_bytes) + j] =
+            shift == 0 ? window[j]
+                       : static_cast<std::uint8_t>(
+                             (window[j] << shift) |
+                             (window[j + 1] >> (8 - shift)));
+      }
+    }
+    std::ranges::copy(std::span(window).subspan(1, block_bytes),
+                      ctx.prev_vector.begin());
+
+    if (impl->EncryptBlocks(ctx, std::span(feedback).first(8 * block_bytes),
+                            std::span(keystream).first(8 * block_bytes)) !=
+        ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+
+    std::uint8_t plain_byte = 0;
+    for (std::size_t shift = 0; shift < 8; ++shift) {
+      plain_byte = static_cast<std::uint8_t>(
+          plain_byte | (keystream[shift * block_bytes] & 0x80U) >> shift);
+    }
+    output[i] = static_cast<std::uint8_t>(plain_byte ^ cipher_byte);
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus CFB::Process(
+    std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
+    ModeContext& ctx, const std::span<const std::uint8_t> input,
+    std::span<std::uint8_t> output, bool final) {
+  if (impl == nullptr || !ctx.IsValid() || ctx.block_size == 0 ||
+      ctx.block_size / 8 > kMaxBlockBytes || output.size() != input.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  switch (segment_bits_) {
+    case 1:
+      return ProcessCfb1(impl, ctx, input, output);
+    case 8:
+      return ProcessCfb8(impl, ctx, input, output);
+    default:
+      return ProcessCfb128(impl, ctx, input, output);
+  }
+}
+
+}  // namespace bedrock::cipher::op_mode
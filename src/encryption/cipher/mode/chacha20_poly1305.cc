@@ -0,0 +1,115 @@
+#include "encryption/cipher/mode/chacha20_poly1305.h"
+
+namespace bedrock::cipher {
+
+static constexpr std::array<std::uint8_t, Poly1305::kBlockBytes> kZeroPad{};
+
+// 16바이트 경계까지 0으로 채울 길이
+static std::size_t PadBytes(std::uint64_t length) {
+  return static_cast<std::size_t>(
+      (Poly1305::kBlockBytes - (length % Poly1305::kBlockBytes)) %
+      Poly1305::kBlockBytes);
+}
+
+ChaCha20Poly1305::ChaCha20Poly1305(std::span<const std::uint8_t> key,
+                                   std::span<const std::uint8_t> nonce) {
+  chacha_.SetKey(key, nonce);
+  Restart();
+}
+
+ChaCha20Poly1305::~ChaCha20Poly1305() = default;
+
+void ChaCha20Poly1305::Restart() noexcept {
+  aad_bytes_ = 0;
+  text_bytes_ = 0;
+  aad_closed_ = false;
+
+  if (!chacha_.IsValid()) {
+    return;
+  }
+
+  // 블록 0의 앞 32바이트가 Poly1305 일회용 키, 본문은 블록 1부터
+  std::array<std::uint8_t, ChaCha20::kBlockBytes> block0{};
+  chacha_.KeystreamBlock(0, block0);
+  poly_.SetKey(std::span(block0).first(Poly1305::kKeyBytes));
+  chacha_.Seek(1);
+}
+
+ChaCha20Poly1305& ChaCha20Poly1305::operator<<(
+    const op_mode::CipherMode& mode) {
+  mode_ = mode;
+  Restart();
+  return *this;
+}
+
+ErrorStatus ChaCha20Poly1305::AddAad(std::span<const std::uint8_t> aad) {
+  if (!chacha_.IsValid() || aad_closed_) {
+    return ErrorStatus::kFailure;
+  }
+
+  poly_.Update(aad);
+  aad_bytes_ += aad.size();
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus ChaCha20Poly1305::Process(std::span<const std::uint8_t> input,
+                                      std::span<std::uint8_t> output) {
+  if (!chacha_.IsValid() || output.size() != input.size() ||
+      input.size() > kMaxTextBytes - text_bytes_) {
+    return ErrorStatus::kFailure;
+  }
+
+  if (!aad_closed_) {
+    poly_.Update(std::span(kZeroPad).first(PadBytes(aad_bytes_)));
+    aad_closed_ = true;
+  }
+
+  // MAC은 항상 암호문에 대해 계산 (복호화는 in-place로 덮어쓰기 전에)
+  if (mode_ == op_mode::CipherMode::kDecrypt) {
+    poly_.Update(input);
+  }
+  if (chacha_.Process(input, output) != ErrorStatus::kSuccess) {
+    return ErrorStatus::kFailure;
+  }
+  if (mode_ == op_mode::CipherMode::kEncrypt) {
+    poly_.Update(output);
+  }
+  text_bytes_ += input.size();
+
+  return ErrorStatus::kSuccess;
+}
+
+std::array<std::uint8_t, ChaCha20Poly1305::kTagBytes> ChaCha20Poly1305::Tag()
+    const noexcept {
+  Poly1305 poly = poly_;
+  if (!aad_closed_) {
+    poly.Update(std::span(kZeroPad).first(PadBytes(aad_bytes_)));
+  }
+  poly.Update(std::span(kZeroPad).first(PadBytes(text_bytes_)));
+
+  std::array<std::uint8_t, 16> lengths{};
+  for (std::size_t i = 0; i < 8; ++i) {
+    lengths[i] = static_cast<std::uint8_t>(aad_bytes_ >> (i * 8));
+    lengths[8 + i] = static_cast<std::uint8_t>(text_bytes_ >> (i * 8));
+  }
+  poly.Update(lengths);
+
+  return poly.Final();
+}
+
+bool ChaCha20Poly1305::Verify(
+    std::span<const std::uint8_t> tag) const noexcept {
+  if (tag.size() != kTagBytes) {
+    return false;
+  }
+
+  const auto expected = Tag();
+  std::uint8_t diff = 0;
+  for (std::size_t i = 0; i < kTagBytes; i++) {
+    diff = static_cast<std::uint8_t>(diff | (expected[i] ^ tag[i]));
+  }
+  return diff == 0;
+}
+
+}  // namespace bedrock::cipher
@@ -1,26 +1,53 @@
 #include "encryption/cipher/mode/ctr.h"
 
 #include <algorithm>
+#include <array>
 
 #include "encryption/util/helper.h"
 
 namespace bedrock::cipher::op_mode {
 
+// 한번에 EncryptBlocks로 넘기는 카운터 블록 수
+static constexpr std::size_t kParallelBlocks = 8;
+static constexpr std::size_t kMaxBlockBytes = 16;
+
 ErrorStatus CTR::Process(
     std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
     ModeContext& ctx, const std::span<const std::uint8_t> input,
     std::span<std::uint8_t> output, bool final) {
-  if (impl == nullptr || !ctx.IsValid() || input.size() != ctx.block_size / 8 ||
-      output.size() != ctx.block_size / 8 || ctx.m_bits == 0) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+  if (impl == nullptr || !ctx.IsValid() || block_bytes == 0 ||
+      block_bytes > kMaxBlockBytes || input.empty() ||
+      input.size() % block_bytes != 0 || output.size() != input.size() ||
+      ctx.m_bits == 0) {
     return ErrorStatus::kFailure;
   }
 
-  impl->Encrypt(ctx, ctx.prev_vector, ctx.buffer);
-  bedrock::util::StandardIncrement(ctx.prev_vector, ctx.m_bits);
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> counters{};
+  std::array<std::uint8_t, kParallelBlocks * kMaxBlockBytes> keystream{};
+
+  for (std::size_t offset = 0; offset < input.size();) {
+    const std::size_t chunk =
+        (std::min)(kParallelBlocks * block_bytes, input.size() - offset);
 
-  std::ranges::copy(ctx.buffer, output.begin());
-  bedrock::util::XorInplace(output, input);
+    for (std::size_t i = 0; i < chunk; i += block_bytes) {
+      std::ranges::copy(ctx.prev_vector,
+                        std::span(counters).subspan(i).begin());
+      bedrock::util::StandardIncrement(ctx.prev_vector, ctx.m_bits);
+    }
+    if (impl->EncryptBlocks(ctx, std::span(counters).first(chunk),
+                            std::span(keystream).first(chunk)) !=
+        ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+
+    for (std::size_t i = 0; i < chunk; ++i) {
+      output[offset + i] =
+          static_cast<std::uint8_t>(input[offset + i] ^ keystream[i]);
+    }
+    offset += chunk;
+  }
 
   return ErrorStatus::kSuccess;
 }
-}  // namespace bedrock::cipher::op_mode
\ No newline at end of file
+}  // namespace bedrock::cipher::op_mode
@@ -6,18 +6,18 @@ ErrorStatus ECB::Process(
     std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
     ModeContext& ctx, const std::span<const std::uint8_t> input,
     std::span<std::uint8_t> output, bool final) {
-  if (impl == nullptr || !ctx.IsValid() || input.size() != ctx.block_size / 8 ||
-      output.size() != ctx.block_size / 8) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+  if (impl == nullptr || !ctx.IsValid() || block_bytes == 0 ||
+      input.empty() || input.size() % block_bytes != 0 ||
+      output.size() != input.size()) {
     return ErrorStatus::kFailure;
   }
 
+  // 블록끼리 독립이므로 여러 블록을 한번에 구현체의 병렬 커널로 넘김
   if (ctx.mode == CipherMode::kEncrypt) {
-    impl->Encrypt(ctx, input, output);
-  } else {
-    impl->Decrypt(ctx, input, output);
+    return impl->EncryptBlocks(ctx, input, output);
   }
-
-  return ErrorStatus::kSuccess;
+  return impl->DecryptBlocks(ctx, input, output);
 }
 
-}  // namespace bedrock::cipher::op_mode
\ No newline at end of file
+}  // namespace bedrock::cipher::op_mode
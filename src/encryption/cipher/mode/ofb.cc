@@ -0,0 +1,33 @@
+#include "encryption/cipher/mode/ofb.h"
+
+#include <algorithm>
+
+#include "encryption/util/helper.h"
+
+namespace bedrock::cipher::op_mode {
+
+ErrorStatus OFB::Process(
+    std::shared_ptr<bedrock::cipher::BlockCipherAlgorithm> impl,
+    ModeContext& ctx, const std::span<const std::uint8_t> input,
+    std::span<std::uint8_t> output, bool final) {
+  const std::size_t block_bytes = ctx.block_size / 8;
+  if (impl == nullptr || !ctx.IsValid() || block_bytes == 0 ||
+      input.size() % block_bytes != 0 || output.size() != input.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  for (std::size_t offset = 0; offset < input.size(); offset += block_bytes) {
+    if (impl->Encrypt(ctx, ctx.prev_vector, ctx.buffer) !=
+        ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+    ctx.prev_vector = ctx.buffer;
+
+    bedrock::util::XorInplace(ctx.buffer, input.subspan(offset, block_bytes));
+    std::ranges::copy(ctx.buffer, output.subspan(offset).begin());
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+}  // namespace bedrock::cipher::op_mode
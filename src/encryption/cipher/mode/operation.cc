@@ -5,8 +5,10 @@
 
 #include "encryption/cipher/aes.h"
 #include "encryption/cipher/mode/cbc.h"
+#include "encryption/cipher/mode/cfb.h"
 #include "encryption/cipher/mode/ctr.h"
 #include "encryption/cipher/mode/ecb.h"
+#include "encryption/cipher/mode/ofb.h"
 #include "encryption/cipher/mode/openssl.h"
 
 #include <config.h>
@@ -148,6 +150,31 @@ ErrorStatus ModeContext::SetMode(CipherMode mode_in, bool padding) noexcept {
 ModeContext::~ModeContext() = default;
 OperationMode::~OperationMode() = default;
 
+static std::shared_ptr<OperationMode> PickNativeImpl(const std::string& mode) {
+  if (mode == "CBC") {
+    return std::make_shared<CBC>();
+  }
+  if (mode == "CTR") {
+    return std::make_shared<CTR>();
+  }
+  if (mode == "ECB") {
+    return std::make_shared<ECB>();
+  }
+  if (mode == "CFB1") {
+    return std::make_shared<CFB>(1);
+  }
+  if (mode == "CFB8") {
+    return std::make_shared<CFB>(8);
+  }
+  if (mode == "CFB" || mode == "CFB128") {
+    return std::make_shared<CFB>(128);
+  }
+  if (mode == "OFB") {
+    return std::make_shared<OFB>();
+  }
+  return nullptr;
+}
+
 std::shared_ptr<OperationMode> PickImpl(const std::string& mode,
                                         bool use_openssl) {
   std::shared_ptr<OperationMode> impl;
@@ -156,25 +183,11 @@ std::shared_ptr<OperationMode> PickImpl(const std::string& mode,
   if (use_openssl) {
     impl = std::make_shared<OPENSSL>();
     impl->algorithm_name = mode;
-  } else if (mode == "CBC") {
-    impl = std::make_shared<CBC>();
-  } else if (mode == "CTR") {
-    impl = std::make_shared<CTR>();
-  } else if (mode == "ECB") {
-    impl = std::make_shared<ECB>();
   } else {
-    return nullptr;
+    impl = PickNativeImpl(mode);
   }
 #else
-  if (mode == "CBC") {
-    impl = std::make_shared<CBC>();
-  } else if (mode == "CTR") {
-    impl = std::make_shared<CTR>();
-  } else if (mode == "ECB") {
-    impl = std::make_shared<ECB>();
-  } else {
-    return nullptr;
-  }
+  impl = PickNativeImpl(mode);
 #endif
 
   return impl;
@@ -0,0 +1,206 @@
+#include "encryption/cipher/poly1305.h"
+
+#include <algorithm>
+
+#include "common/intrinsics.h"
+
+namespace bedrock::cipher {
+
+static bool Avx2Enabled() {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+  static bool enabled = bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2");
+  return enabled;
+}
+
+static constexpr std::uint32_t kLimbMask = 0x3ffffff;
+static constexpr std::uint32_t kHiBit = 1U << 24;
+// 이보다 짧으면 4-way 경로의 합치는 비용이 더 큼
+static constexpr std::size_t kAvx2MinBlocks = 8;
+
+static std::uint32_t LoadLittleEndian32(const std::uint8_t* p) {
+  return static_cast<std::uint32_t>(p[0]) |
+         (static_cast<std::uint32_t>(p[1]) << 8) |
+         (static_cast<std::uint32_t>(p[2]) << 16) |
+         (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+namespace poly1305 {
+
+void Multiply(std::uint32_t* h, const std::uint32_t* r) noexcept {
+  const std::uint64_t r0 = r[0];
+  const std::uint64_t r1 = r[1];
+  const std::uint64_t r2 = r[2];
+  const std::uint64_t r3 = r[3];
+  const std::uint64_t r4 = r[4];
+  // 2^130 = 5 (mod p) 이므로 넘치는 항은 5배 해서 아래로 접음
+  const std::uint64_t s1 = r1 * 5;
+  const std::uint64_t s2 = r2 * 5;
+  const std::uint64_t s3 = r3 * 5;
+  const std::uint64_t s4 = r4 * 5;
+  const std::uint64_t h0 = h[0];
+  const std::uint64_t h1 = h[1];
+  const std::uint64_t h2 = h[2];
+  const std::uint64_t h3 = h[3];
+  const std::uint64_t h4 = h[4];
+
+  std::uint64_t d0 = (h0 * r0) + (h1 * s4) + (h2 * s3) + (h3 * s2) + (h4 * s1);
+  std::uint64_t d1 = (h0 * r1) + (h1 * r0) + (h2 * s4) + (h3 * s3) + (h4 * s2);
+  std::uint64_t d2 = (h0 * r2) + (h1 * r1) + (h2 * r0) + (h3 * s4) + (h4 * s3);
+  std::uint64_t d3 = (h0 * r3) + (h1 * r2) + (h2 * r1) + (h3 * r0) + (h4 * s4);
+  std::uint64_t d4 = (h0 * r4) + (h1 * r3) + (h2 * r2) + (h3 * r1) + (h4 * r0);
+
+  d1 += d0 >> 26;
+  d2 += d1 >> 26;
+  d3 += d2 >> 26;
+  d4 += d3 >> 26;
+  const auto carry = static_cast<std::uint32_t>(d4 >> 26);
+  h[0] = static_cast<std::uint32_t>(d0) & kLimbMask;
+  h[1] = static_cast<std::uint32_t>(d1) & kLimbMask;
+  h[2] = static_cast<std::uint32_t>(d2) & kLimbMask;
+  h[3] = static_cast<std::uint32_t>(d3) & kLimbMask;
+  h[4] = static_cast<std::uint32_t>(d4) & kLimbMask;
+  h[0] += carry * 5;
+  h[1] += h[0] >> 26;
+  h[0] &= kLimbMask;
+}
+
+void BlocksScalar(std::uint32_t* h, const std::uint32_t* r,
+                  const std::uint8_t* data, std::size_t blocks,
+                  std::uint32_t hibit) noexcept {
+  for (std::size_t i = 0; i < blocks; ++i) {
+    const std::uint8_t* m = data + (i * 16);
+    h[0] += LoadLittleEndian32(m) & kLimbMask;
+    h[1] += (LoadLittleEndian32(m + 3) >> 2) & kLimbMask;
+    h[2] += (LoadLittleEndian32(m + 6) >> 4) & kLimbMask;
+    h[3] += (LoadLittleEndian32(m + 9) >> 6) & kLimbMask;
+    h[4] += (LoadLittleEndian32(m + 12) >> 8) | hibit;
+    Multiply(h, r);
+  }
+}
+
+}  // namespace poly1305
+
+Poly1305::Poly1305() : avx2_(Avx2Enabled()) {}
+
+ErrorStatus Poly1305::SetKey(std::span<const std::uint8_t> key) noexcept {
+  if (key.size() != kKeyBytes) {
+    return ErrorStatus::kFailure;
+  }
+
+  // r은 clamp 후 26-bit limb로 분해
+  auto& r = r_powers_[0];
+  r[0] = LoadLittleEndian32(key.data()) & 0x3ffffff;
+  r[1] = (LoadLittleEndian32(key.data() + 3) >> 2) & 0x3ffff03;
+  r[2] = (LoadLittleEndian32(key.data() + 6) >> 4) & 0x3ffc0ff;
+  r[3] = (LoadLittleEndian32(key.data() + 9) >> 6) & 0x3f03fff;
+  r[4] = (LoadLittleEndian32(key.data() + 12) >> 8) & 0x00fffff;
+  for (std::size_t i = 1; i < r_powers_.size(); ++i) {
+    r_powers_[i] = r_powers_[i - 1];
+    poly1305::Multiply(r_powers_[i].data(), r.data());
+  }
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    pad_[i] = LoadLittleEndian32(key.data() + 16 + (i * 4));
+  }
+  h_ = {};
+  buffered_ = 0;
+
+  return ErrorStatus::kSuccess;
+}
+
+void Poly1305::Blocks(const std::uint8_t* data, std::size_t blocks) noexcept {
+  if (avx2_ && blocks >= kAvx2MinBlocks) {
+    const std::size_t done =
+        poly1305::BlocksAvx2(h_.data(), r_powers_, data, blocks);
+    data += done * kBlockBytes;
+    blocks -= done;
+  }
+  poly1305::BlocksScalar(h_.data(), r_powers_[0].data(), data, blocks,
+                         kHiBit);
+}
+
+void Poly1305::Update(std::span<const std::uint8_t> data) noexcept {
+  std::size_t offset = 0;
+
+  if (buffered_ != 0) {
+    const std::size_t take = (std::min)(kBlockBytes - buffered_, data.size());
+    std::ranges::copy(data.first(take),
+                      std::span(buffer_).subspan(buffered_).begin());
+    buffered_ += take;
+    offset = take;
+    if (buffered_ < kBlockBytes) {
+      return;
+    }
+    Blocks(buffer_.data(), 1);
+    buffered_ = 0;
+  }
+
+  const std::size_t blocks = (data.size() - offset) / kBlockBytes;
+  if (blocks != 0) {
+    Blocks(data.data() + offset, blocks);
+    offset += blocks * kBlockBytes;
+  }
+
+  std::ranges::copy(data.subspan(offset), buffer_.begin());
+  buffered_ = data.size() - offset;
+}
+
+std::array<std::uint8_t, Poly1305::kTagBytes> Poly1305::Final() const noexcept {
+  std::array<std::uint32_t, 5> h = h_;
+
+  // 마지막 조각은 0x01을 붙이고 2^128 비트 없이 누산
+  if (buffered_ != 0) {
+    std::array<std::uint8_t, kBlockBytes> last{};
+    std::ranges::copy(std::span(buffer_).first(buffered_), last.begin());
+    last[buffered_] = 1;
+    poly1305::BlocksScalar(h.data(), r_powers_[0].data(), last.data(), 1, 0);
+  }
+
+  // 완전히 carry 전파
+  std::uint32_t carry = h[1] >> 26;
+  h[1] &= kLimbMask;
+  for (std::size_t i = 2; i < 5; ++i) {
+    h[i] += carry;
+    carry = h[i] >> 26;
+    h[i] &= kLimbMask;
+  }
+  h[0] += carry * 5;
+  carry = h[0] >> 26;
+  h[0] &= kLimbMask;
+  h[1] += carry;
+
+  // g = h - p 를 계산해 h >= p 이면 g를 선택 (상수 시간)
+  std::array<std::uint32_t, 5> g{};
+  g[0] = h[0] + 5;
+  carry = g[0] >> 26;
+  g[0] &= kLimbMask;
+  for (std::size_t i = 1; i < 4; ++i) {
+    g[i] = h[i] + carry;
+    carry = g[i] >> 26;
+    g[i] &= kLimbMask;
+  }
+  g[4] = h[4] + carry - (1U << 26);
+
+  const std::uint32_t select_g = (g[4] >> 31) - 1;
+  for (std::size_t i = 0; i < 5; ++i) {
+    h[i] = (h[i] & ~select_g) | (g[i] & select_g);
+  }
+
+  // 26-bit limb 5개를 32-bit 워드 4개로 모은 뒤 pad를 더함
+  const std::array<std::uint32_t, 4> words = {
+      h[0] | (h[1] << 26), (h[1] >> 6) | (h[2] << 20),
+      (h[2] >> 12) | (h[3] << 14), (h[3] >> 18) | (h[4] << 8)};
+
+  std::array<std::uint8_t, kTagBytes> tag{};
+  std::uint64_t sum = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    sum = static_cast<std::uint64_t>(words[i]) + pad_[i] + (sum >> 32);
+    for (std::size_t j = 0; j < 4; ++j) {
+      tag[(i * 4) + j] = static_cast<std::uint8_t>(sum >> (j * 8));
+    }
+  }
+  return tag;
+}
+
+}  // namespace bedrock::cipher
@@ -0,0 +1,143 @@
+#include <immintrin.h>
+
+#include <array>
+
+#include "encryption/cipher/poly1305.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::cipher::poly1305 {
+
+// 64-bit 레인마다 블록 하나의 26-bit limb
+struct Lanes {
+  __m256i limb[5];
+};
+
+static inline __m256i Mul(__m256i a, __m256i b) {
+  return _mm256_mul_epu32(a, b);
+}
+
+// 레인별로 h = h * r, s = 5 * r
+static inline void MultiplyLanes(Lanes& h, const Lanes& r, const Lanes& s) {
+  const __m256i* hl = h.limb;
+  const __m256i* rl = r.limb;
+  const __m256i* sl = s.limb;
+
+  __m256i d[5];
+  d[0] = _mm256_add_epi64(
+      _mm256_add_epi64(_mm256_add_epi64(Mul(hl[0], rl[0]), Mul(hl[1], sl[4])),
+                       _mm256_add_epi64(Mul(hl[2], sl[3]), Mul(hl[3], sl[2]))),
+      Mul(hl[4], sl[1]));
+  d[1] = _mm256_add_epi64(
+      _mm256_add_epi64(_mm256_add_epi64(Mul(hl[0], rl[1]), Mul(hl[1], rl[0])),
+                       _mm256_add_epi64(Mul(hl[2], sl[4]), Mul(hl[3], sl[3]))),
+      Mul(hl[4], sl[2]));
+  d[2] = _mm256_add_epi64(
+      _mm256_add_epi64(_mm256_add_epi64(Mul(hl[0], rl[2]), Mul(hl[1], rl[1])),
+                       _mm256_add_epi64(Mul(hl[2], rl[0]), Mul(hl[3], sl[4]))),
+      Mul(hl[4], sl[3]));
+  d[3] = _mm256_add_epi64(
+      _mm256_add_epi64(_mm256_add_epi64(Mul(hl[0], rl[3]), Mul(hl[1], rl[2])),
+                       _mm256_add_epi64(Mul(hl[2], rl[1]), Mul(hl[3], rl[0]))),
+      Mul(hl[4], sl[4]));
+  d[4] = _mm256_add_epi64(
+      _mm256_add_epi64(_mm256_add_epi64(Mul(hl[0], rl[4]), Mul(hl[1], rl[3])),
+                       _mm256_add_epi64(Mul(hl[2], rl[2]), Mul(hl[3], rl[1]))),
+      Mul(hl[4], rl[0]));
+
+  const __m256i mask = _mm256_set1_epi64x(0x3ffffff);
+  for (std::size_t i = 0; i < 4; ++i) {
+    d[i + 1] = _mm256_add_epi64(d[i + 1], _mm256_srli_epi64(d[i], 26));
+    h.limb[i] = _mm256_and_si256(d[i], mask);
+  }
+  const __m256i carry = _mm256_srli_epi64(d[4], 26);
+  h.limb[4] = _mm256_and_si256(d[4], mask);
+  h.limb[0] = _mm256_add_epi64(
+      h.limb[0], _mm256_add_epi64(carry, _mm256_slli_epi64(carry, 2)));
+  h.limb[1] = _mm256_add_epi64(h.limb[1], _mm256_srli_epi64(h.limb[0], 26));
+  h.limb[0] = _mm256_and_si256(h.limb[0], mask);
+}
+
+// 연속한 4개 블록을 레인 0~3에 limb로 분해해 더함
+static inline void AddBlocks(Lanes& h, const std::uint8_t* data) {
+  const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  const __m256i v1 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+  // unpack 결과가 블록 순서 [0, 2, 1, 3]이므로 permute로 바로잡음
+  const __m256i lo =
+      _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(v0, v1), 0xD8);
+  const __m256i hi =
+      _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(v0, v1), 0xD8);
+
+  const __m256i mask = _mm256_set1_epi64x(0x3ffffff);
+  const __m256i limb[5] = {
+      _mm256_and_si256(lo, mask),
+      _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask),
+      _mm256_and_si256(
+          _mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)),
+          mask),
+      _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask),
+      _mm256_or_si256(_mm256_srli_epi64(hi, 40), _mm256_set1_epi64x(1 << 24))};
+
+  for (std::size_t i = 0; i < 5; ++i) {
+    h.limb[i] = _mm256_add_epi64(h.limb[i], limb[i]);
+  }
+}
+
+std::size_t BlocksAvx2(std::uint32_t* h, const Poly1305::Powers& r_powers,
+                       const std::uint8_t* data, std::size_t blocks) noexcept {
+  const std::size_t groups = blocks / 4;
+  if (groups == 0) {
+    return 0;
+  }
+
+  // 레인 j는 블록 j, j+4, j+8, ... 를 r^4로 누산
+  Lanes r4{};
+  Lanes s4{};
+  for (std::size_t i = 0; i < 5; ++i) {
+    r4.limb[i] = _mm256_set1_epi64x(r_powers[3][i]);
+    s4.limb[i] = _mm256_set1_epi64x(static_cast<long long>(r_powers[3][i]) * 5);
+  }
+
+  Lanes acc{};
+  for (std::size_t i = 0; i < 5; ++i) {
+    acc.limb[i] = _mm256_setr_epi64x(h[i], 0, 0, 0);
+  }
+  AddBlocks(acc, data);
+  for (std::size_t group = 1; group < groups; ++group) {
+    MultiplyLanes(acc, r4, s4);
+    AddBlocks(acc, data + (group * 64));
+  }
+
+  // 마지막으로 레인 j에 r^(4-j)를 곱해 순차 처리와 같은 결과로 합침
+  Lanes r_tail{};
+  Lanes s_tail{};
+  for (std::size_t i = 0; i < 5; ++i) {
+    r_tail.limb[i] = _mm256_setr_epi64x(r_powers[3][i], r_powers[2][i],
+                                        r_powers[1][i], r_powers[0][i]);
+    s_tail.limb[i] = _mm256_add_epi64(r_tail.limb[i],
+                                      _mm256_slli_epi64(r_tail.limb[i], 2));
+  }
+  MultiplyLanes(acc, r_tail, s_tail);
+
+  std::array<std::uint64_t, 5> sum{};
+  for (std::size_t i = 0; i < 5; ++i) {
+    alignas(32) std::array<std::uint64_t, 4> lane{};
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane.data()), acc.limb[i]);
+    sum[i] = lane[0] + lane[1] + lane[2] + lane[3];
+  }
+  for (std::size_t i = 0; i < 4; ++i) {
+    sum[i + 1] += sum[i] >> 26;
+    sum[i] &= 0x3ffffff;
+  }
+  sum[0] += (sum[4] >> 26) * 5;
+  sum[4] &= 0x3ffffff;
+  sum[1] += sum[0] >> 26;
+  sum[0] &= 0x3ffffff;
+  for (std::size_t i = 0; i < 5; ++i) {
+    h[i] = static_cast<std::uint32_t>(sum[i]);
+  }
+
+  return groups * 4;
+}
+
+}  // namespace bedrock::cipher::poly1305
@@ -0,0 +1,366 @@
+#include "encryption/hash/file_hash.h"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace bedrock::hash {
+
+// 직접 I/O의 버퍼 주소 / 읽기 크기 정렬 단위
+static constexpr std::size_t kIoAlign = 4096;
+
+#ifdef _WIN32
+
+InputFile::~InputFile() {
+  if (mapping != nullptr) {
+    UnmapViewOfFile(mapping);
+  }
+  if (file_mapping != nullptr) {
+    CloseHandle(file_mapping);
+  }
+  if (file != nullptr) {
+    CloseHandle(file);
+  }
+}
+
+bool InputFile::Open(const std::filesystem::path& path) noexcept {
+  HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  file = handle;
+  regular = GetFileType(file) == FILE_TYPE_DISK;
+  LARGE_INTEGER bytes;
+  if (regular && GetFileSizeEx(file, &bytes)) {
+    size = static_cast<std::uint64_t>(bytes.QuadPart);
+  }
+  return true;
+}
+
+void InputFile::EnableDirect() noexcept {
+  HANDLE direct =
+      ReOpenFile(file, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                 FILE_FLAG_NO_BUFFERING | FILE_FLAG_SEQUENTIAL_SCAN);
+  if (direct != INVALID_HANDLE_VALUE) {
+    CloseHandle(file);
+    file = direct;
+  }
+}
+
+std::ptrdiff_t InputFile::Read(std::uint8_t* out,
+                               std::size_t bytes) noexcept {
+  DWORD read = 0;
+  const DWORD request =
+      static_cast<DWORD>(std::min<std::size_t>(bytes, 1U << 30));
+  if (!ReadFile(file, out, request, &read, nullptr)) {
+    return GetLastError() == ERROR_BROKEN_PIPE ? 0 : -1;
+  }
+  return static_cast<std::ptrdiff_t>(read);
+}
+
+std::ptrdiff_t InputFile::ReadAt(std::uint8_t* out, std::size_t bytes,
+                                 std::uint64_t offset) noexcept {
+  OVERLAPPED overlapped = {};
+  overlapped.Offset = static_cast<DWORD>(offset);
+  overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+  DWORD read = 0;
+  const DWORD request =
+      static_cast<DWORD>(std::min<std::size_t>(bytes, 1U << 30));
+  if (!ReadFile(file, out, request, &read, &overlapped)) {
+    return GetLastError() == ERROR_HANDLE_EOF ? 0 : -1;
+  }
+  return static_cast<std::ptrdiff_t>(read);
+}
+
+const std::uint8_t* InputFile::Map() noexcept {
+  if (mapping != nullptr || !regular || size == 0) {
+    return mapping;
+  }
+  file_mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (file_mapping == nullptr) {
+    return nullptr;
+  }
+  mapping = static_cast<const std::uint8_t*>(
+      MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0));
+  return mapping;
+}
+
+void InputFile::Prefetch(std::size_t offset, std::size_t bytes) noexcept {
+  WIN32_MEMORY_RANGE_ENTRY range = {
+      const_cast<std::uint8_t*>(mapping + offset), bytes};
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+#else
+
+InputFile::~InputFile() {
+  if (mapping != nullptr) {
+    munmap(const_cast<std::uint8_t*>(mapping), size);
+  }
+  if (file >= 0) {
+    close(file);
+  }
+}
+
+bool InputFile::Open(const std::filesystem::path& path) noexcept {
+  file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file < 0) {
+    return false;
+  }
+  struct stat info {};
+  if (fstat(file, &info) != 0) {
+    return false;
+  }
+  regular = S_ISREG(info.st_mode);
+  if (regular) {
+    size = static_cast<std::uint64_t>(info.st_size);
+    posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+  }
+  return true;
+}
+
+void InputFile::EnableDirect() noexcept {
+#ifdef O_DIRECT
+  const int flags = fcntl(file, F_GETFL);
+  if (flags >= 0) {
+    fcntl(file, F_SETFL, flags | O_DIRECT);
+  }
+#endif
+}
+
+std::ptrdiff_t InputFile::Read(std::uint8_t* out,
+                               std::size_t bytes) noexcept {
+  while (true) {
+    const ssize_t read_bytes = read(file, out, bytes);
+    if (read_bytes >= 0) {
+      return read_bytes;
+    }
+    if (errno == EINTR) {
+      continue;
+    }
+#ifdef O_DIRECT
+    // 직접 I/O 조건(정렬 등)을 못 맞추는 파일 시스템이면 일반 읽기로
+    const int flags = fcntl(file, F_GETFL);
+    if (errno == EINVAL && flags >= 0 && (flags & O_DIRECT) != 0 &&
+        fcntl(file, F_SETFL, flags & ~O_DIRECT) == 0) {
+      continue;
+    }
+#endif
+    return -1;
+  }
+}
+
+std::ptrdiff_t InputFile::ReadAt(std::uint8_t* out, std::size_t bytes,
+                                 std::uint64_t offset) noexcept {
+  while (true) {
+    const ssize_t read_bytes =
+        pread(file, out, bytes, static_cast<off_t>(offset));
+    if (read_bytes >= 0 || errno != EINTR) {
+      return read_bytes;
+    }
+  }
+}
+
+const std::uint8_t* InputFile::Map() noexcept {
+  if (mapping != nullptr || !regular || size == 0) {
+    return mapping;
+  }
+  void* p = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+  if (p == MAP_FAILED) {
+    return nullptr;
+  }
+  madvise(p, size, MADV_SEQUENTIAL);
+  mapping = static_cast<const std::uint8_t*>(p);
+  return mapping;
+}
+
+void InputFile::Prefetch(std::size_t offset, std::size_t bytes) noexcept {
+  madvise(const_cast<std::uint8_t*>(mapping + offset), bytes, MADV_WILLNEED);
+}
+
+#endif
+
+// 정렬된 읽기 버퍼
+struct AlignedBuffer {
+  explicit AlignedBuffer(std::size_t bytes) noexcept
+      : data(static_cast<std::uint8_t*>(::operator new(
+            bytes, std::align_val_t{kIoAlign}, std::nothrow))) {}
+  AlignedBuffer(const AlignedBuffer&) = delete;
+  AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+  ~AlignedBuffer() { ::operator delete(data, std::align_val_t{kIoAlign}); }
+
+  std::uint8_t* data;
+};
+
+// buffer를 가득 채우거나 파일 끝까지 읽음. 실패하면 -1
+static std::ptrdiff_t ReadFull(InputFile& file, std::uint8_t* buffer,
+                               std::size_t bytes) noexcept {
+  std::size_t filled = 0;
+  while (filled < bytes) {
+    const std::ptrdiff_t got = file.Read(buffer + filled, bytes - filled);
+    if (got < 0) {
+      return -1;
+    }
+    if (got == 0) {
+      break;
+    }
+    filled += static_cast<std::size_t>(got);
+  }
+  return static_cast<std::ptrdiff_t>(filled);
+}
+
+// 조각 하나에 들어가는 파일은 스레드 / 매핑 없이 호출 스레드에서 바로 읽음.
+// 버퍼는 chunk_bytes가 아니라 파일 크기에 맞추고, 한 단위 더 잡아 두어
+// 그사이 늘어난 파일은 버퍼가 가득 차는 것으로 알고 이어서 읽음
+static bool ReadInline(InputFile& file, ChunkSink sink,
+                       void* context) noexcept {
+  const std::size_t size = file.Size();
+  const std::size_t buffer_bytes =
+      ((size + kIoAlign - 1) & ~(kIoAlign - 1)) + kIoAlign;
+  AlignedBuffer buffer(buffer_bytes);
+  if (buffer.data == nullptr) {
+    return false;
+  }
+  while (true) {
+    const std::ptrdiff_t got = ReadFull(file, buffer.data, buffer_bytes);
+    if (got > 0) {
+      sink(context, {buffer.data, static_cast<std::size_t>(got)});
+    }
+    if (got < static_cast<std::ptrdiff_t>(buffer_bytes)) {
+      return got >= 0;
+    }
+  }
+}
+
+static bool ReadMapped(InputFile& file, std::size_t chunk_bytes,
+                       ChunkSink sink, void* context) noexcept {
+  const std::uint8_t* data = file.Map();
+  if (data == nullptr) {
+    return false;
+  }
+  // 커널 미리 읽기가 해시보다 한 조각 앞서 가도록 다음 조각을 미리 요청
+  const std::size_t size = file.Size();
+  for (std::size_t offset = 0; offset < size; offset += chunk_bytes) {
+    const std::size_t bytes = std::min(chunk_bytes, size - offset);
+    const std::size_t next = offset + bytes;
+    if (next < size) {
+      file.Prefetch(next, std::min(chunk_bytes, size - next));
+    }
+    sink(context, {data + offset, bytes});
+  }
+  return true;
+}
+
+// 읽기 스레드가 버퍼 두 개를 번갈아 채우고 호출 스레드가 순서대로 해시.
+// 짧게 찬 버퍼가 마지막
+static bool ReadPipelined(InputFile& file, std::size_t chunk_bytes,
+                          ChunkSink sink, void* context) noexcept {
+  AlignedBuffer first(chunk_bytes);
+  AlignedBuffer second(chunk_bytes);
+  if (first.data == nullptr || second.data == nullptr) {
+    return false;
+  }
+  const std::array<std::uint8_t*, 2> buffers = {first.data, second.data};
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::array<bool, 2> ready{};
+  std::array<std::ptrdiff_t, 2> filled{};
+
+  std::thread reader([&] {
+    for (std::size_t slot = 0;; slot ^= 1) {
+      {
+        std::unique_lock lock(mutex);
+        changed.wait(lock, [&] { return !ready[slot]; });
+      }
+      const std::ptrdiff_t got = ReadFull(file, buffers[slot], chunk_bytes);
+      {
+        std::lock_guard lock(mutex);
+        filled[slot] = got;
+        ready[slot] = true;
+      }
+      changed.notify_all();
+      if (got < static_cast<std::ptrdiff_t>(chunk_bytes)) {
+        return;
+      }
+    }
+  });
+
+  bool ok = true;
+  for (std::size_t slot = 0;; slot ^= 1) {
+    std::ptrdiff_t got = 0;
+    {
+      std::unique_lock lock(mutex);
+      changed.wait(lock, [&] { return ready[slot]; });
+      got = filled[slot];
+    }
+    if (got > 0) {
+      sink(context, {buffers[slot], static_cast<std::size_t>(got)});
+    }
+    {
+      std::lock_guard lock(mutex);
+      ready[slot] = false;
+    }
+    changed.notify_all();
+    if (got < static_cast<std::ptrdiff_t>(chunk_bytes)) {
+      ok = got >= 0;
+      break;
+    }
+  }
+  reader.join();
+  return ok;
+}
+
+bool ReadFileChunks(const std::filesystem::path& path,
+                    const FileReadOptions& options, ChunkSink sink,
+                    void* context) noexcept {
+  InputFile file;
+  if (sink == nullptr || !file.Open(path)) {
+    return false;
+  }
+  const std::size_t chunk_bytes =
+      (std::max<std::size_t>(options.chunk_bytes, 1) + kIoAlign - 1) &
+      ~(kIoAlign - 1);
+
+  FileReadMode mode = options.mode;
+  if (mode == FileReadMode::kAuto) {
+    if (!file.Regular() || file.Size() > options.map_limit) {
+      mode = FileReadMode::kPipeline;
+    } else if (file.Size() > chunk_bytes) {
+      mode = FileReadMode::kMap;
+    } else {
+      return ReadInline(file, sink, context);
+    }
+  }
+
+  if (mode == FileReadMode::kMap) {
+    if (!file.Regular()) {
+      return false;
+    }
+    return file.Size() == 0 || ReadMapped(file, chunk_bytes, sink, context);
+  }
+  if (options.direct_io) {
+    file.EnableDirect();
+  }
+  return ReadPipelined(file, chunk_bytes, sink, context);
+}
+
+}  // namespace bedrock::hash
@@ -0,0 +1,235 @@
+#include "encryption/hash/hkdf.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha256_multi.h"
+
+namespace bedrock::hash {
+
+enum HkdfIntrinSet { kAVX2, kAVX512F };
+
+static bool IntrinEnabled(HkdfIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 2> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX512F")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    case kAVX512F:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+static bool ValidOutput(std::span<const std::uint8_t> out) noexcept {
+  return !out.empty() && out.size() <= HkdfSha256::kMaxOutputBytes;
+}
+
+HkdfSha256::Prk HkdfSha256::Extract(
+    std::span<const std::uint8_t> salt,
+    std::span<const std::uint8_t> ikm) noexcept {
+  return HmacSha256(salt).Mac(ikm);
+}
+
+HkdfSha256::HkdfSha256(std::span<const std::uint8_t> prk) noexcept
+    : key(prk) {}
+
+bool HkdfSha256::Expand(std::span<const std::uint8_t> info,
+                        std::span<std::uint8_t> out) const noexcept {
+  if (!ValidOutput(out)) {
+    return false;
+  }
+
+  // T(i) = HMAC(PRK, T(i - 1) || info || i), T(0)은 빈 문자열
+  HmacSha256 mac = key;
+  HmacSha256::Tag t{};
+  for (std::size_t offset = 0, i = 1; offset < out.size();
+       offset += t.size(), ++i) {
+    if (i > 1) {
+      mac.Update(t);
+    }
+    mac.Update(info);
+    const std::uint8_t counter[1] = {static_cast<std::uint8_t>(i)};
+    mac.Update(counter);
+    t = mac.Final();
+    const std::size_t take = std::min(t.size(), out.size() - offset);
+    std::memcpy(out.data() + offset, t.data(), take);
+  }
+  return true;
+}
+
+using LanesFn = void (*)(std::uint32_t* state,
+                         const std::uint8_t* const* blocks) noexcept;
+
+// 요청 하나의 Expand 연쇄. 메시지(T(i - 1) || info || i)를 이어 붙이지 않고
+// 조각에서 바로 블록을 채우며, 안쪽 해시가 끝나면 같은 레인에서 바깥쪽
+// 해시, 그다음 T(i + 1)의 안쪽 해시로 이어 감
+struct ExpandJob {
+  std::span<const std::uint8_t> info;
+  std::span<std::uint8_t> out;
+  std::size_t counter = 0;
+  bool outer = false;
+  HmacSha256::Tag previous{};
+  HmacSha256::Tag inner_digest{};
+  std::array<std::span<const std::uint8_t>, 3> pieces{};
+  std::uint8_t counter_byte = 0;
+
+  std::size_t message_bytes = 0;
+  std::size_t blocks = 0;
+  std::size_t block_index = 0;
+  std::array<std::uint8_t, sha256::kBlockBytes> block{};
+
+  void Start(const HkdfExpandRequest& expand) noexcept {
+    info = expand.info;
+    out = expand.out;
+    counter = 1;
+    StartInner();
+  }
+
+  void StartInner() noexcept {
+    outer = false;
+    counter_byte = static_cast<std::uint8_t>(counter);
+    pieces = {std::span<const std::uint8_t>(previous).first(
+                  counter > 1 ? previous.size() : 0),
+              info, std::span<const std::uint8_t>(&counter_byte, 1)};
+    Begin();
+  }
+
+  void StartOuter(const HmacSha256::Tag& digest) noexcept {
+    outer = true;
+    inner_digest = digest;
+    pieces = {std::span<const std::uint8_t>(inner_digest), {}, {}};
+    Begin();
+  }
+
+  void Begin() noexcept {
+    message_bytes = 0;
+    for (const auto& piece : pieces) {
+      message_bytes += piece.size();
+    }
+    blocks = (message_bytes + 8) / sha256::kBlockBytes + 1;
+    block_index = 0;
+  }
+
+  // 블록 block_index를 조각 + 패딩으로 채움. 길이는 ipad 블록을 포함
+  const std::uint8_t* NextBlock() noexcept {
+    const std::size_t start = block_index * sha256::kBlockBytes;
+    block.fill(0);
+    std::size_t offset = 0;
+    for (const auto& piece : pieces) {
+      const std::size_t begin = std::max(start, offset);
+      const std::size_t end =
+          std::min(start + sha256::kBlockBytes, offset + piece.size());
+      if (begin < end) {
+        std::memcpy(block.data() + (begin - start),
+                    piece.data() + (begin - offset), end - begin);
+      }
+      offset += piece.size();
+    }
+    if (message_bytes >= start &&
+        message_bytes < start + sha256::kBlockBytes) {
+      block[message_bytes - start] = 0x80;
+    }
+    if (++block_index == blocks) {
+      const std::uint64_t bits =
+          (std::uint64_t{sha256::kBlockBytes} + message_bytes) * 8;
+      sha256::StoreBigEndian32(block.data() + 56,
+                               static_cast<std::uint32_t>(bits >> 32));
+      sha256::StoreBigEndian32(block.data() + 60,
+                               static_cast<std::uint32_t>(bits));
+    }
+    return block.data();
+  }
+
+  [[nodiscard]] bool Done() const noexcept { return block_index == blocks; }
+};
+
+template <std::size_t kLanes>
+static void ExpandLanes(const HmacSha256& key,
+                        std::span<const HkdfExpandRequest> requests,
+                        LanesFn compress) {
+  static constexpr std::array<std::uint8_t, sha256::kBlockBytes> kIdleBlock{};
+
+  std::array<std::uint32_t, 8 * kLanes> state{};
+  std::size_t next = 0;
+
+  const auto load_state = [&](std::size_t lane, const sha256::State& h) {
+    for (std::size_t word = 0; word < 8; ++word) {
+      state[(word * kLanes) + lane] = h[word];
+    }
+  };
+
+  sha256::RunLanes<kLanes, ExpandJob>(
+      kIdleBlock.data(),
+      [&](std::size_t lane, ExpandJob& job) {
+        if (next == requests.size()) {
+          return false;
+        }
+        job.Start(requests[next++]);
+        load_state(lane, key.InnerMidstate());
+        return true;
+      },
+      [&](const std::uint8_t* const* blocks) {
+        compress(state.data(), blocks);
+      },
+      [&](std::size_t lane, ExpandJob& job) {
+        HmacSha256::Tag digest;
+        for (std::size_t word = 0; word < 8; ++word) {
+          sha256::StoreBigEndian32(digest.data() + (word * 4),
+                                   state[(word * kLanes) + lane]);
+        }
+        if (!job.outer) {
+          job.StartOuter(digest);
+          load_state(lane, key.OuterMidstate());
+          return true;
+        }
+
+        const std::size_t offset = (job.counter - 1) * digest.size();
+        const std::size_t take =
+            std::min(digest.size(), job.out.size() - offset);
+        std::memcpy(job.out.data() + offset, digest.data(), take);
+        if (offset + take == job.out.size()) {
+          return false;
+        }
+        job.previous = digest;
+        ++job.counter;
+        job.StartInner();
+        load_state(lane, key.InnerMidstate());
+        return true;
+      });
+}
+
+bool HkdfSha256::ExpandMany(
+    std::span<const HkdfExpandRequest> requests) const noexcept {
+  if (!std::ranges::all_of(requests, [](const HkdfExpandRequest& request) {
+        return ValidOutput(request.out);
+      })) {
+    return false;
+  }
+
+  if (requests.size() > 1 && IntrinEnabled(kAVX512F) && IntrinEnabled(kAVX2)) {
+    ExpandLanes<16>(key, requests, sha256::CompressLanesAvx512);
+  } else if (requests.size() > 1 && IntrinEnabled(kAVX2)) {
+    ExpandLanes<8>(key, requests, sha256::CompressLanesAvx2);
+  } else {
+    for (const HkdfExpandRequest& request : requests) {
+      Expand(request.info, request.out);
+    }
+  }
+  return true;
+}
+
+bool Hkdf(std::span<const std::uint8_t> salt, std::span<const std::uint8_t> ikm,
+          std::span<const std::uint8_t> info,
+          std::span<std::uint8_t> out) noexcept {
+  return HkdfSha256(HkdfSha256::Extract(salt, ikm)).Expand(info, out);
+}
+
+}  // namespace bedrock::hash
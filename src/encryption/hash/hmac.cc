@@ -0,0 +1,266 @@
+#include "encryption/hash/hmac.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha256_multi.h"
+
+namespace bedrock::hash {
+
+enum HmacIntrinSet { kAVX2, kAVX512F };
+
+static bool IntrinEnabled(HmacIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 2> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX512F")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    case kAVX512F:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+// 블록 미만 조각 rest를 패딩해 압축하고 다이제스트를 냄
+static HmacSha256::Tag Finish(sha256::State h,
+                              std::span<const std::uint8_t> rest,
+                              std::uint64_t total_bytes) noexcept {
+  sha256::TailBlocks tail;
+  const std::size_t blocks =
+      sha256::PadTail(tail, rest.data(), rest.size(), total_bytes);
+  sha256::CompressBlocks(h, tail.data(), blocks);
+
+  HmacSha256::Tag digest;
+  for (std::size_t i = 0; i < 8; i++) {
+    sha256::StoreBigEndian32(digest.data() + (i * 4), h[i]);
+  }
+  return digest;
+}
+
+static bool ConstantTimeEqual(const HmacSha256::Tag& expected,
+                              std::span<const std::uint8_t> tag) noexcept {
+  if (tag.size() != expected.size()) {
+    return false;
+  }
+  std::uint8_t diff = 0;
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    diff = static_cast<std::uint8_t>(diff | (expected[i] ^ tag[i]));
+  }
+  return diff == 0;
+}
+
+HmacSha256::HmacSha256(std::span<const std::uint8_t> key) noexcept {
+  // 블록보다 긴 키는 해시한 값을 키로 사용 (RFC 2104)
+  std::array<std::uint8_t, sha256::kBlockBytes> key_block{};
+  if (key.size() > sha256::kBlockBytes) {
+    sha256::State h = sha256::kH0;
+    const std::size_t full = key.size() / sha256::kBlockBytes;
+    sha256::CompressBlocks(h, key.data(), full);
+    const Tag digest =
+        Finish(h, key.subspan(full * sha256::kBlockBytes), key.size());
+    std::ranges::copy(digest, key_block.begin());
+  } else {
+    std::ranges::copy(key, key_block.begin());
+  }
+
+  std::array<std::uint8_t, sha256::kBlockBytes> pad{};
+  inner_midstate = sha256::kH0;
+  outer_midstate = sha256::kH0;
+  for (std::size_t i = 0; i < pad.size(); i++) {
+    pad[i] = static_cast<std::uint8_t>(key_block[i] ^ 0x36U);
+  }
+  sha256::CompressBlocks(inner_midstate, pad.data(), 1);
+  for (std::size_t i = 0; i < pad.size(); i++) {
+    pad[i] = static_cast<std::uint8_t>(key_block[i] ^ 0x5cU);
+  }
+  sha256::CompressBlocks(outer_midstate, pad.data(), 1);
+
+  Reset();
+}
+
+HmacSha256::Tag HmacSha256::Mac(
+    std::span<const std::uint8_t> message) const noexcept {
+  sha256::State h = inner_midstate;
+  const std::size_t full = message.size() / sha256::kBlockBytes;
+  sha256::CompressBlocks(h, message.data(), full);
+  const Tag inner_digest =
+      Finish(h, message.subspan(full * sha256::kBlockBytes),
+             sha256::kBlockBytes + message.size());
+  return Finish(outer_midstate, inner_digest,
+                sha256::kBlockBytes + kTagBytes);
+}
+
+bool HmacSha256::Verify(std::span<const std::uint8_t> message,
+                        std::span<const std::uint8_t> tag) const noexcept {
+  return ConstantTimeEqual(Mac(message), tag);
+}
+
+void HmacSha256::Update(std::span<const std::uint8_t> data) noexcept {
+  if (data.empty()) {
+    return;
+  }
+  message_bytes += data.size();
+
+  if (buffered > 0) {
+    const std::size_t take =
+        std::min(sha256::kBlockBytes - buffered, data.size());
+    std::memcpy(buffer.data() + buffered, data.data(), take);
+    buffered += take;
+    data = data.subspan(take);
+    if (buffered < sha256::kBlockBytes) {
+      return;
+    }
+    sha256::CompressBlocks(inner, buffer.data(), 1);
+  }
+
+  const std::size_t blocks = data.size() / sha256::kBlockBytes;
+  sha256::CompressBlocks(inner, data.data(), blocks);
+  data = data.subspan(blocks * sha256::kBlockBytes);
+
+  std::ranges::copy(data, buffer.begin());
+  buffered = data.size();
+}
+
+HmacSha256::Tag HmacSha256::Final() noexcept {
+  const Tag inner_digest = Finish(inner, std::span(buffer).first(buffered),
+                                  sha256::kBlockBytes + message_bytes);
+  Reset();
+  return Finish(outer_midstate, inner_digest,
+                sha256::kBlockBytes + kTagBytes);
+}
+
+void HmacSha256::Reset() noexcept {
+  inner = inner_midstate;
+  buffered = 0;
+  message_bytes = 0;
+}
+
+using LanesFn = void (*)(std::uint32_t* state,
+                         const std::uint8_t* const* blocks) noexcept;
+
+// 항목 하나의 블록 공급. 안쪽 해시가 끝나면 그 다이제스트로 바깥쪽 블록을
+// 만들어 같은 레인에서 이어 감
+struct VerifyJob {
+  std::size_t item = 0;
+  bool outer = false;
+  const std::uint8_t* data = nullptr;
+  std::size_t full_blocks = 0;
+  std::size_t tail_blocks = 0;
+  std::size_t tail_index = 0;
+  sha256::TailBlocks tail{};
+
+  void Start(std::size_t index,
+             std::span<const std::uint8_t> message) noexcept {
+    item = index;
+    outer = false;
+    data = message.data();
+    full_blocks = message.size() / sha256::kBlockBytes;
+    tail_blocks = sha256::PadTail(
+        tail, message.data() + (full_blocks * sha256::kBlockBytes),
+        message.size() % sha256::kBlockBytes,
+        sha256::kBlockBytes + message.size());
+    tail_index = 0;
+  }
+
+  void StartOuter(const HmacSha256::Tag& inner_digest) noexcept {
+    outer = true;
+    full_blocks = 0;
+    tail_blocks = sha256::PadTail(tail, inner_digest.data(),
+                                  inner_digest.size(),
+                                  sha256::kBlockBytes + inner_digest.size());
+    tail_index = 0;
+  }
+
+  const std::uint8_t* NextBlock() noexcept {
+    if (full_blocks > 0) {
+      const std::uint8_t* block = data;
+      data += sha256::kBlockBytes;
+      --full_blocks;
+      return block;
+    }
+    return tail.data() + (sha256::kBlockBytes * tail_index++);
+  }
+
+  [[nodiscard]] bool Done() const noexcept {
+    return full_blocks == 0 && tail_index == tail_blocks;
+  }
+};
+
+template <std::size_t kLanes>
+static void VerifyLanes(std::span<const HmacVerifyItem> items,
+                        std::span<bool> valid, LanesFn compress) {
+  static constexpr std::array<std::uint8_t, sha256::kBlockBytes> kIdleBlock{};
+
+  std::array<std::uint32_t, 8 * kLanes> state{};
+  std::size_t next = 0;
+
+  const auto load_state = [&](std::size_t lane, const sha256::State& h) {
+    for (std::size_t word = 0; word < 8; ++word) {
+      state[(word * kLanes) + lane] = h[word];
+    }
+  };
+
+  sha256::RunLanes<kLanes, VerifyJob>(
+      kIdleBlock.data(),
+      [&](std::size_t lane, VerifyJob& job) {
+        for (; next < items.size(); ++next) {
+          // 키가 없거나 태그 길이가 틀린 항목은 레인에 올리지 않음
+          const HmacVerifyItem& item = items[next];
+          if (item.key == nullptr ||
+              item.tag.size() != HmacSha256::kTagBytes) {
+            valid[next] = false;
+            continue;
+          }
+          job.Start(next++, item.message);
+          load_state(lane, item.key->InnerMidstate());
+          return true;
+        }
+        return false;
+      },
+      [&](const std::uint8_t* const* blocks) {
+        compress(state.data(), blocks);
+      },
+      [&](std::size_t lane, VerifyJob& job) {
+        HmacSha256::Tag digest;
+        for (std::size_t word = 0; word < 8; ++word) {
+          sha256::StoreBigEndian32(digest.data() + (word * 4),
+                                   state[(word * kLanes) + lane]);
+        }
+        const HmacVerifyItem& item = items[job.item];
+        if (!job.outer) {
+          job.StartOuter(digest);
+          load_state(lane, item.key->OuterMidstate());
+          return true;
+        }
+        valid[job.item] = ConstantTimeEqual(digest, item.tag);
+        return false;
+      });
+}
+
+bool VerifyMany(std::span<const HmacVerifyItem> items,
+                std::span<bool> valid) noexcept {
+  if (valid.size() < items.size()) {
+    return false;
+  }
+
+  if (items.size() > 1 && IntrinEnabled(kAVX512F) && IntrinEnabled(kAVX2)) {
+    VerifyLanes<16>(items, valid, sha256::CompressLanesAvx512);
+  } else if (items.size() > 1 && IntrinEnabled(kAVX2)) {
+    VerifyLanes<8>(items, valid, sha256::CompressLanesAvx2);
+  } else {
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      valid[i] = items[i].key != nullptr &&
+                 items[i].key->Verify(items[i].message, items[i].tag);
+    }
+  }
+  return true;
+}
+
+}  // namespace bedrock::hash
@@ -0,0 +1,84 @@
+#include <immintrin.h>
+
+#include "encryption/hash/keccak_core.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::keccak {
+
+static inline __m256i Rotl(__m256i x, std::uint32_t n) {
+  return _mm256_or_si256(_mm256_slli_epi64(x, static_cast<int>(n)),
+                         _mm256_srli_epi64(x, static_cast<int>(64 - n)));
+}
+
+static inline __m256i Xor5(__m256i a, __m256i b, __m256i c, __m256i d,
+                           __m256i e) {
+  return _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a, b), c),
+                          _mm256_xor_si256(d, e));
+}
+
+// 스칼라 Permute와 같은 단계를 레인 4개에 그대로 적용
+void PermuteX4Avx2(std::uint64_t* states) noexcept {
+  __m256i a[25];
+  for (std::size_t i = 0; i < 25; ++i) {
+    a[i] = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(states + (i * 4)));
+  }
+
+  for (std::size_t round = 0; round < kRounds; ++round) {
+    __m256i c[5];
+    for (std::size_t x = 0; x < 5; ++x) {
+      c[x] = Xor5(a[x], a[x + 5], a[x + 10], a[x + 15], a[x + 20]);
+    }
+    __m256i d[5];
+    for (std::size_t x = 0; x < 5; ++x) {
+      d[x] = _mm256_xor_si256(c[(x + 4) % 5], Rotl(c[(x + 1) % 5], 1));
+    }
+
+    // ρ, π (keccak_core.h의 Permute와 같은 배치)
+    __m256i b[25];
+    b[0] = _mm256_xor_si256(a[0], d[0]);
+    b[10] = Rotl(_mm256_xor_si256(a[1], d[1]), 1);
+    b[20] = Rotl(_mm256_xor_si256(a[2], d[2]), 62);
+    b[5] = Rotl(_mm256_xor_si256(a[3], d[3]), 28);
+    b[15] = Rotl(_mm256_xor_si256(a[4], d[4]), 27);
+    b[16] = Rotl(_mm256_xor_si256(a[5], d[0]), 36);
+    b[1] = Rotl(_mm256_xor_si256(a[6], d[1]), 44);
+    b[11] = Rotl(_mm256_xor_si256(a[7], d[2]), 6);
+    b[21] = Rotl(_mm256_xor_si256(a[8], d[3]), 55);
+    b[6] = Rotl(_mm256_xor_si256(a[9], d[4]), 20);
+    b[7] = Rotl(_mm256_xor_si256(a[10], d[0]), 3);
+    b[17] = Rotl(_mm256_xor_si256(a[11], d[1]), 10);
+    b[2] = Rotl(_mm256_xor_si256(a[12], d[2]), 43);
+    b[12] = Rotl(_mm256_xor_si256(a[13], d[3]), 25);
+    b[22] = Rotl(_mm256_xor_si256(a[14], d[4]), 39);
+    b[23] = Rotl(_mm256_xor_si256(a[15], d[0]), 41);
+    b[8] = Rotl(_mm256_xor_si256(a[16], d[1]), 45);
+    b[18] = Rotl(_mm256_xor_si256(a[17], d[2]), 15);
+    b[3] = Rotl(_mm256_xor_si256(a[18], d[3]), 21);
+    b[13] = Rotl(_mm256_xor_si256(a[19], d[4]), 8);
+    b[14] = Rotl(_mm256_xor_si256(a[20], d[0]), 18);
+    b[24] = Rotl(_mm256_xor_si256(a[21], d[1]), 2);
+    b[9] = Rotl(_mm256_xor_si256(a[22], d[2]), 61);
+    b[19] = Rotl(_mm256_xor_si256(a[23], d[3]), 56);
+    b[4] = Rotl(_mm256_xor_si256(a[24], d[4]), 14);
+
+    // χ
+    for (std::size_t y = 0; y < 25; y += 5) {
+      for (std::size_t x = 0; x < 5; ++x) {
+        a[y + x] = _mm256_xor_si256(
+            b[y + x],
+            _mm256_andnot_si256(b[y + ((x + 1) % 5)], b[y + ((x + 2) % 5)]));
+      }
+    }
+
+    a[0] = _mm256_xor_si256(
+        a[0],
+        _mm256_set1_epi64x(static_cast<long long>(kRoundConstants[round])));
+  }
+
+  for (std::size_t i = 0; i < 25; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + (i * 4)), a[i]);
+  }
+}
+
+}  // namespace bedrock::hash::keccak
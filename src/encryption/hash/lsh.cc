@@ -0,0 +1,71 @@
+#include <array>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/lsh_core.h"
+
+namespace bedrock::hash::lsh {
+
+enum LshIntrinSet { kAVX2 };
+
+static bool IntrinEnabled(LshIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 1> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+template <typename Word>
+using CompressFn = void (*)(ChainVar<Word>& cv, const std::uint8_t* data,
+                            std::size_t blocks) noexcept;
+
+template <typename Word>
+static CompressFn<Word> PickCompress() {
+  if (IntrinEnabled(kAVX2)) {
+    return CompressBlocksAvx2;
+  }
+  return CompressBlocksScalar;
+}
+
+template <typename Word>
+static void CompressScalar(ChainVar<Word>& cv, const std::uint8_t* data,
+                           std::size_t blocks) {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    CompressBytes(cv, data + (block * kBlockBytes<Word>));
+  }
+}
+
+void CompressBlocksScalar(ChainVar<std::uint32_t>& cv,
+                          const std::uint8_t* data,
+                          std::size_t blocks) noexcept {
+  CompressScalar(cv, data, blocks);
+}
+
+void CompressBlocksScalar(ChainVar<std::uint64_t>& cv,
+                          const std::uint8_t* data,
+                          std::size_t blocks) noexcept {
+  CompressScalar(cv, data, blocks);
+}
+
+void CompressBlocks(ChainVar<std::uint32_t>& cv, const std::uint8_t* data,
+                    std::size_t blocks) noexcept {
+  static const CompressFn<std::uint32_t> compress =
+      PickCompress<std::uint32_t>();
+  compress(cv, data, blocks);
+}
+
+void CompressBlocks(ChainVar<std::uint64_t>& cv, const std::uint8_t* data,
+                    std::size_t blocks) noexcept {
+  static const CompressFn<std::uint64_t> compress =
+      PickCompress<std::uint64_t>();
+  compress(cv, data, blocks);
+}
+
+}  // namespace bedrock::hash::lsh
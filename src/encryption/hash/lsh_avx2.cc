@@ -0,0 +1,319 @@
+#include <immintrin.h>
+
+#include "encryption/hash/lsh_core.h"
+#include "encryption/hash/lsh_multi.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::lsh {
+
+static inline __m256i Load(const void* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+static inline void Store(void* p, __m256i x) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x);
+}
+
+template <std::uint32_t kBits>
+static inline __m256i Rotl32(__m256i x) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, static_cast<int>(kBits)),
+                         _mm256_srli_epi32(x, static_cast<int>(32 - kBits)));
+}
+
+template <std::uint32_t kBits>
+static inline __m256i Rotl64(__m256i x) {
+  return _mm256_or_si256(_mm256_slli_epi64(x, static_cast<int>(kBits)),
+                         _mm256_srli_epi64(x, static_cast<int>(64 - kBits)));
+}
+
+// ---- LSH-256: 왼쪽 / 오른쪽 절반이 ymm 하나씩 ----
+
+// γ 회전은 모두 8비트 배수라 워드별 바이트 셔플 하나로
+template <std::size_t kParity>
+static inline void Step256(__m256i& left, __m256i& right, __m256i msg_left,
+                           __m256i msg_right, const std::uint32_t* sc,
+                           __m256i gamma) {
+  using P = Params<std::uint32_t>;
+  __m256i x = _mm256_xor_si256(left, msg_left);
+  __m256i y = _mm256_xor_si256(right, msg_right);
+  x = Rotl32<P::kAlpha[kParity]>(_mm256_add_epi32(x, y));
+  x = _mm256_xor_si256(x, Load(sc));
+  y = Rotl32<P::kBeta[kParity]>(_mm256_add_epi32(x, y));
+  x = _mm256_add_epi32(x, y);
+  y = _mm256_shuffle_epi8(y, gamma);
+
+  // σ: 새 왼쪽 = [L6 L4 L5 L7 R4 R7 R6 R5], 새 오른쪽 = [L2 L0 L1 L3 R0 R3 R2 R1]
+  const __m256i perm = _mm256_setr_epi32(2, 0, 1, 3, 4, 7, 6, 5);
+  left = _mm256_permutevar8x32_epi32(_mm256_permute2x128_si256(x, y, 0x31),
+                                     perm);
+  right = _mm256_permutevar8x32_epi32(_mm256_permute2x128_si256(x, y, 0x20),
+                                      perm);
+}
+
+// τ는 4워드 묶음 안에서 (3,2,0,1) / (3,0,1,2)
+static inline __m256i Expand256(__m256i older, __m256i newer) {
+  const __m256i tau = _mm256_setr_epi32(3, 2, 0, 1, 7, 4, 5, 6);
+  return _mm256_add_epi32(newer, _mm256_permutevar8x32_epi32(older, tau));
+}
+
+void CompressBlocksAvx2(ChainVar<std::uint32_t>& cv, const std::uint8_t* data,
+                        std::size_t blocks) noexcept {
+  constexpr auto& sc = kStepConstants<std::uint32_t>;
+  const __m256i gamma = _mm256_setr_epi8(
+      0, 1, 2, 3, 7, 4, 5, 6, 10, 11, 8, 9, 13, 14, 15, 12, 1, 2, 3, 0, 6, 7,
+      4, 5, 11, 8, 9, 10, 12, 13, 14, 15);
+
+  __m256i left = Load(cv.data());
+  __m256i right = Load(cv.data() + 8);
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const std::uint8_t* in = data + (block * kBlockBytes<std::uint32_t>);
+    __m256i even_left = Load(in);
+    __m256i even_right = Load(in + 32);
+    __m256i odd_left = Load(in + 64);
+    __m256i odd_right = Load(in + 96);
+
+    Step256<0>(left, right, even_left, even_right, sc.data(), gamma);
+    Step256<1>(left, right, odd_left, odd_right, sc.data() + 8, gamma);
+    for (std::size_t j = 2; j < Params<std::uint32_t>::kSteps; j += 2) {
+      even_left = Expand256(even_left, odd_left);
+      even_right = Expand256(even_right, odd_right);
+      Step256<0>(left, right, even_left, even_right, sc.data() + (j * 8),
+                 gamma);
+      odd_left = Expand256(odd_left, even_left);
+      odd_right = Expand256(odd_right, even_right);
+      Step256<1>(left, right, odd_left, odd_right, sc.data() + ((j + 1) * 8),
+                 gamma);
+    }
+    left = _mm256_xor_si256(left, Expand256(even_left, odd_left));
+    right = _mm256_xor_si256(right, Expand256(even_right, odd_right));
+  }
+  Store(cv.data(), left);
+  Store(cv.data() + 8, right);
+}
+
+// ---- LSH-512: 연결 변수 4워드씩 ymm 네 개 (l0 l1 r0 r1) ----
+
+template <std::size_t kParity>
+static inline void Step512(__m256i* cv, const __m256i* msg,
+                           const std::uint64_t* sc, const __m256i* gamma) {
+  using P = Params<std::uint64_t>;
+  __m256i x[2];
+  __m256i y[2];
+  for (std::size_t half = 0; half < 2; ++half) {
+    x[half] = _mm256_xor_si256(cv[half], msg[half]);
+    y[half] = _mm256_xor_si256(cv[half + 2], msg[half + 2]);
+    x[half] = Rotl64<P::kAlpha[kParity]>(_mm256_add_epi64(x[half], y[half]));
+    x[half] = _mm256_xor_si256(x[half], Load(sc + (half * 4)));
+    y[half] = Rotl64<P::kBeta[kParity]>(_mm256_add_epi64(x[half], y[half]));
+    x[half] = _mm256_add_epi64(x[half], y[half]);
+    y[half] = _mm256_shuffle_epi8(y[half], gamma[half]);
+  }
+
+  // σ: l0 = [L6 L4 L5 L7], l1 = [R4 R7 R6 R5], r0 = [L2 L0 L1 L3],
+  // r1 = [R0 R3 R2 R1]
+  cv[0] = _mm256_permute4x64_epi64(x[1], _MM_SHUFFLE(3, 1, 0, 2));
+  cv[1] = _mm256_permute4x64_epi64(y[1], _MM_SHUFFLE(1, 2, 3, 0));
+  cv[2] = _mm256_permute4x64_epi64(x[0], _MM_SHUFFLE(3, 1, 0, 2));
+  cv[3] = _mm256_permute4x64_epi64(y[0], _MM_SHUFFLE(1, 2, 3, 0));
+}
+
+static inline void Expand512(__m256i* older, const __m256i* newer) {
+  for (std::size_t i = 0; i < 4; i += 2) {
+    older[i] = _mm256_add_epi64(
+        newer[i], _mm256_permute4x64_epi64(older[i], _MM_SHUFFLE(1, 0, 2, 3)));
+    older[i + 1] = _mm256_add_epi64(
+        newer[i + 1],
+        _mm256_permute4x64_epi64(older[i + 1], _MM_SHUFFLE(2, 1, 0, 3)));
+  }
+}
+
+void CompressBlocksAvx2(ChainVar<std::uint64_t>& cv, const std::uint8_t* data,
+                        std::size_t blocks) noexcept {
+  constexpr auto& sc = kStepConstants<std::uint64_t>;
+  const __m256i gamma[2] = {
+      _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 14, 15, 8, 9, 10, 11, 12, 13, 4,
+                       5, 6, 7, 0, 1, 2, 3, 10, 11, 12, 13, 14, 15, 8, 9),
+      _mm256_setr_epi8(7, 0, 1, 2, 3, 4, 5, 6, 13, 14, 15, 8, 9, 10, 11, 12, 3,
+                       4, 5, 6, 7, 0, 1, 2, 9, 10, 11, 12, 13, 14, 15, 8)};
+
+  __m256i v[4];
+  for (std::size_t i = 0; i < 4; ++i) {
+    v[i] = Load(cv.data() + (i * 4));
+  }
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const std::uint8_t* in = data + (block * kBlockBytes<std::uint64_t>);
+    __m256i even[4];
+    __m256i odd[4];
+    for (std::size_t i = 0; i < 4; ++i) {
+      even[i] = Load(in + (i * 32));
+      odd[i] = Load(in + 128 + (i * 32));
+    }
+
+    Step512<0>(v, even, sc.data(), gamma);
+    Step512<1>(v, odd, sc.data() + 8, gamma);
+    for (std::size_t j = 2; j < Params<std::uint64_t>::kSteps; j += 2) {
+      Expand512(even, odd);
+      Step512<0>(v, even, sc.data() + (j * 8), gamma);
+      Expand512(odd, even);
+      Step512<1>(v, odd, sc.data() + ((j + 1) * 8), gamma);
+    }
+    Expand512(even, odd);
+    for (std::size_t i = 0; i < 4; ++i) {
+      v[i] = _mm256_xor_si256(v[i], even[i]);
+    }
+  }
+  for (std::size_t i = 0; i < 4; ++i) {
+    Store(cv.data() + (i * 4), v[i]);
+  }
+}
+
+// ---- 다중 레인: ymm 한 칸이 메시지 하나. σ / τ는 배열 첨자 바꾸기뿐 ----
+
+template <typename Word>
+struct LaneOps;
+
+template <>
+struct LaneOps<std::uint32_t> {
+  static constexpr std::size_t kLanes = 8;
+  static __m256i Add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+  static __m256i Rotl(__m256i x, std::uint32_t n) {
+    if (n == 0) {
+      return x;
+    }
+    return _mm256_or_si256(_mm256_slli_epi32(x, static_cast<int>(n)),
+                           _mm256_srli_epi32(x, static_cast<int>(32 - n)));
+  }
+  static __m256i Broadcast(std::uint32_t w) {
+    return _mm256_set1_epi32(static_cast<int>(w));
+  }
+};
+
+template <>
+struct LaneOps<std::uint64_t> {
+  static constexpr std::size_t kLanes = 4;
+  static __m256i Add(__m256i a, __m256i b) { return _mm256_add_epi64(a, b); }
+  static __m256i Rotl(__m256i x, std::uint32_t n) {
+    if (n == 0) {
+      return x;
+    }
+    return _mm256_or_si256(_mm256_slli_epi64(x, static_cast<int>(n)),
+                           _mm256_srli_epi64(x, static_cast<int>(64 - n)));
+  }
+  static __m256i Broadcast(std::uint64_t w) {
+    return _mm256_set1_epi64x(static_cast<long long>(w));
+  }
+};
+
+template <typename Word, std::size_t kParity>
+static inline void LaneStep(__m256i* v, const __m256i* msg, std::size_t j) {
+  using Ops = LaneOps<Word>;
+  using P = Params<Word>;
+  __m256i t[16];
+  for (std::size_t l = 0; l < 16; ++l) {
+    t[l] = _mm256_xor_si256(v[l], msg[l]);
+  }
+  for (std::size_t l = 0; l < 8; ++l) {
+    __m256i x = Ops::Rotl(Ops::Add(t[l], t[l + 8]), P::kAlpha[kParity]);
+    x = _mm256_xor_si256(x, Ops::Broadcast(kStepConstants<Word>[(j * 8) + l]));
+    const __m256i y = Ops::Rotl(Ops::Add(x, t[l + 8]), P::kBeta[kParity]);
+    t[l] = Ops::Add(x, y);
+    t[l + 8] = Ops::Rotl(y, P::kGamma[l]);
+  }
+  for (std::size_t l = 0; l < 16; ++l) {
+    v[l] = t[kSigma[l]];
+  }
+}
+
+template <typename Word>
+static inline void LaneExpand(__m256i* older, const __m256i* newer) {
+  __m256i prev[16];
+  for (std::size_t l = 0; l < 16; ++l) {
+    prev[l] = older[l];
+  }
+  for (std::size_t l = 0; l < 16; ++l) {
+    older[l] = LaneOps<Word>::Add(newer[l], prev[kTau[l]]);
+  }
+}
+
+// msg는 전치된 메시지 32워드 (0~15 짝수, 16~31 홀수 부분 메시지)
+template <typename Word>
+static void CompressLanes(Word* cv, __m256i* msg) {
+  constexpr std::size_t kLanes = LaneOps<Word>::kLanes;
+  __m256i v[16];
+  for (std::size_t l = 0; l < 16; ++l) {
+    v[l] = Load(cv + (l * kLanes));
+  }
+
+  __m256i* even = msg;
+  __m256i* odd = msg + 16;
+  LaneStep<Word, 0>(v, even, 0);
+  LaneStep<Word, 1>(v, odd, 1);
+  for (std::size_t j = 2; j < Params<Word>::kSteps; j += 2) {
+    LaneExpand<Word>(even, odd);
+    LaneStep<Word, 0>(v, even, j);
+    LaneExpand<Word>(odd, even);
+    LaneStep<Word, 1>(v, odd, j + 1);
+  }
+  LaneExpand<Word>(even, odd);
+  for (std::size_t l = 0; l < 16; ++l) {
+    Store(cv + (l * kLanes), _mm256_xor_si256(v[l], even[l]));
+  }
+}
+
+// 8x8 32비트 워드 전치 (SHA-256 다중 레인 경로와 같음)
+static inline void Transpose8x32(__m256i* rows) {
+  __m256i t[8];
+  for (std::size_t i = 0; i < 8; i += 2) {
+    t[i] = _mm256_unpacklo_epi32(rows[i], rows[i + 1]);
+    t[i + 1] = _mm256_unpackhi_epi32(rows[i], rows[i + 1]);
+  }
+  __m256i u[8];
+  for (std::size_t i = 0; i < 8; i += 4) {
+    u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+    u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+    u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+    u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+  }
+  for (std::size_t i = 0; i < 4; ++i) {
+    rows[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+    rows[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+  }
+}
+
+// 4x4 64비트 워드 전치
+static inline void Transpose4x64(__m256i* rows) {
+  const __m256i t0 = _mm256_unpacklo_epi64(rows[0], rows[1]);
+  const __m256i t1 = _mm256_unpackhi_epi64(rows[0], rows[1]);
+  const __m256i t2 = _mm256_unpacklo_epi64(rows[2], rows[3]);
+  const __m256i t3 = _mm256_unpackhi_epi64(rows[2], rows[3]);
+  rows[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+  rows[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+  rows[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+  rows[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+void CompressLanesAvx2(std::uint32_t* cv,
+                       const std::uint8_t* const* blocks) noexcept {
+  __m256i msg[32];
+  for (std::size_t group = 0; group < 4; ++group) {
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+      msg[(group * 8) + lane] = Load(blocks[lane] + (group * 32));
+    }
+    Transpose8x32(msg + (group * 8));
+  }
+  CompressLanes(cv, msg);
+}
+
+void CompressLanesAvx2(std::uint64_t* cv,
+                       const std::uint8_t* const* blocks) noexcept {
+  __m256i msg[32];
+  for (std::size_t group = 0; group < 8; ++group) {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      msg[(group * 4) + lane] = Load(blocks[lane] + (group * 32));
+    }
+    Transpose4x64(msg + (group * 4));
+  }
+  CompressLanes(cv, msg);
+}
+
+}  // namespace bedrock::hash::lsh
@@ -0,0 +1,136 @@
+#include "encryption/hash/lsh_multi.h"
+
+#include <cstring>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/lsh.h"
+#include "encryption/hash/sha256_multi.h"
+
+namespace bedrock::hash::lsh {
+
+enum LshMultiIntrinSet { kAVX2 };
+
+static bool IntrinEnabled(LshMultiIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 1> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+// 메시지 하나의 블록 공급. 패딩 블록은 항상 따로 있으므로 tail은 한 블록
+template <typename Word>
+struct LaneJob {
+  std::size_t message = 0;
+  const std::uint8_t* data = nullptr;
+  std::size_t full_blocks = 0;
+  bool tail_done = false;
+  std::array<std::uint8_t, kBlockBytes<Word>> tail{};
+
+  void Start(std::size_t index, std::span<const std::uint8_t> bytes) noexcept {
+    message = index;
+    data = bytes.data();
+    full_blocks = bytes.size() / kBlockBytes<Word>;
+    tail_done = false;
+
+    const std::size_t rest = bytes.size() % kBlockBytes<Word>;
+    tail.fill(0);
+    if (rest != 0) {
+      std::memcpy(tail.data(), bytes.data() + (full_blocks * kBlockBytes<Word>),
+                  rest);
+    }
+    tail[rest] = 0x80;
+  }
+
+  const std::uint8_t* NextBlock() noexcept {
+    if (full_blocks > 0) {
+      const std::uint8_t* block = data;
+      data += kBlockBytes<Word>;
+      --full_blocks;
+      return block;
+    }
+    tail_done = true;
+    return tail.data();
+  }
+
+  [[nodiscard]] bool Done() const noexcept { return tail_done; }
+};
+
+template <typename Word>
+static void DigestLanes(std::span<const std::span<const std::uint8_t>> messages,
+                        std::span<Digest<sizeof(Word) * 8>> digests) {
+  constexpr std::size_t kLanes = 32 / sizeof(Word);
+  constexpr ChainVar<Word> kIv = InitialValue<Word>(sizeof(Word) * 64);
+  // 쉬는 레인이 읽을 블록
+  static constexpr std::array<std::uint8_t, kBlockBytes<Word>> kIdleBlock{};
+
+  std::array<Word, 16 * kLanes> cv{};
+  std::size_t next = 0;
+
+  sha256::RunLanes<kLanes, LaneJob<Word>>(
+      kIdleBlock.data(),
+      [&](std::size_t lane, LaneJob<Word>& job) {
+        if (next == messages.size()) {
+          return false;
+        }
+        job.Start(next, messages[next]);
+        ++next;
+        for (std::size_t word = 0; word < 16; ++word) {
+          cv[(word * kLanes) + lane] = kIv[word];
+        }
+        return true;
+      },
+      [&](const std::uint8_t* const* blocks) {
+        CompressLanesAvx2(cv.data(), blocks);
+      },
+      [&](std::size_t lane, const LaneJob<Word>& job) {
+        // AVX2 경로는 x86 전용이라 워드를 그대로 복사해도 리틀 엔디언
+        std::uint8_t* out = digests[job.message].data();
+        for (std::size_t word = 0; word < 8; ++word) {
+          const Word folded =
+              cv[(word * kLanes) + lane] ^ cv[((word + 8) * kLanes) + lane];
+          std::memcpy(out + (word * sizeof(Word)), &folded, sizeof(Word));
+        }
+        return false;
+      });
+}
+
+template <std::uint32_t Family, typename Word>
+static bool DigestManyImpl(
+    std::span<const std::span<const std::uint8_t>> messages,
+    std::span<Digest<sizeof(Word) * 8>> digests) {
+  if (digests.size() < messages.size()) {
+    return false;
+  }
+
+  if (messages.size() > 1 && IntrinEnabled(kAVX2)) {
+    DigestLanes<Word>(messages, digests);
+    return true;
+  }
+
+  const LSH<Family> single;
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    const auto digest = single.Digest(messages[i]);
+    std::memcpy(digests[i].data(), digest.data(), digest.size());
+  }
+  return true;
+}
+
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<32>> digests) noexcept {
+  return DigestManyImpl<256, std::uint32_t>(messages, digests);
+}
+
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<64>> digests) noexcept {
+  return DigestManyImpl<512, std::uint64_t>(messages, digests);
+}
+
+}  // namespace bedrock::hash::lsh
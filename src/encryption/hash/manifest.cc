@@ -0,0 +1,469 @@
+#include "encryption/hash/manifest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#include "encryption/hash/merkle.h"
+#include "encryption/hash/sha.h"
+
+namespace bedrock::hash {
+
+namespace fs = std::filesystem;
+
+// 큰 파일 하나를 리프 구간 여러 개로 나눠 계산하는 동안의 공유 상태.
+// 마지막 구간을 끝낸 스레드가 루트를 계산하고, 구간 작업이 모두 놓이면
+// 매핑과 함께 해제됨
+struct TreeJob {
+  InputFile file;
+  // 매핑했으면 파일 전체. 아니면 비어 있고 구간마다 file에서 읽음
+  std::span<const std::uint8_t> data;
+  std::size_t bytes = 0;
+  std::vector<merkle::Digest> leaves;
+  std::atomic<std::size_t> remaining = 0;
+  // 파일이 처음 크기보다 짧아졌거나 읽지 못한 구간이 있음
+  std::atomic<bool> failed = false;
+  ManifestEntry* entry = nullptr;
+};
+
+struct ManifestTask {
+  enum Kind { kSmallBatch, kLargeFile, kLeafRange };
+
+  Kind kind = kSmallBatch;
+  // 묶음: entries[first, last), 큰 파일: entries[first],
+  // 리프 구간: job->leaves[first, last)
+  std::size_t first = 0;
+  std::size_t last = 0;
+  std::shared_ptr<TreeJob> job;
+};
+
+// 스레드마다 큐 하나. 자기 큐는 뒤에서(최근에 넣은 것부터), 다른 스레드의
+// 큐는 앞에서 꺼내 옴. pending은 넣었지만 아직 끝나지 않은 작업 수.
+// 꺼낼 작업이 없는 스레드는 새 작업이 들어오거나 모두 끝날 때까지 잠듦
+class StealingQueues {
+ public:
+  explicit StealingQueues(std::size_t workers) : queues(workers) {}
+
+  void Push(std::size_t worker, const ManifestTask& task) {
+    pending.fetch_add(1, std::memory_order_relaxed);
+    {
+      Queue& queue = queues[worker % queues.size()];
+      const std::lock_guard lock(queue.mutex);
+      queue.tasks.push_back(task);
+    }
+    {
+      const std::lock_guard lock(idle_mutex);
+      ++pushed;
+    }
+    idle.notify_one();
+  }
+
+  // 작업 하나를 꺼냄. 남은 작업이 모두 끝났으면 false
+  bool Wait(std::size_t worker, ManifestTask& task) {
+    while (true) {
+      std::size_t seen = 0;
+      {
+        const std::lock_guard lock(idle_mutex);
+        seen = pushed;
+      }
+      if (Pop(worker, task)) {
+        return true;
+      }
+      // 실행 중인 작업이 큰 파일을 리프 구간으로 나눠 넣을 수 있으므로
+      // pending이 0이 될 때까지는 끝내지 않음
+      std::unique_lock lock(idle_mutex);
+      idle.wait(lock, [&] { return pushed != seen || Finished(); });
+      if (Finished()) {
+        return false;
+      }
+    }
+  }
+
+  // 작업 하나가 (새 작업을 다 넣은 뒤) 끝남
+  void Done() {
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // 잠들기 직전의 스레드가 0을 놓치지 않도록 잠금을 거친 뒤 깨움
+      { const std::lock_guard lock(idle_mutex); }
+      idle.notify_all();
+    }
+  }
+
+ private:
+  [[nodiscard]] bool Finished() const {
+    return pending.load(std::memory_order_acquire) == 0;
+  }
+
+  bool Pop(std::size_t worker, ManifestTask& task) {
+    {
+      Queue& own = queues[worker];
+      const std::lock_guard lock(own.mutex);
+      if (!own.tasks.empty()) {
+        task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        return true;
+      }
+    }
+    for (std::size_t i = 1; i < queues.size(); ++i) {
+      Queue& victim = queues[(worker + i) % queues.size()];
+      const std::lock_guard lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<ManifestTask> tasks;
+  };
+
+  std::vector<Queue> queues;
+  std::atomic<std::size_t> pending = 0;
+  std::mutex idle_mutex;
+  std::condition_variable idle;
+  // Push 횟수. 잠들기 전에 본 값과 다르면 새 작업이 있었음
+  std::size_t pushed = 0;
+};
+
+// 파일 끝까지 out 뒤에 이어 붙임. 실패하면 out은 그대로
+static bool AppendFile(const fs::path& path, std::vector<std::uint8_t>& out) {
+  InputFile file;
+  if (!file.Open(path)) {
+    return false;
+  }
+  const std::size_t start = out.size();
+  std::size_t filled = start;
+  // 한 바이트 더 잡아 두면 크기가 그대로인 파일은 두 번째 읽기에서 끝을 확인
+  out.resize(start + file.Size() + 1);
+  while (true) {
+    if (filled == out.size()) {
+      out.resize(out.size() + (std::size_t{64} << 10));
+    }
+    const std::ptrdiff_t got =
+        file.Read(out.data() + filled, out.size() - filled);
+    if (got < 0) {
+      out.resize(start);
+      return false;
+    }
+    if (got == 0) {
+      break;
+    }
+    filled += static_cast<std::size_t>(got);
+  }
+  out.resize(filled);
+  return true;
+}
+
+// offset부터 out을 가득 채움. 그 전에 파일이 끝나거나 읽기에 실패하면 false
+static bool ReadRange(InputFile& file, std::size_t offset,
+                      std::span<std::uint8_t> out) {
+  std::size_t filled = 0;
+  while (filled < out.size()) {
+    const std::ptrdiff_t got =
+        file.ReadAt(out.data() + filled, out.size() - filled, offset + filled);
+    if (got <= 0) {
+      return false;
+    }
+    filled += static_cast<std::size_t>(got);
+  }
+  return true;
+}
+
+struct ByteCounter {
+  SHA256 sha;
+  std::uint64_t bytes = 0;
+};
+
+class ManifestBuilder {
+ public:
+  ManifestBuilder(const fs::path& root_path, const ManifestOptions& opts,
+                  std::vector<ManifestEntry>& out, std::size_t workers)
+      : root(root_path), options(opts), entries(out), queues(workers),
+        worker_count(workers) {}
+
+  void Schedule(std::span<const std::size_t> large,
+                std::span<const std::size_t> small) {
+    small_files = small;
+    std::size_t next = 0;
+    for (const std::size_t index : large) {
+      queues.Push(next++, {ManifestTask::kLargeFile, index, index + 1});
+    }
+    for (std::size_t i = 0; i < small.size(); i += options.batch_files) {
+      const std::size_t end = std::min(i + options.batch_files, small.size());
+      queues.Push(next++, {ManifestTask::kSmallBatch, i, end});
+    }
+  }
+
+  void Work(std::size_t worker) {
+    ManifestTask task;
+    while (queues.Wait(worker, task)) {
+      Run(worker, task);
+      // 리프 구간이 잡고 있던 TreeJob을 다음 작업을 기다리기 전에 놓음
+      task.job.reset();
+      queues.Done();
+    }
+  }
+
+ private:
+  void Run(std::size_t worker, const ManifestTask& task) {
+    switch (task.kind) {
+      case ManifestTask::kSmallBatch:
+        RunSmallBatch(task.first, task.last);
+        break;
+      case ManifestTask::kLargeFile:
+        if (options.digest == ManifestDigest::kMerkle) {
+          SplitTree(worker, entries[task.first]);
+        } else {
+          HashWhole(entries[task.first]);
+        }
+        break;
+      case ManifestTask::kLeafRange:
+        RunLeafRange(*task.job, task.first, task.last);
+        break;
+    }
+  }
+
+  // 작은 파일 여러 개를 한 버퍼에 읽어 두고 SHA-256 레인에 함께 넣음
+  void RunSmallBatch(std::size_t first, std::size_t last) {
+    std::vector<std::uint8_t> arena;
+    std::vector<std::size_t> offsets;
+    std::vector<ManifestEntry*> batch;
+    for (std::size_t i = first; i < last; ++i) {
+      ManifestEntry& entry = entries[small_files[i]];
+      const std::size_t start = arena.size();
+      if (AppendFile(root / entry.path, arena)) {
+        entry.bytes = arena.size() - start;
+        offsets.push_back(start);
+        batch.push_back(&entry);
+      }
+    }
+    offsets.push_back(arena.size());
+
+    std::vector<std::span<const std::uint8_t>> messages(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      messages[i] = std::span<const std::uint8_t>(arena).subspan(
+          offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    std::vector<sha256::Digest> digests(batch.size());
+    sha256::DigestMany(messages, digests);
+    // 트리 해시에서 작은 파일은 리프 하나이므로 길이만 묶으면 루트
+    const bool merkle_root = options.digest == ManifestDigest::kMerkle;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      batch[i]->digest = merkle_root
+                             ? merkle::Finalize(digests[i], batch[i]->bytes)
+                             : digests[i];
+      batch[i]->readable = true;
+    }
+  }
+
+  void HashWhole(ManifestEntry& entry) {
+    ByteCounter counter;
+    const bool ok = ReadFileChunks(
+        root / entry.path, options.read,
+        [](void* context, std::span<const std::uint8_t> chunk) noexcept {
+          auto* state = static_cast<ByteCounter*>(context);
+          state->sha.Update(chunk);
+          state->bytes += chunk.size();
+        },
+        &counter);
+    if (ok) {
+      const auto digest = counter.sha.Digest();
+      std::memcpy(entry.digest.data(), digest.data(), digest.size());
+      entry.bytes = counter.bytes;
+      entry.readable = true;
+    }
+  }
+
+  // 파일을 열어(options.read가 허용하면 매핑) 리프 구간 작업으로 나눠
+  // 자기 큐에 넣음. 스레드마다 구간이 서너 개씩 돌아가도록 나누되 구간은
+  // 리프 8개 이상
+  void SplitTree(std::size_t worker, ManifestEntry& entry) {
+    auto job = std::make_shared<TreeJob>();
+    job->entry = &entry;
+    if (!job->file.Open(root / entry.path)) {
+      return;
+    }
+    job->bytes = job->file.Size();
+    // 빈 파일은 매핑하지 않고 빈 리프 하나로 계산
+    const bool map =
+        options.read.mode == FileReadMode::kMap ||
+        (options.read.mode == FileReadMode::kAuto &&
+         job->bytes <= options.read.map_limit);
+    if (map && job->bytes != 0) {
+      const std::uint8_t* data = job->file.Map();
+      if (data == nullptr) {
+        return;
+      }
+      job->data = {data, job->bytes};
+    }
+    entry.bytes = job->bytes;
+
+    const std::size_t count =
+        merkle::LeafCount(job->bytes, options.leaf_bytes);
+    job->leaves.resize(count);
+    const std::size_t per_range = std::max<std::size_t>(
+        8, (count + (worker_count * 4) - 1) / (worker_count * 4));
+    const std::size_t ranges = (count + per_range - 1) / per_range;
+    job->remaining.store(ranges, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < ranges; ++i) {
+      queues.Push(worker,
+                  {ManifestTask::kLeafRange, i * per_range,
+                   std::min((i + 1) * per_range, count), job});
+    }
+  }
+
+  void RunLeafRange(TreeJob& job, std::size_t first, std::size_t last) {
+    if (job.data.size() == job.bytes) {
+      const std::size_t begin = first * options.leaf_bytes;
+      const std::size_t end = std::min(last * options.leaf_bytes, job.bytes);
+      merkle::LeafHashes(job.data.subspan(begin, end - begin),
+                         {options.leaf_bytes, 1},
+                         std::span(job.leaves).subspan(first, last - first));
+    } else if (!ReadLeaves(job, first, last)) {
+      job.failed.store(true, std::memory_order_relaxed);
+    }
+    if (job.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      job.entry->readable =
+          !job.failed.load(std::memory_order_relaxed) &&
+          merkle::Reduce(job.leaves, job.bytes, job.entry->digest);
+    }
+  }
+
+  // 리프 [first, last)를 chunk_bytes(리프 단위로 내림, 최소 리프 하나)씩
+  // 읽어 해시. 파일이 짧아졌거나 읽기에 실패하면 false
+  bool ReadLeaves(TreeJob& job, std::size_t first, std::size_t last) const {
+    const std::size_t leaf = options.leaf_bytes;
+    const std::size_t per_chunk =
+        std::max<std::size_t>(1, options.read.chunk_bytes / leaf);
+    const std::size_t end = std::min(last * leaf, job.bytes);
+    std::vector<std::uint8_t> buffer;
+    for (std::size_t index = first; index < last; index += per_chunk) {
+      const std::size_t count = std::min(per_chunk, last - index);
+      const std::size_t offset = index * leaf;
+      buffer.resize(std::min(count * leaf, end - offset));
+      if (!ReadRange(job.file, offset, buffer)) {
+        return false;
+      }
+      merkle::LeafHashes(buffer, {leaf, 1},
+                         std::span(job.leaves).subspan(index, count));
+    }
+    return true;
+  }
+
+  const fs::path& root;
+  const ManifestOptions& options;
+  std::vector<ManifestEntry>& entries;
+  StealingQueues queues;
+  std::size_t worker_count;
+  std::span<const std::size_t> small_files;
+};
+
+bool BuildManifest(const fs::path& root, const ManifestOptions& options,
+                   std::vector<ManifestEntry>& entries) noexcept {
+  entries.clear();
+  if (options.batch_files == 0 ||
+      (options.digest == ManifestDigest::kMerkle && options.leaf_bytes == 0)) {
+    return false;
+  }
+
+  std::error_code error;
+  fs::recursive_directory_iterator it(
+      root, fs::directory_options::skip_permission_denied, error);
+  bool walked = !error;
+  for (; walked && it != fs::recursive_directory_iterator();
+       it.increment(error)) {
+    if (error) {
+      walked = false;
+      break;
+    }
+    std::error_code status_error;
+    if (it->symlink_status(status_error).type() != fs::file_type::regular) {
+      continue;
+    }
+    ManifestEntry entry;
+    entry.path = it->path().lexically_relative(root);
+    entry.bytes = it->file_size(status_error);
+    entries.push_back(std::move(entry));
+  }
+  std::ranges::sort(entries, {}, &ManifestEntry::path);
+
+  // 큰 파일은 큰 것부터 먼저 나눠 줘야 마지막에 한 스레드만 남지 않음
+  // 트리 해시에서 리프 하나를 넘는 파일은 리프 구간으로 나눠야 하므로 큰 파일 쪽
+  const std::size_t small_limit =
+      options.digest == ManifestDigest::kMerkle
+          ? std::min(options.small_file_bytes, options.leaf_bytes)
+          : options.small_file_bytes;
+  std::vector<std::size_t> large;
+  std::vector<std::size_t> small;
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    (entries[i].bytes > small_limit ? large : small).push_back(i);
+  }
+  std::ranges::sort(large, [&](std::size_t a, std::size_t b) {
+    return entries[a].bytes > entries[b].bytes;
+  });
+
+  std::size_t workers = options.threads;
+  if (workers == 0) {
+    workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  }
+  ManifestBuilder builder(root, options, entries, workers);
+  builder.Schedule(large, small);
+
+  std::vector<std::thread> pool;
+  pool.reserve(workers - 1);
+  for (std::size_t worker = 1; worker < workers; ++worker) {
+    pool.emplace_back(&ManifestBuilder::Work, &builder, worker);
+  }
+  builder.Work(0);
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+
+  return walked && std::ranges::all_of(entries, &ManifestEntry::readable);
+}
+
+std::string FormatManifest(std::span<const ManifestEntry> entries) {
+  static constexpr char kHex[] = "0123456789abcdef";
+
+  std::string text;
+  for (const ManifestEntry& entry : entries) {
+    if (!entry.readable) {
+      continue;
+    }
+    const std::u8string name = entry.path.generic_u8string();
+    const bool escape =
+        name.find_first_of(u8"\\\n\r") != std::u8string::npos;
+    if (escape) {
+      text += '\\';
+    }
+    for (const std::uint8_t byte : entry.digest) {
+      text += kHex[byte >> 4];
+      text += kHex[byte & 0x0f];
+    }
+    text += "  ";
+    for (const char8_t c : name) {
+      if (escape && c == u8'\\') {
+        text += "\\\\";
+      } else if (escape && c == u8'\n') {
+        text += "\\n";
+      } else if (escape && c == u8'\r') {
+        text += "\\r";
+      } else {
+        text += static_cast<char>(c);
+      }
+    }
+    text += '\n';
+  }
+  return text;
+}
+
+}  // namespace bedrock::hash
@@ -0,0 +1,122 @@
+#include "encryption/hash/merkle.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "encryption/hash/sha256_fixed.h"
+
+namespace bedrock::hash::merkle {
+
+std::size_t LeafCount(std::size_t bytes, std::size_t leaf_bytes) noexcept {
+  if (leaf_bytes == 0) {
+    return 0;
+  }
+  // bytes + leaf_bytes - 1은 넘칠 수 있으므로 나머지로 올림
+  return std::max<std::size_t>(
+      1, (bytes / leaf_bytes) + (bytes % leaf_bytes != 0 ? 1 : 0));
+}
+
+// 리프 [first, last)를 해시. 같은 스레드 안의 리프들은 DigestMany로
+// SHA-256 레인에 나눠 넣음
+static void HashLeaves(std::span<const std::uint8_t> data,
+                       std::size_t leaf_bytes, std::size_t first,
+                       std::size_t last, std::span<Digest> leaves) {
+  std::vector<std::span<const std::uint8_t>> messages;
+  messages.reserve(last - first);
+  for (std::size_t leaf = first; leaf < last; ++leaf) {
+    const std::size_t offset = std::min(leaf * leaf_bytes, data.size());
+    messages.push_back(
+        data.subspan(offset, std::min(leaf_bytes, data.size() - offset)));
+  }
+  sha256::DigestMany(messages, leaves.subspan(first, last - first));
+}
+
+Digest Finalize(const Digest& top, std::uint64_t total_bytes) noexcept {
+  sha256::Block64 block{};
+  std::memcpy(block.data(), top.data(), top.size());
+  for (std::size_t i = 0; i < 8; i++) {
+    block[top.size() + i] =
+        static_cast<std::uint8_t>(total_bytes >> (56 - (8 * i)));
+  }
+  return sha256::Hash64(block);
+}
+
+bool Reduce(std::span<const Digest> leaves, std::uint64_t total_bytes,
+            Digest& root) noexcept {
+  if (leaves.empty()) {
+    return false;
+  }
+  if (leaves.size() == 1) {
+    root = Finalize(leaves[0], total_bytes);
+    return true;
+  }
+
+  // Digest 두 개가 붙은 배열은 곧 64바이트 블록 배열
+  static_assert(sizeof(sha256::Block64) == 2 * sizeof(Digest));
+  std::vector<Digest> level(leaves.begin(), leaves.end());
+  while (level.size() > 1) {
+    const std::size_t pairs = level.size() / 2;
+    std::vector<sha256::Block64> blocks(pairs);
+    std::memcpy(blocks.data(), level.data(), pairs * sizeof(sha256::Block64));
+    std::vector<Digest> parents(pairs + (level.size() % 2));
+    sha256::Hash64Many(blocks, parents);
+    if (level.size() % 2 != 0) {
+      parents.back() = level.back();
+    }
+    level = std::move(parents);
+  }
+  root = Finalize(level[0], total_bytes);
+  return true;
+}
+
+bool LeafHashes(std::span<const std::uint8_t> data, const TreeOptions& options,
+                std::span<Digest> leaf_digests) noexcept {
+  const std::size_t count = LeafCount(data.size(), options.leaf_bytes);
+  if (count == 0 || leaf_digests.size() < count) {
+    return false;
+  }
+
+  // 스레드마다 이어진 리프 구간을 맡김. 리프 수와 하드웨어 스레드 수보다
+  // 많이 띄우지 않음
+  const std::size_t hardware =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  const std::size_t workers =
+      std::clamp<std::size_t>(options.threads, 1, std::min(count, hardware));
+  const auto range = [&](std::size_t worker) {
+    return (count * worker) / workers;
+  };
+  std::vector<std::thread> pool;
+  pool.reserve(workers - 1);
+  for (std::size_t worker = 1; worker < workers; ++worker) {
+    pool.emplace_back(HashLeaves, data, options.leaf_bytes, range(worker),
+                      range(worker + 1), leaf_digests);
+  }
+  HashLeaves(data, options.leaf_bytes, 0, range(1), leaf_digests);
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+  return true;
+}
+
+bool TreeHash(std::span<const std::uint8_t> data, const TreeOptions& options,
+              Digest& root, std::span<Digest> leaf_digests) noexcept {
+  const std::size_t count = LeafCount(data.size(), options.leaf_bytes);
+  if (count == 0 || (!leaf_digests.empty() && leaf_digests.size() < count)) {
+    return false;
+  }
+
+  std::vector<Digest> own;
+  std::span<Digest> leaves;
+  if (leaf_digests.empty()) {
+    own.resize(count);
+    leaves = own;
+  } else {
+    leaves = leaf_digests.first(count);
+  }
+  return LeafHashes(data, options, leaves) &&
+         Reduce(leaves, data.size(), root);
+}
+
+}  // namespace bedrock::hash::merkle
@@ -0,0 +1,300 @@
+#include "encryption/hash/merkle_index.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "encryption/hash/sha256_fixed.h"
+
+namespace bedrock::hash::merkle {
+
+struct IndexHeader {
+  std::array<char, 8> magic;
+  std::uint64_t leaf_bytes;
+  std::uint64_t data_bytes;
+  std::uint64_t leaf_count;
+  std::uint64_t node_count;
+  std::array<std::uint8_t, 24> reserved;
+};
+static_assert(sizeof(IndexHeader) == 64);
+
+static constexpr std::array<char, 8> kMagic = {'B', 'D', 'M', 'E',
+                                               'R', 'K', 'L', '1'};
+
+// 리프 leaf_count개인 트리의 전체 노드 수 (층마다 짝 없는 노드는 올림)
+static std::size_t NodeCount(std::size_t leaf_count) noexcept {
+  std::size_t total = leaf_count;
+  for (std::size_t level = leaf_count; level > 1;) {
+    level = (level + 1) / 2;
+    total += level;
+  }
+  return total;
+}
+
+// parents[first .. last] 다시 계산. 짝 없는 마지막 자식은 그대로 올림
+static void HashParents(const Digest* children, std::size_t child_count,
+                        Digest* parents, std::size_t first,
+                        std::size_t last) noexcept {
+  constexpr std::size_t kBatch = 256;
+  std::array<sha256::Block64, kBatch> blocks;
+  std::array<Digest, kBatch> digests;
+
+  const std::size_t pairs = child_count / 2;
+  const std::size_t end = std::min(last + 1, pairs);
+  for (std::size_t i = first; i < end;) {
+    const std::size_t batch = std::min(kBatch, end - i);
+    std::memcpy(blocks.data(), children + (2 * i),
+                batch * sizeof(sha256::Block64));
+    sha256::Hash64Many(std::span(blocks).first(batch),
+                       std::span(digests).first(batch));
+    std::memcpy(parents + i, digests.data(), batch * sizeof(Digest));
+    i += batch;
+  }
+  if (child_count % 2 != 0 && last >= pairs) {
+    parents[pairs] = children[child_count - 1];
+  }
+}
+
+// 리프 [first, last]가 바뀐 뒤 조상 경로를 층마다 다시 계산
+static void RehashAncestors(Digest* nodes, std::size_t leaf_count,
+                            std::size_t first, std::size_t last) noexcept {
+  Digest* level = nodes;
+  for (std::size_t count = leaf_count; count > 1; count = (count + 1) / 2) {
+    first /= 2;
+    last /= 2;
+    HashParents(level, count, level + count, first, last);
+    level += count;
+  }
+}
+
+MerkleIndex::MerkleIndex(MerkleIndex&& other) noexcept {
+  *this = std::move(other);
+}
+
+MerkleIndex& MerkleIndex::operator=(MerkleIndex&& other) noexcept {
+  if (this != &other) {
+    Close();
+    mapping = std::exchange(other.mapping, nullptr);
+    mapping_bytes = std::exchange(other.mapping_bytes, 0);
+#ifdef _WIN32
+    file = std::exchange(other.file, nullptr);
+    file_mapping = std::exchange(other.file_mapping, nullptr);
+#else
+    file = std::exchange(other.file, -1);
+#endif
+    nodes = std::exchange(other.nodes, nullptr);
+    leaf_bytes = std::exchange(other.leaf_bytes, 0);
+    data_bytes = std::exchange(other.data_bytes, 0);
+    leaf_count = std::exchange(other.leaf_count, 0);
+    node_count = std::exchange(other.node_count, 0);
+  }
+  return *this;
+}
+
+MerkleIndex::~MerkleIndex() { Close(); }
+
+#ifdef _WIN32
+
+bool MerkleIndex::Map(const std::filesystem::path& path,
+                      std::size_t file_bytes, bool create) noexcept {
+  file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                     FILE_SHARE_READ, nullptr,
+                     create ? CREATE_ALWAYS : OPEN_EXISTING,
+                     FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    file = nullptr;
+    return false;
+  }
+  if (!create) {
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+      return false;
+    }
+    file_bytes = static_cast<std::size_t>(size.QuadPart);
+  }
+
+  // 매핑 크기를 지정하면 새 파일은 그 크기로 늘어남
+  file_mapping = CreateFileMappingW(
+      file, nullptr, PAGE_READWRITE, static_cast<DWORD>(file_bytes >> 32),
+      static_cast<DWORD>(file_bytes & 0xffffffffU), nullptr);
+  if (file_mapping == nullptr) {
+    return false;
+  }
+  mapping = static_cast<std::uint8_t*>(
+      MapViewOfFile(file_mapping, FILE_MAP_ALL_ACCESS, 0, 0, file_bytes));
+  mapping_bytes = mapping == nullptr ? 0 : file_bytes;
+  return mapping != nullptr;
+}
+
+bool MerkleIndex::Sync() noexcept {
+  return mapping != nullptr && FlushViewOfFile(mapping, mapping_bytes) &&
+         FlushFileBuffers(file);
+}
+
+void MerkleIndex::Close() noexcept {
+  if (mapping != nullptr) {
+    UnmapViewOfFile(mapping);
+  }
+  if (file_mapping != nullptr) {
+    CloseHandle(file_mapping);
+  }
+  if (file != nullptr) {
+    CloseHandle(file);
+  }
+  mapping = nullptr;
+  mapping_bytes = 0;
+  file_mapping = nullptr;
+  file = nullptr;
+  nodes = nullptr;
+}
+
+#else
+
+bool MerkleIndex::Map(const std::filesystem::path& path,
+                      std::size_t file_bytes, bool create) noexcept {
+  const int flags = O_RDWR | O_CLOEXEC | (create ? O_CREAT | O_TRUNC : 0);
+  file = open(path.c_str(), flags, 0644);
+  if (file < 0) {
+    return false;
+  }
+  if (create) {
+    if (ftruncate(file, static_cast<off_t>(file_bytes)) != 0) {
+      return false;
+    }
+  } else {
+    struct stat info {};
+    if (fstat(file, &info) != 0 || info.st_size <= 0) {
+      return false;
+    }
+    file_bytes = static_cast<std::size_t>(info.st_size);
+  }
+
+  void* p = mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                 file, 0);
+  if (p == MAP_FAILED) {
+    return false;
+  }
+  mapping = static_cast<std::uint8_t*>(p);
+  mapping_bytes = file_bytes;
+  return true;
+}
+
+bool MerkleIndex::Sync() noexcept {
+  return mapping != nullptr && msync(mapping, mapping_bytes, MS_SYNC) == 0;
+}
+
+void MerkleIndex::Close() noexcept {
+  if (mapping != nullptr) {
+    munmap(mapping, mapping_bytes);
+  }
+  if (file >= 0) {
+    close(file);
+  }
+  mapping = nullptr;
+  mapping_bytes = 0;
+  file = -1;
+  nodes = nullptr;
+}
+
+#endif
+
+bool MerkleIndex::Create(const std::filesystem::path& path,
+                         std::span<const std::uint8_t> data,
+                         const TreeOptions& options) noexcept {
+  Close();
+  const std::size_t leaves = LeafCount(data.size(), options.leaf_bytes);
+  if (leaves == 0) {
+    return false;
+  }
+  const std::size_t total = NodeCount(leaves);
+  if (!Map(path, sizeof(IndexHeader) + (total * sizeof(Digest)), true)) {
+    Close();
+    return false;
+  }
+
+  nodes = reinterpret_cast<Digest*>(mapping + sizeof(IndexHeader));
+  leaf_bytes = options.leaf_bytes;
+  data_bytes = data.size();
+  leaf_count = leaves;
+  node_count = total;
+  LeafHashes(data, options, std::span(nodes, leaf_count));
+  RehashAncestors(nodes, leaf_count, 0, leaf_count - 1);
+
+  // 노드를 모두 쓴 뒤 헤더를 기록
+  const IndexHeader header = {kMagic, leaf_bytes, data_bytes, leaf_count,
+                              node_count, {}};
+  std::memcpy(mapping, &header, sizeof(header));
+  return true;
+}
+
+bool MerkleIndex::Open(const std::filesystem::path& path) noexcept {
+  Close();
+  if (!Map(path, 0, false) || mapping_bytes < sizeof(IndexHeader)) {
+    Close();
+    return false;
+  }
+
+  // 헤더는 믿을 수 없는 값이므로 파일에 실제로 들어 있는 노드 수로 먼저
+  // 제한한 뒤 계산 (곱셈 / NodeCount가 넘치지 않도록)
+  IndexHeader header;
+  std::memcpy(&header, mapping, sizeof(header));
+  const std::size_t body_bytes = mapping_bytes - sizeof(IndexHeader);
+  const std::size_t capacity = body_bytes / sizeof(Digest);
+  if (header.magic != kMagic || header.leaf_bytes == 0 ||
+      header.leaf_count > capacity || header.node_count > capacity ||
+      header.leaf_count !=
+          LeafCount(header.data_bytes, header.leaf_bytes) ||
+      header.node_count != NodeCount(header.leaf_count) ||
+      body_bytes != header.node_count * sizeof(Digest)) {
+    Close();
+    return false;
+  }
+
+  nodes = reinterpret_cast<Digest*>(mapping + sizeof(IndexHeader));
+  leaf_bytes = header.leaf_bytes;
+  data_bytes = header.data_bytes;
+  leaf_count = header.leaf_count;
+  node_count = header.node_count;
+  return true;
+}
+
+bool MerkleIndex::Update(std::span<const std::uint8_t> data,
+                         std::size_t offset, std::size_t length) noexcept {
+  if (nodes == nullptr || data.size() != data_bytes || offset > data.size() ||
+      length > data.size() - offset) {
+    return false;
+  }
+  if (length == 0) {
+    return true;
+  }
+
+  const std::size_t first = offset / leaf_bytes;
+  const std::size_t last = (offset + length - 1) / leaf_bytes;
+  const std::size_t begin = first * leaf_bytes;
+  const std::size_t end = std::min((last + 1) * leaf_bytes, data.size());
+  LeafHashes(data.subspan(begin, end - begin), {leaf_bytes, 1},
+             std::span(nodes + first, last - first + 1));
+  RehashAncestors(nodes, leaf_count, first, last);
+  return true;
+}
+
+Digest MerkleIndex::Root() const noexcept {
+  return nodes == nullptr ? Digest{}
+                          : Finalize(nodes[node_count - 1], data_bytes);
+}
+
+std::span<const Digest> MerkleIndex::Leaves() const noexcept {
+  return {nodes, nodes == nullptr ? 0 : leaf_count};
+}
+
+}  // namespace bedrock::hash::merkle
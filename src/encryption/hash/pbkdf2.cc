@@ -0,0 +1,230 @@
+#include "encryption/hash/pbkdf2.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/hmac.h"
+
+namespace bedrock::hash {
+
+enum Pbkdf2IntrinSet { kAVX2, kAVX512F, kSHA, kSSE41 };
+
+static bool IntrinEnabled(Pbkdf2IntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 4> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX512F"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SHA"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSE4.1")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    case kAVX512F:
+      return enabled[target];
+    case kSHA:
+      return enabled[target];
+    case kSSE41:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+static constexpr std::size_t kBlockOutput = sha256::kDigestBytes;
+
+static std::size_t OutputBlocks(const Pbkdf2Request& request) noexcept {
+  return (request.out.size() + kBlockOutput - 1) / kBlockOutput;
+}
+
+// 출력 블록 하나 = 작업 하나. 요청 순서대로 (요청, 블록 번호)를 꺼내며
+// 요청이 바뀔 때만 HMAC 키(중간 상태)를 다시 만듦
+class TaskCursor {
+ public:
+  explicit TaskCursor(std::span<const Pbkdf2Request> requests) noexcept
+      : requests_(requests), key_(std::span<const std::uint8_t>()) {}
+
+  struct Task {
+    sha256::State inner;
+    sha256::State outer;
+    HmacSha256::Tag u1;
+    std::span<std::uint8_t> out;
+  };
+
+  bool Next(Task& task) noexcept {
+    while (request_ < requests_.size() &&
+           block_ == OutputBlocks(requests_[request_])) {
+      ++request_;
+      block_ = 0;
+    }
+    if (request_ >= requests_.size()) {
+      return false;
+    }
+    const Pbkdf2Request& request = requests_[request_];
+    if (block_ == 0) {
+      key_ = HmacSha256(request.password);
+    }
+
+    // U_1 = HMAC(P, S || INT(i)), i는 1부터 빅 엔디언 32비트
+    std::array<std::uint8_t, 4> index{};
+    sha256::StoreBigEndian32(index.data(),
+                             static_cast<std::uint32_t>(block_ + 1));
+    HmacSha256 mac = key_;
+    mac.Update(request.salt);
+    mac.Update(index);
+    task.u1 = mac.Final();
+    task.inner = key_.InnerMidstate();
+    task.outer = key_.OuterMidstate();
+
+    const std::size_t offset = block_ * kBlockOutput;
+    task.out = request.out.subspan(
+        offset, std::min(kBlockOutput, request.out.size() - offset));
+    ++block_;
+    return true;
+  }
+
+ private:
+  std::span<const Pbkdf2Request> requests_;
+  std::size_t request_ = 0;
+  std::size_t block_ = 0;
+  HmacSha256 key_;
+};
+
+static void WriteBlock(std::span<std::uint8_t> out,
+                       const sha256::State& t) noexcept {
+  HmacSha256::Tag bytes;
+  for (std::size_t i = 0; i < 8; ++i) {
+    sha256::StoreBigEndian32(bytes.data() + (i * 4), t[i]);
+  }
+  std::memcpy(out.data(), bytes.data(), out.size());
+}
+
+// 작업 하나를 단일 압축(SHA-NI 등)으로. 안쪽 / 바깥쪽 블록 모두
+// 32바이트 + 길이 96바이트 패딩이므로 같은 블록 버퍼의 앞 32바이트만 바꿈
+static void IterateOne(const TaskCursor::Task& task,
+                       std::uint32_t iterations) noexcept {
+  std::array<std::uint8_t, sha256::kBlockBytes> block{};
+  std::ranges::copy(task.u1, block.begin());
+  block[kBlockOutput] = 0x80;
+  sha256::StoreBigEndian32(
+      block.data() + sha256::kBlockBytes - 4,
+      static_cast<std::uint32_t>((sha256::kBlockBytes + kBlockOutput) * 8));
+
+  sha256::State t{};
+  for (std::size_t i = 0; i < 8; ++i) {
+    t[i] = sha256::LoadBigEndian32(task.u1.data() + (i * 4));
+  }
+  for (std::uint32_t j = 1; j < iterations; ++j) {
+    sha256::State h = task.inner;
+    sha256::CompressBlocks(h, block.data(), 1);
+    for (std::size_t i = 0; i < 8; ++i) {
+      sha256::StoreBigEndian32(block.data() + (i * 4), h[i]);
+    }
+    h = task.outer;
+    sha256::CompressBlocks(h, block.data(), 1);
+    for (std::size_t i = 0; i < 8; ++i) {
+      sha256::StoreBigEndian32(block.data() + (i * 4), h[i]);
+      t[i] ^= h[i];
+    }
+  }
+  WriteBlock(task.out, t);
+}
+
+using IterateFn = void (*)(const std::uint32_t* inner,
+                           const std::uint32_t* outer, std::uint32_t* u,
+                           std::uint32_t* t,
+                           std::uint32_t iterations) noexcept;
+
+// 반복 횟수가 모두 같으므로 레인 수만큼 작업을 묶어 커널 한 번에 끝까지.
+// 묶음이 min_tasks개보다 적게 차면 레인을 놀리느니 작업마다 IterateOne
+template <std::size_t kLanes>
+static void IterateLanes(TaskCursor& cursor, std::uint32_t iterations,
+                         IterateFn iterate, std::size_t min_tasks) noexcept {
+  std::array<std::uint32_t, 8 * kLanes> inner{};
+  std::array<std::uint32_t, 8 * kLanes> outer{};
+  std::array<std::uint32_t, 8 * kLanes> u{};
+  std::array<std::uint32_t, 8 * kLanes> t{};
+  std::array<TaskCursor::Task, kLanes> tasks{};
+
+  while (true) {
+    std::size_t active = 0;
+    while (active < kLanes && cursor.Next(tasks[active])) {
+      ++active;
+    }
+    if (active < min_tasks) {
+      for (std::size_t lane = 0; lane < active; ++lane) {
+        IterateOne(tasks[lane], iterations);
+      }
+      return;
+    }
+
+    for (std::size_t lane = 0; lane < active; ++lane) {
+      for (std::size_t word = 0; word < 8; ++word) {
+        const std::size_t at = (word * kLanes) + lane;
+        inner[at] = tasks[lane].inner[word];
+        outer[at] = tasks[lane].outer[word];
+        u[at] = sha256::LoadBigEndian32(tasks[lane].u1.data() + (word * 4));
+        t[at] = u[at];
+      }
+    }
+    iterate(inner.data(), outer.data(), u.data(), t.data(), iterations - 1);
+
+    for (std::size_t lane = 0; lane < active; ++lane) {
+      sha256::State words;
+      for (std::size_t word = 0; word < 8; ++word) {
+        words[word] = t[(word * kLanes) + lane];
+      }
+      WriteBlock(tasks[lane].out, words);
+    }
+    if (active < kLanes) {
+      return;
+    }
+  }
+}
+
+bool Pbkdf2HmacSha256Many(std::span<const Pbkdf2Request> requests,
+                          std::uint32_t iterations) noexcept {
+  if (iterations == 0) {
+    return false;
+  }
+  std::size_t tasks = 0;
+  for (const Pbkdf2Request& request : requests) {
+    const std::size_t blocks = OutputBlocks(request);
+    if (blocks == 0 || blocks > 0xffffffffU) {
+      return false;
+    }
+    tasks += blocks;
+  }
+
+  // SHA-NI 반복 한 번은 16레인 커널의 약 1/4, 8레인 커널의 약 1/6.5
+  // 시간이라 그보다 덜 찬 묶음은 단일 경로가 빠름
+  const bool sha_ni = IntrinEnabled(kSHA) && IntrinEnabled(kSSE41);
+  TaskCursor cursor(requests);
+  if (tasks > 1 && IntrinEnabled(kAVX512F) && IntrinEnabled(kAVX2)) {
+    IterateLanes<16>(cursor, iterations, pbkdf2::IterateLanesAvx512,
+                     sha_ni ? 5 : 2);
+  } else if (tasks > 1 && IntrinEnabled(kAVX2)) {
+    IterateLanes<8>(cursor, iterations, pbkdf2::IterateLanesAvx2,
+                    sha_ni ? 7 : 2);
+  } else {
+    TaskCursor::Task task{};
+    while (cursor.Next(task)) {
+      IterateOne(task, iterations);
+    }
+  }
+  return true;
+}
+
+bool Pbkdf2HmacSha256(std::span<const std::uint8_t> password,
+                      std::span<const std::uint8_t> salt,
+                      std::uint32_t iterations,
+                      std::span<std::uint8_t> out) noexcept {
+  const Pbkdf2Request request = {password, salt, out};
+  return Pbkdf2HmacSha256Many(std::span(&request, 1), iterations);
+}
+
+}  // namespace bedrock::hash
@@ -0,0 +1,125 @@
+#include <immintrin.h>
+
+#include "encryption/hash/pbkdf2.h"
+#include "encryption/hash/sha256_core.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::pbkdf2 {
+
+static inline __m256i Rotr(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_srli_epi32(x, n),
+                         _mm256_slli_epi32(x, 32 - n));
+}
+
+static inline __m256i Xor3(__m256i a, __m256i b, __m256i c) {
+  return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+}
+
+// 메시지가 32바이트 다이제스트 + 패딩(0x80, 0..., 길이 96바이트)인 블록을
+// mid에서 시작해 압축. W[8..15]가 상수라 처음 16라운드의 W + K는 미리 계산
+static inline void CompressDigest(const __m256i* mid, const __m256i* digest,
+                                  __m256i* out) {
+  static constexpr std::uint32_t kBits = (sha256::kBlockBytes + 32) * 8;
+  __m256i w[16];
+  for (std::size_t i = 0; i < 8; ++i) {
+    w[i] = digest[i];
+    w[i + 8] = _mm256_setzero_si256();
+  }
+  w[8] = _mm256_set1_epi32(static_cast<int>(0x80000000U));
+  w[15] = _mm256_set1_epi32(static_cast<int>(kBits));
+
+  __m256i a = mid[0];
+  __m256i b = mid[1];
+  __m256i c = mid[2];
+  __m256i d = mid[3];
+  __m256i e = mid[4];
+  __m256i f = mid[5];
+  __m256i g = mid[6];
+  __m256i h = mid[7];
+
+  for (std::size_t t = 0; t < 64; ++t) {
+    __m256i wk;
+    if (t < 8) {
+      wk = _mm256_add_epi32(w[t],
+                            _mm256_set1_epi32(static_cast<int>(sha256::kK[t])));
+    } else if (t < 16) {
+      const std::uint32_t fixed =
+          t == 8 ? 0x80000000U : (t == 15 ? kBits : 0U);
+      wk = _mm256_set1_epi32(static_cast<int>(sha256::kK[t] + fixed));
+    } else {
+      const __m256i w15 = w[(t - 15) % 16];
+      const __m256i w2 = w[(t - 2) % 16];
+      const __m256i s0 =
+          Xor3(Rotr(w15, 7), Rotr(w15, 18), _mm256_srli_epi32(w15, 3));
+      const __m256i s1 =
+          Xor3(Rotr(w2, 17), Rotr(w2, 19), _mm256_srli_epi32(w2, 10));
+      w[t % 16] = _mm256_add_epi32(
+          _mm256_add_epi32(w[t % 16], s0),
+          _mm256_add_epi32(w[(t - 7) % 16], s1));
+      wk = _mm256_add_epi32(w[t % 16],
+                            _mm256_set1_epi32(static_cast<int>(sha256::kK[t])));
+    }
+
+    const __m256i sigma1 = Xor3(Rotr(e, 6), Rotr(e, 11), Rotr(e, 25));
+    const __m256i ch =
+        _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+    const __m256i t1 =
+        _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, sigma1), ch), wk);
+    const __m256i sigma0 = Xor3(Rotr(a, 2), Rotr(a, 13), Rotr(a, 22));
+    const __m256i maj = _mm256_xor_si256(
+        _mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm256_add_epi32(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm256_add_epi32(t1, _mm256_add_epi32(sigma0, maj));
+  }
+
+  const __m256i v[8] = {a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < 8; ++i) {
+    out[i] = _mm256_add_epi32(mid[i], v[i]);
+  }
+}
+
+void IterateLanesAvx2(const std::uint32_t* inner, const std::uint32_t* outer,
+                      std::uint32_t* u, std::uint32_t* t,
+                      std::uint32_t iterations) noexcept {
+  constexpr std::size_t kLanes = 8;
+  __m256i inner_mid[8];
+  __m256i outer_mid[8];
+  __m256i u_words[8];
+  __m256i t_words[8];
+  for (std::size_t i = 0; i < 8; ++i) {
+    inner_mid[i] = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(inner + (i * kLanes)));
+    outer_mid[i] = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(outer + (i * kLanes)));
+    u_words[i] =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(u + (i * kLanes)));
+    t_words[i] =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t + (i * kLanes)));
+  }
+
+  // 다이제스트는 워드 그대로 다음 블록의 W[0..7]이 되므로 바이트 변환 없음
+  __m256i inner_digest[8];
+  for (std::uint32_t j = 0; j < iterations; ++j) {
+    CompressDigest(inner_mid, u_words, inner_digest);
+    CompressDigest(outer_mid, inner_digest, u_words);
+    for (std::size_t i = 0; i < 8; ++i) {
+      t_words[i] = _mm256_xor_si256(t_words[i], u_words[i]);
+    }
+  }
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(u + (i * kLanes)),
+                        u_words[i]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(t + (i * kLanes)),
+                        t_words[i]);
+  }
+}
+
+}  // namespace bedrock::hash::pbkdf2
@@ -0,0 +1,117 @@
+#include <immintrin.h>
+
+#include "encryption/hash/pbkdf2.h"
+#include "encryption/hash/sha256_core.h"
+
+// 이 파일만 -mavx2 -mavx512f로 컴파일됨 (compiler_options.cmake)
+// 회전은 vprord, Ch / Maj / 3항 XOR은 vpternlogd 한 번
+namespace bedrock::hash::pbkdf2 {
+
+static inline __m512i Xor3(__m512i a, __m512i b, __m512i c) {
+  return _mm512_ternarylogic_epi32(a, b, c, 0x96);
+}
+
+// AVX2 경로의 CompressDigest와 같은 고정 길이 블록 압축
+static inline void CompressDigest(const __m512i* mid, const __m512i* digest,
+                                  __m512i* out) {
+  static constexpr std::uint32_t kBits = (sha256::kBlockBytes + 32) * 8;
+  __m512i w[16];
+  for (std::size_t i = 0; i < 8; ++i) {
+    w[i] = digest[i];
+    w[i + 8] = _mm512_setzero_si512();
+  }
+  w[8] = _mm512_set1_epi32(static_cast<int>(0x80000000U));
+  w[15] = _mm512_set1_epi32(static_cast<int>(kBits));
+
+  __m512i a = mid[0];
+  __m512i b = mid[1];
+  __m512i c = mid[2];
+  __m512i d = mid[3];
+  __m512i e = mid[4];
+  __m512i f = mid[5];
+  __m512i g = mid[6];
+  __m512i h = mid[7];
+
+  for (std::size_t t = 0; t < 64; ++t) {
+    __m512i wk;
+    if (t < 8) {
+      wk = _mm512_add_epi32(w[t],
+                            _mm512_set1_epi32(static_cast<int>(sha256::kK[t])));
+    } else if (t < 16) {
+      const std::uint32_t fixed =
+          t == 8 ? 0x80000000U : (t == 15 ? kBits : 0U);
+      wk = _mm512_set1_epi32(static_cast<int>(sha256::kK[t] + fixed));
+    } else {
+      const __m512i w15 = w[(t - 15) % 16];
+      const __m512i w2 = w[(t - 2) % 16];
+      const __m512i s0 = Xor3(_mm512_ror_epi32(w15, 7),
+                              _mm512_ror_epi32(w15, 18),
+                              _mm512_srli_epi32(w15, 3));
+      const __m512i s1 = Xor3(_mm512_ror_epi32(w2, 17),
+                              _mm512_ror_epi32(w2, 19),
+                              _mm512_srli_epi32(w2, 10));
+      w[t % 16] = _mm512_add_epi32(
+          _mm512_add_epi32(w[t % 16], s0),
+          _mm512_add_epi32(w[(t - 7) % 16], s1));
+      wk = _mm512_add_epi32(w[t % 16],
+                            _mm512_set1_epi32(static_cast<int>(sha256::kK[t])));
+    }
+
+    const __m512i sigma1 = Xor3(_mm512_ror_epi32(e, 6),
+                                _mm512_ror_epi32(e, 11),
+                                _mm512_ror_epi32(e, 25));
+    const __m512i ch = _mm512_ternarylogic_epi32(e, f, g, 0xCA);
+    const __m512i t1 =
+        _mm512_add_epi32(_mm512_add_epi32(_mm512_add_epi32(h, sigma1), ch), wk);
+    const __m512i sigma0 = Xor3(_mm512_ror_epi32(a, 2),
+                                _mm512_ror_epi32(a, 13),
+                                _mm512_ror_epi32(a, 22));
+    const __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xE8);
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm512_add_epi32(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm512_add_epi32(t1, _mm512_add_epi32(sigma0, maj));
+  }
+
+  const __m512i v[8] = {a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < 8; ++i) {
+    out[i] = _mm512_add_epi32(mid[i], v[i]);
+  }
+}
+
+void IterateLanesAvx512(const std::uint32_t* inner, const std::uint32_t* outer,
+                        std::uint32_t* u, std::uint32_t* t,
+                        std::uint32_t iterations) noexcept {
+  constexpr std::size_t kLanes = 16;
+  __m512i inner_mid[8];
+  __m512i outer_mid[8];
+  __m512i u_words[8];
+  __m512i t_words[8];
+  for (std::size_t i = 0; i < 8; ++i) {
+    inner_mid[i] = _mm512_loadu_si512(inner + (i * kLanes));
+    outer_mid[i] = _mm512_loadu_si512(outer + (i * kLanes));
+    u_words[i] = _mm512_loadu_si512(u + (i * kLanes));
+    t_words[i] = _mm512_loadu_si512(t + (i * kLanes));
+  }
+
+  __m512i inner_digest[8];
+  for (std::uint32_t j = 0; j < iterations; ++j) {
+    CompressDigest(inner_mid, u_words, inner_digest);
+    CompressDigest(outer_mid, inner_digest, u_words);
+    for (std::size_t i = 0; i < 8; ++i) {
+      t_words[i] = _mm512_xor_si512(t_words[i], u_words[i]);
+    }
+  }
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    _mm512_storeu_si512(u + (i * kLanes), u_words[i]);
+    _mm512_storeu_si512(t + (i * kLanes), t_words[i]);
+  }
+}
+
+}  // namespace bedrock::hash::pbkdf2
@@ -0,0 +1,338 @@
+#include "encryption/hash/scrypt.h"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "common/intrinsics.h"
+#include "encryption/hash/pbkdf2.h"
+
+namespace bedrock::hash {
+
+enum ScryptIntrinSet { kAVX2 };
+
+static bool IntrinEnabled(ScryptIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 1> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+ScryptScratch::ScryptScratch(ScryptScratch&& other) noexcept
+    : data(std::exchange(other.data, nullptr)),
+      size(std::exchange(other.size, 0)),
+      huge_pages(std::exchange(other.huge_pages, false)) {}
+
+ScryptScratch& ScryptScratch::operator=(ScryptScratch&& other) noexcept {
+  if (this != &other) {
+    Release();
+    data = std::exchange(other.data, nullptr);
+    size = std::exchange(other.size, 0);
+    huge_pages = std::exchange(other.huge_pages, false);
+  }
+  return *this;
+}
+
+ScryptScratch::~ScryptScratch() { Release(); }
+
+#ifdef _WIN32
+
+bool ScryptScratch::Reserve(std::size_t bytes) noexcept {
+  if (bytes <= size) {
+    return true;
+  }
+  Release();
+
+  // 큰 페이지는 SeLockMemoryPrivilege가 있어야 하므로 실패하면 일반 페이지
+  const std::size_t large = GetLargePageMinimum();
+  if (large != 0 && bytes <= std::numeric_limits<std::size_t>::max() - large) {
+    const std::size_t rounded = (bytes + large - 1) / large * large;
+    void* p = VirtualAlloc(nullptr, rounded,
+                           MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                           PAGE_READWRITE);
+    if (p != nullptr) {
+      data = static_cast<std::uint8_t*>(p);
+      size = rounded;
+      huge_pages = true;
+      return true;
+    }
+  }
+  void* p =
+      VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+  if (p == nullptr) {
+    return false;
+  }
+  data = static_cast<std::uint8_t*>(p);
+  size = bytes;
+  huge_pages = false;
+  return true;
+}
+
+void ScryptScratch::Release() noexcept {
+  if (data != nullptr) {
+    VirtualFree(data, 0, MEM_RELEASE);
+  }
+  data = nullptr;
+  size = 0;
+  huge_pages = false;
+}
+
+#else
+
+bool ScryptScratch::Reserve(std::size_t bytes) noexcept {
+  if (bytes <= size) {
+    return true;
+  }
+  Release();
+
+  // 예약된 큰 페이지(MAP_HUGETLB)가 없으면 일반 매핑에 THP를 요청
+  constexpr std::size_t kHugePage = std::size_t{2} << 20;
+  if (bytes > std::numeric_limits<std::size_t>::max() - kHugePage) {
+    return false;
+  }
+  const std::size_t rounded = (bytes + kHugePage - 1) / kHugePage * kHugePage;
+  void* p = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  huge_pages = p != MAP_FAILED;
+  if (!huge_pages) {
+    p = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+      return false;
+    }
+    madvise(p, rounded, MADV_HUGEPAGE);
+  }
+  data = static_cast<std::uint8_t*>(p);
+  size = rounded;
+  return true;
+}
+
+void ScryptScratch::Release() noexcept {
+  if (data != nullptr) {
+    munmap(data, size);
+  }
+  data = nullptr;
+  size = 0;
+  huge_pages = false;
+}
+
+#endif
+
+namespace scrypt {
+
+static inline __m128i Rotl(__m128i x, int n) {
+  return _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n));
+}
+
+// Salsa20/8. 행 x[k]는 대각선 배치라 열 / 행 라운드 사이에 행 회전만 필요
+static inline void Salsa8(__m128i* x) {
+  __m128i x0 = x[0];
+  __m128i x1 = x[1];
+  __m128i x2 = x[2];
+  __m128i x3 = x[3];
+  for (int i = 0; i < 8; i += 2) {
+    x1 = _mm_xor_si128(x1, Rotl(_mm_add_epi32(x0, x3), 7));
+    x2 = _mm_xor_si128(x2, Rotl(_mm_add_epi32(x1, x0), 9));
+    x3 = _mm_xor_si128(x3, Rotl(_mm_add_epi32(x2, x1), 13));
+    x0 = _mm_xor_si128(x0, Rotl(_mm_add_epi32(x3, x2), 18));
+    x1 = _mm_shuffle_epi32(x1, 0x93);
+    x2 = _mm_shuffle_epi32(x2, 0x4E);
+    x3 = _mm_shuffle_epi32(x3, 0x39);
+
+    x3 = _mm_xor_si128(x3, Rotl(_mm_add_epi32(x0, x1), 7));
+    x2 = _mm_xor_si128(x2, Rotl(_mm_add_epi32(x3, x0), 9));
+    x1 = _mm_xor_si128(x1, Rotl(_mm_add_epi32(x2, x3), 13));
+    x0 = _mm_xor_si128(x0, Rotl(_mm_add_epi32(x1, x2), 18));
+    x1 = _mm_shuffle_epi32(x1, 0x39);
+    x2 = _mm_shuffle_epi32(x2, 0x4E);
+    x3 = _mm_shuffle_epi32(x3, 0x93);
+  }
+  x[0] = _mm_add_epi32(x[0], x0);
+  x[1] = _mm_add_epi32(x[1], x1);
+  x[2] = _mm_add_epi32(x[2], x2);
+  x[3] = _mm_add_epi32(x[3], x3);
+}
+
+// out = BlockMix(in ^ mix). kMix가 아니면 mix는 쓰지 않음
+// 짝수 번째 결과는 앞쪽 절반, 홀수 번째는 뒤쪽 절반에 놓음
+template <bool kMix>
+static inline void BlockMix(const __m128i* in, const __m128i* mix,
+                            __m128i* out, std::size_t r) {
+  const auto row = [&](std::size_t k) {
+    if constexpr (kMix) {
+      return _mm_xor_si128(in[k], mix[k]);
+    } else {
+      return in[k];
+    }
+  };
+
+  const std::size_t last = ((2 * r) - 1) * 4;
+  __m128i x[4] = {row(last), row(last + 1), row(last + 2), row(last + 3)};
+  for (std::size_t block = 0; block < 2 * r; ++block) {
+    for (std::size_t k = 0; k < 4; ++k) {
+      x[k] = _mm_xor_si128(x[k], row((block * 4) + k));
+    }
+    Salsa8(x);
+    __m128i* dst = out + (((block / 2) + ((block % 2) * r)) * 4);
+    for (std::size_t k = 0; k < 4; ++k) {
+      dst[k] = x[k];
+    }
+  }
+}
+
+// 마지막 블록의 첫 64비트. 배치상 워드 0은 행 0의 0번, 워드 1은 행 3의 1번
+static inline std::uint64_t Integerify(const __m128i* x, std::size_t r) {
+  const __m128i* block = x + (((2 * r) - 1) * 4);
+  const auto lo = static_cast<std::uint32_t>(_mm_cvtsi128_si32(block[0]));
+  const auto hi = static_cast<std::uint32_t>(
+      _mm_cvtsi128_si32(_mm_shuffle_epi32(block[3], 0x01)));
+  return (std::uint64_t{hi} << 32) | lo;
+}
+
+void RoMixSse2(std::uint8_t* b, std::size_t r, std::uint64_t n,
+               std::uint8_t* v, std::uint8_t* xy) noexcept {
+  const std::size_t rows = 8 * r;
+  // 블록마다 워드 i 자리에 원래 워드 5i mod 16을 두는 대각선 배치
+  for (std::size_t block = 0; block < 2 * r; ++block) {
+    for (std::size_t i = 0; i < 16; ++i) {
+      std::memcpy(xy + (block * 64) + (i * 4),
+                  b + (block * 64) + (((i * 5) % 16) * 4), 4);
+    }
+  }
+
+  auto* x = reinterpret_cast<__m128i*>(xy);
+  __m128i* y = x + rows;
+  auto* vv = reinterpret_cast<__m128i*>(v);
+
+  // V[i + 1] = BlockMix(V[i])를 V에 바로 써서 복사를 줄임
+  std::memcpy(vv, x, rows * sizeof(__m128i));
+  for (std::uint64_t i = 0; i + 1 < n; ++i) {
+    BlockMix<false>(vv + (i * rows), nullptr, vv + ((i + 1) * rows), r);
+  }
+  BlockMix<false>(vv + ((n - 1) * rows), nullptr, x, r);
+
+  // n이 짝수라 x / y를 번갈아 쓰면 끝에서 다시 x에 결과가 남음
+  for (std::uint64_t i = 0; i < n; i += 2) {
+    BlockMix<true>(x, vv + ((Integerify(x, r) & (n - 1)) * rows), y, r);
+    BlockMix<true>(y, vv + ((Integerify(y, r) & (n - 1)) * rows), x, r);
+  }
+
+  for (std::size_t block = 0; block < 2 * r; ++block) {
+    for (std::size_t i = 0; i < 16; ++i) {
+      std::memcpy(b + (block * 64) + (((i * 5) % 16) * 4),
+                  xy + (block * 64) + (i * 4), 4);
+    }
+  }
+}
+
+}  // namespace scrypt
+
+// a * b가 size_t를 넘으면 false
+static bool Multiply(std::size_t a, std::size_t b, std::size_t& product) {
+  if (a != 0 && b > std::numeric_limits<std::size_t>::max() / a) {
+    return false;
+  }
+  product = a * b;
+  return true;
+}
+
+bool Scrypt(std::span<const std::uint8_t> password,
+            std::span<const std::uint8_t> salt, const ScryptParams& params,
+            std::span<std::uint8_t> out, ScryptScratch& scratch,
+            std::size_t threads) noexcept {
+  const std::uint64_t n = params.n;
+  const std::size_t r = params.r;
+  const std::size_t p = params.p;
+  // RFC 7914: n < 2^(128 * r / 8), p <= (2^32 - 1) * 32 / (128 * r)
+  if (n < 2 || (n & (n - 1)) != 0 || r == 0 || p == 0 || out.empty() ||
+      (r < 4 && n >> (16 * r) != 0) || r * p >= (std::size_t{1} << 30)) {
+    return false;
+  }
+
+  const std::size_t width = IntrinEnabled(kAVX2) ? 2 : 1;
+  const std::size_t groups = (p + width - 1) / width;
+  // 레인 묶음 수와 하드웨어 스레드 수보다 많이 띄우지 않음
+  const std::size_t hardware =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  const std::size_t workers =
+      std::clamp<std::size_t>(threads, 1, std::min(groups, hardware));
+  const std::size_t lane_bytes = 128 * r;
+  const std::size_t b_bytes = lane_bytes * p;
+  const std::size_t xy_bytes = 2 * lane_bytes * width;
+
+  // [B: 블록 p개][작업자마다 V(레인 width개) + xy]
+  std::size_t v_bytes = 0;
+  std::size_t all_workers = 0;
+  if (!Multiply(lane_bytes * width, n, v_bytes) ||
+      v_bytes > std::numeric_limits<std::size_t>::max() - xy_bytes ||
+      !Multiply(v_bytes + xy_bytes, workers, all_workers) ||
+      all_workers > std::numeric_limits<std::size_t>::max() - b_bytes ||
+      !scratch.Reserve(b_bytes + all_workers)) {
+    return false;
+  }
+  const std::size_t worker_bytes = all_workers / workers;
+
+  std::uint8_t* b = scratch.Data();
+  const std::span<std::uint8_t> blocks(b, b_bytes);
+  if (!Pbkdf2HmacSha256(password, salt, 1, blocks)) {
+    std::memset(b, 0, b_bytes);
+    return false;
+  }
+
+  const auto run = [&](std::size_t worker) {
+    std::uint8_t* v = b + b_bytes + (worker * worker_bytes);
+    std::uint8_t* xy = v + v_bytes;
+    for (std::size_t group = worker; group < groups; group += workers) {
+      const std::size_t lane = group * width;
+      if (width == 2 && lane + 1 < p) {
+        scrypt::RoMix2Avx2(b + (lane * lane_bytes),
+                           b + ((lane + 1) * lane_bytes), r, n, v, xy);
+      } else {
+        scrypt::RoMixSse2(b + (lane * lane_bytes), r, n, v, xy);
+      }
+    }
+  };
+  std::vector<std::thread> pool;
+  pool.reserve(workers - 1);
+  for (std::size_t worker = 1; worker < workers; ++worker) {
+    pool.emplace_back(run, worker);
+  }
+  run(0);
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+
+  const bool derived = Pbkdf2HmacSha256(password, blocks, 1, out);
+  // 재사용되는 작업 메모리에 비밀번호에서 나온 값(B, V, XY)을 남기지 않음
+  std::memset(b, 0, b_bytes + all_workers);
+  return derived;
+}
+
+bool Scrypt(std::span<const std::uint8_t> password,
+            std::span<const std::uint8_t> salt, const ScryptParams& params,
+            std::span<std::uint8_t> out) noexcept {
+  ScryptScratch scratch;
+  return Scrypt(password, salt, params, out, scratch);
+}
+
+}  // namespace bedrock::hash
@@ -0,0 +1,134 @@
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "encryption/hash/scrypt.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+// 행 하나 = [레인 0의 대각선 행 | 레인 1의 대각선 행]. 셔플이 128비트
+// 반쪽 안에서만 움직이므로 SSE2 경로와 같은 순서로 두 레인이 함께 진행
+namespace bedrock::hash::scrypt {
+
+static inline __m256i Rotl(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, n),
+                         _mm256_srli_epi32(x, 32 - n));
+}
+
+static inline void Salsa8(__m256i* x) {
+  __m256i x0 = x[0];
+  __m256i x1 = x[1];
+  __m256i x2 = x[2];
+  __m256i x3 = x[3];
+  for (int i = 0; i < 8; i += 2) {
+    x1 = _mm256_xor_si256(x1, Rotl(_mm256_add_epi32(x0, x3), 7));
+    x2 = _mm256_xor_si256(x2, Rotl(_mm256_add_epi32(x1, x0), 9));
+    x3 = _mm256_xor_si256(x3, Rotl(_mm256_add_epi32(x2, x1), 13));
+    x0 = _mm256_xor_si256(x0, Rotl(_mm256_add_epi32(x3, x2), 18));
+    x1 = _mm256_shuffle_epi32(x1, 0x93);
+    x2 = _mm256_shuffle_epi32(x2, 0x4E);
+    x3 = _mm256_shuffle_epi32(x3, 0x39);
+
+    x3 = _mm256_xor_si256(x3, Rotl(_mm256_add_epi32(x0, x1), 7));
+    x2 = _mm256_xor_si256(x2, Rotl(_mm256_add_epi32(x3, x0), 9));
+    x1 = _mm256_xor_si256(x1, Rotl(_mm256_add_epi32(x2, x3), 13));
+    x0 = _mm256_xor_si256(x0, Rotl(_mm256_add_epi32(x1, x2), 18));
+    x1 = _mm256_shuffle_epi32(x1, 0x39);
+    x2 = _mm256_shuffle_epi32(x2, 0x4E);
+    x3 = _mm256_shuffle_epi32(x3, 0x93);
+  }
+  x[0] = _mm256_add_epi32(x[0], x0);
+  x[1] = _mm256_add_epi32(x[1], x1);
+  x[2] = _mm256_add_epi32(x[2], x2);
+  x[3] = _mm256_add_epi32(x[3], x3);
+}
+
+// out = BlockMix(in ^ mix). 두 레인의 V 인덱스가 달라 섞을 행의 아래쪽
+// 반은 mix0, 위쪽 반은 mix1에서 가져옴
+template <bool kMix>
+static inline void BlockMix(const __m256i* in, const __m256i* mix0,
+                            const __m256i* mix1, __m256i* out,
+                            std::size_t r) {
+  const auto row = [&](std::size_t k) {
+    if constexpr (kMix) {
+      return _mm256_xor_si256(in[k],
+                              _mm256_blend_epi32(mix0[k], mix1[k], 0xF0));
+    } else {
+      return in[k];
+    }
+  };
+
+  const std::size_t last = ((2 * r) - 1) * 4;
+  __m256i x[4] = {row(last), row(last + 1), row(last + 2), row(last + 3)};
+  for (std::size_t block = 0; block < 2 * r; ++block) {
+    for (std::size_t k = 0; k < 4; ++k) {
+      x[k] = _mm256_xor_si256(x[k], row((block * 4) + k));
+    }
+    Salsa8(x);
+    __m256i* dst = out + (((block / 2) + ((block % 2) * r)) * 4);
+    for (std::size_t k = 0; k < 4; ++k) {
+      dst[k] = x[k];
+    }
+  }
+}
+
+// 레인 0은 32비트 요소 0 / 1, 레인 1은 4 / 5 (행 0과 행 3)
+static inline std::uint64_t Integerify0(const __m256i* x, std::size_t r) {
+  const __m256i* block = x + (((2 * r) - 1) * 4);
+  const auto lo = static_cast<std::uint32_t>(_mm256_extract_epi32(block[0], 0));
+  const auto hi = static_cast<std::uint32_t>(_mm256_extract_epi32(block[3], 1));
+  return (std::uint64_t{hi} << 32) | lo;
+}
+
+static inline std::uint64_t Integerify1(const __m256i* x, std::size_t r) {
+  const __m256i* block = x + (((2 * r) - 1) * 4);
+  const auto lo = static_cast<std::uint32_t>(_mm256_extract_epi32(block[0], 4));
+  const auto hi = static_cast<std::uint32_t>(_mm256_extract_epi32(block[3], 5));
+  return (std::uint64_t{hi} << 32) | lo;
+}
+
+void RoMix2Avx2(std::uint8_t* b0, std::uint8_t* b1, std::size_t r,
+                std::uint64_t n, std::uint8_t* v, std::uint8_t* xy) noexcept {
+  const std::size_t rows = 8 * r;
+  std::uint8_t* const lanes[2] = {b0, b1};
+  // 블록 하나 = 행 4개 x 32바이트. 워드 i는 행 i / 4, 레인 반쪽의 i % 4번
+  for (std::size_t lane = 0; lane < 2; ++lane) {
+    for (std::size_t block = 0; block < 2 * r; ++block) {
+      for (std::size_t i = 0; i < 16; ++i) {
+        std::memcpy(
+            xy + (block * 128) + ((i / 4) * 32) + (lane * 16) + ((i % 4) * 4),
+            lanes[lane] + (block * 64) + (((i * 5) % 16) * 4), 4);
+      }
+    }
+  }
+
+  auto* x = reinterpret_cast<__m256i*>(xy);
+  __m256i* y = x + rows;
+  auto* vv = reinterpret_cast<__m256i*>(v);
+
+  std::memcpy(vv, x, rows * sizeof(__m256i));
+  for (std::uint64_t i = 0; i + 1 < n; ++i) {
+    BlockMix<false>(vv + (i * rows), nullptr, nullptr, vv + ((i + 1) * rows),
+                    r);
+  }
+  BlockMix<false>(vv + ((n - 1) * rows), nullptr, nullptr, x, r);
+
+  for (std::uint64_t i = 0; i < n; i += 2) {
+    BlockMix<true>(x, vv + ((Integerify0(x, r) & (n - 1)) * rows),
+                   vv + ((Integerify1(x, r) & (n - 1)) * rows), y, r);
+    BlockMix<true>(y, vv + ((Integerify0(y, r) & (n - 1)) * rows),
+                   vv + ((Integerify1(y, r) & (n - 1)) * rows), x, r);
+  }
+
+  for (std::size_t lane = 0; lane < 2; ++lane) {
+    for (std::size_t block = 0; block < 2 * r; ++block) {
+      for (std::size_t i = 0; i < 16; ++i) {
+        std::memcpy(
+            lanes[lane] + (block * 64) + (((i * 5) % 16) * 4),
+            xy + (block * 128) + ((i / 4) * 32) + (lane * 16) + ((i % 4) * 4),
+            4);
+      }
+    }
+  }
+}
+
+}  // namespace bedrock::hash::scrypt
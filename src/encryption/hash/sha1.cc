@@ -0,0 +1,123 @@
+#include <tmmintrin.h>
+
+#include <array>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha1_core.h"
+
+namespace bedrock::hash::sha1 {
+
+enum Sha1IntrinSet { kSHA, kSSE41, kSSSE3 };
+
+static bool IntrinEnabled(Sha1IntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 3> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SHA"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSE4.1"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSSE3")};
+
+  switch (target) {
+    case kSHA:
+      return enabled[target];
+    case kSSE41:
+      return enabled[target];
+    case kSSSE3:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+using CompressFn = void (*)(State& h, const std::uint8_t* data,
+                            std::size_t blocks) noexcept;
+
+static CompressFn PickCompress() {
+  if (IntrinEnabled(kSHA) && IntrinEnabled(kSSE41)) {
+    return CompressBlocksShaNi;
+  }
+  if (IntrinEnabled(kSSSE3)) {
+    return CompressBlocksSsse3;
+  }
+  return CompressBlocksScalar;
+}
+
+void CompressBlocksScalar(State& h, const std::uint8_t* data,
+                          std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    CompressBytes(h, data + (block * kBlockBytes));
+  }
+}
+
+static inline __m128i Rotl(__m128i x, int n) {
+  return _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n));
+}
+
+// W[t .. t+3]. w0 = W[t-16 ..], w1 = W[t-12 ..], w2 = W[t-8 ..], w3 = W[t-4 ..]
+// W[t+3]은 같은 묶음의 W[t]에 의존하므로 0으로 두고 계산한 뒤
+// rotl(W[t], 1)을 마지막 워드에 XOR해 보정
+static inline __m128i NextWords(__m128i w0, __m128i w1, __m128i w2,
+                                __m128i w3) {
+  const __m128i x = _mm_xor_si128(
+      _mm_xor_si128(w0, _mm_alignr_epi8(w1, w0, 8)),
+      _mm_xor_si128(w2, _mm_srli_si128(w3, 4)));
+  const __m128i next = Rotl(x, 1);
+  return _mm_xor_si128(next, _mm_slli_si128(Rotl(next, 1), 12));
+}
+
+// 한 단계에 필요한 W + K 20개(5묶음)를 만들어 둠
+static inline void FillStage(__m128i* w, std::uint32_t* k_plus_w,
+                             std::size_t stage) {
+  const __m128i k = _mm_set1_epi32(static_cast<int>(kK[stage]));
+  for (std::size_t i = 0; i < 5; ++i) {
+    const std::size_t group = (stage * 5) + i;
+    if (group >= 4) {
+      const __m128i next = NextWords(w[0], w[1], w[2], w[3]);
+      w[0] = w[1];
+      w[1] = w[2];
+      w[2] = w[3];
+      w[3] = next;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(k_plus_w + (i * 4)),
+                     _mm_add_epi32(w[group < 4 ? group : 3], k));
+  }
+}
+
+void CompressBlocksSsse3(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept {
+  const __m128i bswap =
+      _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const auto* in =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    __m128i w[4];
+    for (std::size_t i = 0; i < 4; ++i) {
+      w[i] = _mm_shuffle_epi8(_mm_loadu_si128(in + i), bswap);
+    }
+
+    State v = h;
+    std::array<std::uint32_t, 20> k_plus_w{};
+    FillStage(w, k_plus_w.data(), 0);
+    TwentyRounds<0>(v, k_plus_w.data());
+    FillStage(w, k_plus_w.data(), 1);
+    TwentyRounds<1>(v, k_plus_w.data());
+    FillStage(w, k_plus_w.data(), 2);
+    TwentyRounds<2>(v, k_plus_w.data());
+    FillStage(w, k_plus_w.data(), 3);
+    TwentyRounds<3>(v, k_plus_w.data());
+
+    for (std::size_t i = 0; i < 5; ++i) {
+      h[i] += v[i];
+    }
+  }
+}
+
+void CompressBlocks(State& h, const std::uint8_t* data,
+                    std::size_t blocks) noexcept {
+  static const CompressFn compress = PickCompress();
+  compress(h, data, blocks);
+}
+
+}  // namespace bedrock::hash::sha1
@@ -0,0 +1,79 @@
+#include <immintrin.h>
+
+#include "encryption/hash/sha1_core.h"
+
+// 이 파일만 -msha -msse4.1로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::sha1 {
+
+// 4라운드 묶음 group(0..19) 하나. msg[g % 4] = W[4g .. 4g+3]
+// sha1rnds4의 함수 선택은 즉시값이어야 하므로 단계를 템플릿 인자로
+template <int kStage>
+static inline void FourRounds(__m128i& abcd, __m128i* e, __m128i* msg,
+                              std::size_t group) {
+  __m128i& current = e[group % 2];
+  if (group == 0) {
+    current = _mm_add_epi32(current, msg[0]);
+  } else {
+    current = _mm_sha1nexte_epu32(current, msg[group % 4]);
+  }
+  e[(group + 1) % 2] = abcd;
+
+  // 다음 묶음들의 W: msg1 -> XOR -> msg2 순서로 세 묶음에 걸쳐 완성
+  if (group >= 3 && group <= 18) {
+    msg[(group + 1) % 4] =
+        _mm_sha1msg2_epu32(msg[(group + 1) % 4], msg[group % 4]);
+  }
+  abcd = _mm_sha1rnds4_epu32(abcd, current, kStage);
+  if (group >= 1 && group <= 16) {
+    msg[(group + 3) % 4] =
+        _mm_sha1msg1_epu32(msg[(group + 3) % 4], msg[group % 4]);
+  }
+  if (group >= 2 && group <= 17) {
+    msg[(group + 2) % 4] = _mm_xor_si128(msg[(group + 2) % 4], msg[group % 4]);
+  }
+}
+
+template <int kStage>
+static inline void Stage(__m128i& abcd, __m128i* e, __m128i* msg) {
+  for (std::size_t i = 0; i < 5; ++i) {
+    FourRounds<kStage>(abcd, e, msg, (kStage * 5) + i);
+  }
+}
+
+// sha1rnds4는 A..D를 한 레지스터(A가 최상위 워드)에, E를 따로 받음
+void CompressBlocksShaNi(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept {
+  const __m128i bswap =
+      _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+  __m128i abcd = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(h.data())), 0x1B);
+  __m128i e0 = _mm_set_epi32(static_cast<int>(h[4]), 0, 0, 0);
+
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const auto* in =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    const __m128i abcd_save = abcd;
+    const __m128i e_save = e0;
+
+    __m128i msg[4];
+    for (std::size_t i = 0; i < 4; ++i) {
+      msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(in + i), bswap);
+    }
+    __m128i e[2] = {e0, _mm_setzero_si128()};
+    Stage<0>(abcd, e, msg);
+    Stage<1>(abcd, e, msg);
+    Stage<2>(abcd, e, msg);
+    Stage<3>(abcd, e, msg);
+
+    // 마지막 묶음 직전의 A가 e[0]에 남아 있음
+    e0 = _mm_sha1nexte_epu32(e[0], e_save);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+  }
+
+  abcd = _mm_shuffle_epi32(abcd, 0x1B);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(h.data()), abcd);
+  h[4] = static_cast<std::uint32_t>(_mm_extract_epi32(e0, 3));
+}
+
+}  // namespace bedrock::hash::sha1
@@ -0,0 +1,154 @@
+#include <tmmintrin.h>
+
+#include <array>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha256_core.h"
+
+namespace bedrock::hash::sha256 {
+
+enum Sha256IntrinSet { kSHA, kSSE41, kSSSE3, kAVX2 };
+
+static bool IntrinEnabled(Sha256IntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 4> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SHA"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSE4.1"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSSE3"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kSHA:
+      return enabled[target];
+    case kSSE41:
+      return enabled[target];
+    case kSSSE3:
+      return enabled[target];
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+using CompressFn = void (*)(State& h, const std::uint8_t* data,
+                            std::size_t blocks) noexcept;
+
+static CompressFn PickCompress() {
+  if (IntrinEnabled(kSHA) && IntrinEnabled(kSSE41)) {
+    return CompressBlocksShaNi;
+  }
+  if (IntrinEnabled(kAVX2)) {
+    return CompressBlocksAvx2;
+  }
+  if (IntrinEnabled(kSSSE3)) {
+    return CompressBlocksSsse3;
+  }
+  return CompressBlocksScalar;
+}
+
+void CompressBlocksScalar(State& h, const std::uint8_t* data,
+                          std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    CompressBytes(h, data + (block * kBlockBytes));
+  }
+}
+
+static inline __m128i Rotr(__m128i x, int n) {
+  return _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - n));
+}
+
+static inline __m128i SmallSigma0(__m128i x) {
+  return _mm_xor_si128(_mm_xor_si128(Rotr(x, 7), Rotr(x, 18)),
+                       _mm_srli_epi32(x, 3));
+}
+
+static inline __m128i SmallSigma1(__m128i x) {
+  return _mm_xor_si128(_mm_xor_si128(Rotr(x, 17), Rotr(x, 19)),
+                       _mm_srli_epi32(x, 10));
+}
+
+// W[t .. t+3]. w0 = W[t-16 ..], w1 = W[t-12 ..], w2 = W[t-8 ..], w3 = W[t-4 ..]
+// σ1 항은 W[t-2]에 의존하므로 두 워드씩 두 번에 나눠 더함
+static inline __m128i NextWords(__m128i w0, __m128i w1, __m128i w2,
+                                __m128i w3) {
+  __m128i next = _mm_add_epi32(
+      _mm_add_epi32(w0, SmallSigma0(_mm_alignr_epi8(w1, w0, 4))),
+      _mm_alignr_epi8(w3, w2, 4));
+  next = _mm_add_epi32(next, _mm_srli_si128(SmallSigma1(w3), 8));
+  return _mm_add_epi32(next, _mm_slli_si128(SmallSigma1(next), 8));
+}
+
+static inline void StoreKPlusW(std::uint32_t* out, __m128i w,
+                               std::size_t group) {
+  const __m128i k = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(kK.data() + (group * 4)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_add_epi32(w, k));
+}
+
+void CompressBlocksSsse3(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept {
+  const __m128i bswap =
+      _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const auto* in =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(in), bswap);
+    __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), bswap);
+    __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), bswap);
+    __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), bswap);
+
+    State v = h;
+    std::array<std::uint32_t, 8> k_plus_w{};
+    StoreKPlusW(k_plus_w.data(), w0, 0);
+    StoreKPlusW(k_plus_w.data() + 4, w1, 1);
+    EightRounds(v, k_plus_w.data());
+    StoreKPlusW(k_plus_w.data(), w2, 2);
+    StoreKPlusW(k_plus_w.data() + 4, w3, 3);
+    EightRounds(v, k_plus_w.data());
+
+    for (std::size_t group = 4; group < 16; group += 2) {
+      for (std::size_t i = 0; i < 2; ++i) {
+        const __m128i next = NextWords(w0, w1, w2, w3);
+        w0 = w1;
+        w1 = w2;
+        w2 = w3;
+        w3 = next;
+        StoreKPlusW(k_plus_w.data() + (i * 4), next, group + i);
+      }
+      EightRounds(v, k_plus_w.data());
+    }
+
+    for (std::size_t i = 0; i < 8; ++i) {
+      h[i] += v[i];
+    }
+  }
+}
+
+void CompressBlocks(State& h, const std::uint8_t* data,
+                    std::size_t blocks) noexcept {
+  static const CompressFn compress = PickCompress();
+  compress(h, data, blocks);
+}
+
+void CompressKPlusWScalar(State& h, const std::uint32_t* k_plus_w) noexcept {
+  State v = h;
+  for (std::size_t group = 0; group < 8; ++group) {
+    EightRounds(v, k_plus_w + (group * 8));
+  }
+  for (std::size_t i = 0; i < 8; ++i) {
+    h[i] += v[i];
+  }
+}
+
+void CompressKPlusW(State& h, const std::uint32_t* k_plus_w) noexcept {
+  static const auto compress =
+      IntrinEnabled(kSHA) && IntrinEnabled(kSSE41) ? CompressKPlusWShaNi
+                                                   : CompressKPlusWScalar;
+  compress(h, k_plus_w);
+}
+
+}  // namespace bedrock::hash::sha256
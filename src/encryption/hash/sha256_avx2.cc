@@ -0,0 +1,109 @@
+#include <immintrin.h>
+
+#include <array>
+
+#include "encryption/hash/sha256_core.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::sha256 {
+
+static inline __m256i Rotr(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_srli_epi32(x, n),
+                         _mm256_slli_epi32(x, 32 - n));
+}
+
+static inline __m256i SmallSigma0(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(Rotr(x, 7), Rotr(x, 18)),
+                          _mm256_srli_epi32(x, 3));
+}
+
+static inline __m256i SmallSigma1(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(Rotr(x, 17), Rotr(x, 19)),
+                          _mm256_srli_epi32(x, 10));
+}
+
+// 128-bit 레인마다 SSSE3 경로의 NextWords와 같은 계산
+static inline __m256i NextWords(__m256i w0, __m256i w1, __m256i w2,
+                                __m256i w3) {
+  __m256i next = _mm256_add_epi32(
+      _mm256_add_epi32(w0, SmallSigma0(_mm256_alignr_epi8(w1, w0, 4))),
+      _mm256_alignr_epi8(w3, w2, 4));
+  next = _mm256_add_epi32(next, _mm256_bsrli_epi128(SmallSigma1(w3), 8));
+  return _mm256_add_epi32(next, _mm256_bslli_epi128(SmallSigma1(next), 8));
+}
+
+// 아래 레인(첫 블록)은 바로 쓸 8라운드 버퍼로, 위 레인(둘째 블록)은
+// 나중에 돌릴 64라운드 버퍼로
+static inline void StoreKPlusW(std::uint32_t* first, std::uint32_t* second,
+                               __m256i w, std::size_t group) {
+  const __m256i k = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(kK.data() + (group * 4))));
+  const __m256i sum = _mm256_add_epi32(w, k);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(first),
+                   _mm256_castsi256_si128(sum));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(second + (group * 4)),
+                   _mm256_extracti128_si256(sum, 1));
+}
+
+static inline __m256i LoadPair(const __m128i* first, const __m128i* second,
+                               __m256i bswap) {
+  return _mm256_shuffle_epi8(_mm256_loadu2_m128i(second, first), bswap);
+}
+
+static inline void AddState(State& h, const State& v) {
+  for (std::size_t i = 0; i < 8; ++i) {
+    h[i] += v[i];
+  }
+}
+
+void CompressBlocksAvx2(State& h, const std::uint8_t* data,
+                        std::size_t blocks) noexcept {
+  const __m256i bswap = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6,
+      5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  std::size_t block = 0;
+
+  for (; block + 2 <= blocks; block += 2) {
+    const auto* first =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    const auto* second = first + 4;
+    __m256i w0 = LoadPair(first, second, bswap);
+    __m256i w1 = LoadPair(first + 1, second + 1, bswap);
+    __m256i w2 = LoadPair(first + 2, second + 2, bswap);
+    __m256i w3 = LoadPair(first + 3, second + 3, bswap);
+
+    std::array<std::uint32_t, 8> first_wk{};
+    std::array<std::uint32_t, 64> second_wk{};
+    State v = h;
+    StoreKPlusW(first_wk.data(), second_wk.data(), w0, 0);
+    StoreKPlusW(first_wk.data() + 4, second_wk.data(), w1, 1);
+    EightRounds(v, first_wk.data());
+    StoreKPlusW(first_wk.data(), second_wk.data(), w2, 2);
+    StoreKPlusW(first_wk.data() + 4, second_wk.data(), w3, 3);
+    EightRounds(v, first_wk.data());
+
+    for (std::size_t group = 4; group < 16; group += 2) {
+      for (std::size_t i = 0; i < 2; ++i) {
+        const __m256i next = NextWords(w0, w1, w2, w3);
+        w0 = w1;
+        w1 = w2;
+        w2 = w3;
+        w3 = next;
+        StoreKPlusW(first_wk.data() + (i * 4), second_wk.data(), next,
+                    group + i);
+      }
+      EightRounds(v, first_wk.data());
+    }
+    AddState(h, v);
+
+    v = h;
+    for (std::size_t round = 0; round < 64; round += 8) {
+      EightRounds(v, second_wk.data() + round);
+    }
+    AddState(h, v);
+  }
+
+  CompressBlocksSsse3(h, data + (block * kBlockBytes), blocks - block);
+}
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,178 @@
+#include "encryption/hash/sha256_fixed.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/intrinsics.h"
+
+namespace bedrock::hash::sha256 {
+
+enum Sha256FixedIntrinSet { kAVX2, kAVX512F, kSHA, kSSE41 };
+
+static bool IntrinEnabled(Sha256FixedIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 4> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX512F"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SHA"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSE4.1")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    case kAVX512F:
+      return enabled[target];
+    case kSHA:
+      return enabled[target];
+    case kSSE41:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+static Digest Output(const State& h) noexcept {
+  Digest digest;
+  for (std::size_t i = 0; i < 8; ++i) {
+    StoreBigEndian32(digest.data() + (i * 4), h[i]);
+  }
+  return digest;
+}
+
+// 32바이트 입력의 유일한 블록: 데이터, 0x80, 0..., 비트 길이 256
+static Block64 PadBlock32(const std::uint8_t* data) noexcept {
+  Block64 block{};
+  std::memcpy(block.data(), data, kDigestBytes);
+  block[kDigestBytes] = 0x80;
+  StoreBigEndian32(block.data() + kBlockBytes - 4, kDigestBytes * 8);
+  return block;
+}
+
+// 블록 하나 + 패딩 블록. SHA-NI면 디스패치를 한 번만 거치도록 직접 호출
+using CompressPairFn = void (*)(State& h, const std::uint8_t* block) noexcept;
+
+static void CompressPairShaNi(State& h, const std::uint8_t* block) noexcept {
+  CompressBlocksShaNi(h, block, 1);
+  CompressKPlusWShaNi(h, kPad64KPlusW.data());
+}
+
+static void CompressPair(State& h, const std::uint8_t* block) noexcept {
+  CompressBlocks(h, block, 1);
+  CompressKPlusW(h, kPad64KPlusW.data());
+}
+
+Digest Hash64(std::span<const std::uint8_t, 64> data) noexcept {
+  static const CompressPairFn compress =
+      IntrinEnabled(kSHA) && IntrinEnabled(kSSE41) ? CompressPairShaNi
+                                                   : CompressPair;
+  State h = kH0;
+  compress(h, data.data());
+  return Output(h);
+}
+
+Digest Hash64(const Digest& left, const Digest& right) noexcept {
+  Block64 block;
+  std::ranges::copy(left, block.begin());
+  std::ranges::copy(right, block.begin() + kDigestBytes);
+  return Hash64(block);
+}
+
+Digest Hash32(std::span<const std::uint8_t, 32> data) noexcept {
+  const Block64 block = PadBlock32(data.data());
+  State h = kH0;
+  CompressBlocks(h, block.data(), 1);
+  return Output(h);
+}
+
+using LanesFn = void (*)(std::uint32_t* state,
+                         const std::uint8_t* const* blocks) noexcept;
+using KPlusWLanesFn = void (*)(std::uint32_t* state,
+                               const std::uint32_t* k_plus_w) noexcept;
+
+struct LaneKernels {
+  LanesFn compress;
+  KPlusWLanesFn compress_k_plus_w;
+};
+
+// 입력을 레인 수만큼씩 묶어 처리. 모자란 레인은 0 블록을 압축하고 버림
+template <std::size_t kLanes, bool kPad64, typename Input>
+static void HashLanes(std::span<const Input> inputs, std::span<Digest> digests,
+                      const LaneKernels& kernels) {
+  static constexpr Block64 kIdleBlock{};
+
+  std::array<std::uint32_t, 8 * kLanes> state{};
+  std::array<const std::uint8_t*, kLanes> blocks{};
+  std::array<Block64, kPad64 ? 0 : kLanes> padded{};
+
+  for (std::size_t first = 0; first < inputs.size(); first += kLanes) {
+    const std::size_t active = std::min(kLanes, inputs.size() - first);
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      for (std::size_t word = 0; word < 8; ++word) {
+        state[(word * kLanes) + lane] = kH0[word];
+      }
+      if (lane >= active) {
+        blocks[lane] = kIdleBlock.data();
+      } else if constexpr (kPad64) {
+        blocks[lane] = inputs[first + lane].data();
+      } else {
+        padded[lane] = PadBlock32(inputs[first + lane].data());
+        blocks[lane] = padded[lane].data();
+      }
+    }
+
+    kernels.compress(state.data(), blocks.data());
+    if constexpr (kPad64) {
+      kernels.compress_k_plus_w(state.data(), kPad64KPlusW.data());
+    }
+
+    for (std::size_t lane = 0; lane < active; ++lane) {
+      State h;
+      for (std::size_t word = 0; word < 8; ++word) {
+        h[word] = state[(word * kLanes) + lane];
+      }
+      digests[first + lane] = Output(h);
+    }
+  }
+}
+
+template <bool kPad64, typename Input, typename Single>
+static bool HashMany(std::span<const Input> inputs, std::span<Digest> digests,
+                     Single single) {
+  if (digests.size() < inputs.size()) {
+    return false;
+  }
+
+  const bool sha_ni = IntrinEnabled(kSHA) && IntrinEnabled(kSSE41);
+  if (inputs.size() > 1 && IntrinEnabled(kAVX512F) && IntrinEnabled(kAVX2)) {
+    HashLanes<16, kPad64>(
+        inputs, digests,
+        LaneKernels{CompressLanesAvx512, CompressKPlusWLanesAvx512});
+  } else if (inputs.size() > 1 && !sha_ni && IntrinEnabled(kAVX2)) {
+    HashLanes<8, kPad64>(
+        inputs, digests,
+        LaneKernels{CompressLanesAvx2, CompressKPlusWLanesAvx2});
+  } else {
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      digests[i] = single(inputs[i]);
+    }
+  }
+  return true;
+}
+
+bool Hash64Many(std::span<const Block64> inputs,
+                std::span<Digest> digests) noexcept {
+  return HashMany<true>(inputs, digests, [](const Block64& input) {
+    return Hash64(input);
+  });
+}
+
+bool Hash32Many(std::span<const Digest> inputs,
+                std::span<Digest> digests) noexcept {
+  return HashMany<false>(inputs, digests, [](const Digest& input) {
+    return Hash32(input);
+  });
+}
+
+}  // namespace bedrock::hash::sha256
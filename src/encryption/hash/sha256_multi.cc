@@ -0,0 +1,130 @@
+#include "encryption/hash/sha256_multi.h"
+
+#include "common/intrinsics.h"
+
+namespace bedrock::hash::sha256 {
+
+enum Sha256MultiIntrinSet { kAVX2, kAVX512F };
+
+static bool IntrinEnabled(Sha256MultiIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 2> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX512F")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    case kAVX512F:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+using LanesFn = void (*)(std::uint32_t* state,
+                         const std::uint8_t* const* blocks) noexcept;
+
+// 패딩 블록(1~2개)은 레인마다 따로 만들어 둠
+struct LaneJob {
+  std::size_t message = 0;
+  const std::uint8_t* data = nullptr;
+  std::size_t full_blocks = 0;
+  std::size_t tail_blocks = 0;
+  std::size_t tail_index = 0;
+  TailBlocks tail{};
+
+  void Start(std::size_t index, std::span<const std::uint8_t> bytes) noexcept {
+    message = index;
+    data = bytes.data();
+    full_blocks = bytes.size() / kBlockBytes;
+    tail_blocks = PadTail(tail, bytes.data() + (full_blocks * kBlockBytes),
+                          bytes.size() % kBlockBytes, bytes.size());
+    tail_index = 0;
+  }
+
+  const std::uint8_t* NextBlock() noexcept {
+    if (full_blocks > 0) {
+      const std::uint8_t* block = data;
+      data += kBlockBytes;
+      --full_blocks;
+      return block;
+    }
+    return tail.data() + (kBlockBytes * tail_index++);
+  }
+
+  [[nodiscard]] bool Done() const noexcept {
+    return full_blocks == 0 && tail_index == tail_blocks;
+  }
+};
+
+template <std::size_t kLanes>
+static void DigestLanes(std::span<const std::span<const std::uint8_t>> messages,
+                        std::span<Digest> digests, LanesFn compress) {
+  // 빈 레인이 가리킬 블록 (결과는 버림)
+  static constexpr std::array<std::uint8_t, kBlockBytes> kIdleBlock{};
+
+  std::array<std::uint32_t, 8 * kLanes> state{};
+  std::size_t next = 0;
+
+  RunLanes<kLanes, LaneJob>(
+      kIdleBlock.data(),
+      [&](std::size_t lane, LaneJob& job) {
+        if (next == messages.size()) {
+          return false;
+        }
+        job.Start(next, messages[next]);
+        ++next;
+        for (std::size_t word = 0; word < 8; ++word) {
+          state[(word * kLanes) + lane] = kH0[word];
+        }
+        return true;
+      },
+      [&](const std::uint8_t* const* blocks) {
+        compress(state.data(), blocks);
+      },
+      [&](std::size_t lane, const LaneJob& job) {
+        for (std::size_t word = 0; word < 8; ++word) {
+          StoreBigEndian32(digests[job.message].data() + (word * 4),
+                           state[(word * kLanes) + lane]);
+        }
+        return false;
+      });
+}
+
+static void DigestOne(std::span<const std::uint8_t> message, Digest& digest) {
+  LaneJob job;
+  job.Start(0, message);
+
+  State h = kH0;
+  CompressBlocks(h, message.data(), job.full_blocks);
+  CompressBlocks(h, job.tail.data(), job.tail_blocks);
+  for (std::size_t word = 0; word < 8; ++word) {
+    StoreBigEndian32(digest.data() + (word * 4), h[word]);
+  }
+}
+
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest> digests) noexcept {
+  if (digests.size() < messages.size()) {
+    return false;
+  }
+
+  // 메시지가 하나뿐이면 레인을 채울 수 없으므로 단일 스트림 경로
+  if (messages.size() > 1 && IntrinEnabled(kAVX512F) &&
+      IntrinEnabled(kAVX2)) {
+    DigestLanes<16>(messages, digests, CompressLanesAvx512);
+  } else if (messages.size() > 1 && IntrinEnabled(kAVX2)) {
+    DigestLanes<8>(messages, digests, CompressLanesAvx2);
+  } else {
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+      DigestOne(messages[i], digests[i]);
+    }
+  }
+
+  return true;
+}
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,156 @@
+#include <immintrin.h>
+
+#include "encryption/hash/sha256_multi.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::sha256 {
+
+static inline __m256i Rotr(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_srli_epi32(x, n),
+                         _mm256_slli_epi32(x, 32 - n));
+}
+
+static inline __m256i Xor3(__m256i a, __m256i b, __m256i c) {
+  return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+}
+
+// 8x8 워드 전치: rows[lane]의 워드 i -> rows[i]의 레인 lane
+static inline void Transpose(__m256i* rows) {
+  __m256i t[8];
+  for (std::size_t i = 0; i < 8; i += 2) {
+    t[i] = _mm256_unpacklo_epi32(rows[i], rows[i + 1]);
+    t[i + 1] = _mm256_unpackhi_epi32(rows[i], rows[i + 1]);
+  }
+  __m256i u[8];
+  for (std::size_t i = 0; i < 8; i += 4) {
+    u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+    u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+    u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+    u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+  }
+  for (std::size_t i = 0; i < 4; ++i) {
+    rows[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+    rows[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+  }
+}
+
+void CompressLanesAvx2(std::uint32_t* state,
+                       const std::uint8_t* const* blocks) noexcept {
+  constexpr std::size_t kLanes = 8;
+  const __m256i bswap = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6,
+      5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+  // w[t] = 레인별 W[t]. 16워드 창을 순환해서 사용
+  __m256i w[16];
+  for (std::size_t half = 0; half < 2; ++half) {
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      w[(half * 8) + lane] = _mm256_shuffle_epi8(
+          _mm256_loadu_si256(
+              reinterpret_cast<const __m256i*>(blocks[lane] + (half * 32))),
+          bswap);
+    }
+    Transpose(w + (half * 8));
+  }
+
+  __m256i v[8];
+  for (std::size_t i = 0; i < 8; ++i) {
+    v[i] = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(state + (i * kLanes)));
+  }
+  __m256i a = v[0];
+  __m256i b = v[1];
+  __m256i c = v[2];
+  __m256i d = v[3];
+  __m256i e = v[4];
+  __m256i f = v[5];
+  __m256i g = v[6];
+  __m256i h = v[7];
+
+  for (std::size_t t = 0; t < 64; ++t) {
+    if (t >= 16) {
+      const __m256i w15 = w[(t - 15) % 16];
+      const __m256i w2 = w[(t - 2) % 16];
+      const __m256i s0 =
+          Xor3(Rotr(w15, 7), Rotr(w15, 18), _mm256_srli_epi32(w15, 3));
+      const __m256i s1 =
+          Xor3(Rotr(w2, 17), Rotr(w2, 19), _mm256_srli_epi32(w2, 10));
+      w[t % 16] = _mm256_add_epi32(
+          _mm256_add_epi32(w[t % 16], s0),
+          _mm256_add_epi32(w[(t - 7) % 16], s1));
+    }
+
+    const __m256i sigma1 = Xor3(Rotr(e, 6), Rotr(e, 11), Rotr(e, 25));
+    const __m256i ch =
+        _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+    const __m256i t1 = _mm256_add_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(h, sigma1), ch),
+        _mm256_add_epi32(w[t % 16],
+                         _mm256_set1_epi32(static_cast<int>(kK[t]))));
+    const __m256i sigma0 = Xor3(Rotr(a, 2), Rotr(a, 13), Rotr(a, 22));
+    const __m256i maj = _mm256_xor_si256(
+        _mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm256_add_epi32(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm256_add_epi32(t1, _mm256_add_epi32(sigma0, maj));
+  }
+
+  const __m256i out[8] = {a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < 8; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + (i * kLanes)),
+                        _mm256_add_epi32(v[i], out[i]));
+  }
+}
+
+void CompressKPlusWLanesAvx2(std::uint32_t* state,
+                             const std::uint32_t* k_plus_w) noexcept {
+  constexpr std::size_t kLanes = 8;
+  __m256i v[8];
+  for (std::size_t i = 0; i < 8; ++i) {
+    v[i] = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(state + (i * kLanes)));
+  }
+  __m256i a = v[0];
+  __m256i b = v[1];
+  __m256i c = v[2];
+  __m256i d = v[3];
+  __m256i e = v[4];
+  __m256i f = v[5];
+  __m256i g = v[6];
+  __m256i h = v[7];
+
+  for (std::size_t t = 0; t < 64; ++t) {
+    const __m256i sigma1 = Xor3(Rotr(e, 6), Rotr(e, 11), Rotr(e, 25));
+    const __m256i ch =
+        _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+    const __m256i t1 = _mm256_add_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(h, sigma1), ch),
+        _mm256_set1_epi32(static_cast<int>(k_plus_w[t])));
+    const __m256i sigma0 = Xor3(Rotr(a, 2), Rotr(a, 13), Rotr(a, 22));
+    const __m256i maj = _mm256_xor_si256(
+        _mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm256_add_epi32(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm256_add_epi32(t1, _mm256_add_epi32(sigma0, maj));
+  }
+
+  const __m256i out[8] = {a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < 8; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + (i * kLanes)),
+                        _mm256_add_epi32(v[i], out[i]));
+  }
+}
+
+}  // namespace bedrock::hash::sha256
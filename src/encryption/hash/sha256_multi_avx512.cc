@@ -0,0 +1,162 @@
+#include <immintrin.h>
+
+#include "encryption/hash/sha256_multi.h"
+
+// 이 파일만 -mavx2 -mavx512f로 컴파일됨 (compiler_options.cmake)
+// 워드 회전은 vprord, Ch / Maj / 3항 XOR은 vpternlogd 한 번
+namespace bedrock::hash::sha256 {
+
+static inline __m512i Xor3(__m512i a, __m512i b, __m512i c) {
+  return _mm512_ternarylogic_epi32(a, b, c, 0x96);
+}
+
+// 8x8 워드 전치 (AVX2 경로와 같음)
+static inline void Transpose(__m256i* rows) {
+  __m256i t[8];
+  for (std::size_t i = 0; i < 8; i += 2) {
+    t[i] = _mm256_unpacklo_epi32(rows[i], rows[i + 1]);
+    t[i + 1] = _mm256_unpackhi_epi32(rows[i], rows[i + 1]);
+  }
+  __m256i u[8];
+  for (std::size_t i = 0; i < 8; i += 4) {
+    u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+    u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+    u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+    u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+  }
+  for (std::size_t i = 0; i < 4; ++i) {
+    rows[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+    rows[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+  }
+}
+
+void CompressLanesAvx512(std::uint32_t* state,
+                         const std::uint8_t* const* blocks) noexcept {
+  constexpr std::size_t kLanes = 16;
+  // 바이트 교환은 AVX512BW 없이 ymm pshufb로
+  const __m256i bswap = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6,
+      5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+  // 레인 8개씩 8x8 전치 후 두 묶음을 zmm 하나로 합침
+  __m512i w[16];
+  for (std::size_t half = 0; half < 2; ++half) {
+    __m256i rows[2][8];
+    for (std::size_t group = 0; group < 2; ++group) {
+      for (std::size_t lane = 0; lane < 8; ++lane) {
+        rows[group][lane] = _mm256_shuffle_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                blocks[(group * 8) + lane] + (half * 32))),
+            bswap);
+      }
+      Transpose(rows[group]);
+    }
+    for (std::size_t i = 0; i < 8; ++i) {
+      w[(half * 8) + i] = _mm512_inserti64x4(
+          _mm512_castsi256_si512(rows[0][i]), rows[1][i], 1);
+    }
+  }
+
+  __m512i v[8];
+  for (std::size_t i = 0; i < 8; ++i) {
+    v[i] = _mm512_loadu_si512(state + (i * kLanes));
+  }
+  __m512i a = v[0];
+  __m512i b = v[1];
+  __m512i c = v[2];
+  __m512i d = v[3];
+  __m512i e = v[4];
+  __m512i f = v[5];
+  __m512i g = v[6];
+  __m512i h = v[7];
+
+  for (std::size_t t = 0; t < 64; ++t) {
+    if (t >= 16) {
+      const __m512i w15 = w[(t - 15) % 16];
+      const __m512i w2 = w[(t - 2) % 16];
+      const __m512i s0 = Xor3(_mm512_ror_epi32(w15, 7),
+                              _mm512_ror_epi32(w15, 18),
+                              _mm512_srli_epi32(w15, 3));
+      const __m512i s1 = Xor3(_mm512_ror_epi32(w2, 17),
+                              _mm512_ror_epi32(w2, 19),
+                              _mm512_srli_epi32(w2, 10));
+      w[t % 16] = _mm512_add_epi32(
+          _mm512_add_epi32(w[t % 16], s0),
+          _mm512_add_epi32(w[(t - 7) % 16], s1));
+    }
+
+    const __m512i sigma1 = Xor3(_mm512_ror_epi32(e, 6),
+                                _mm512_ror_epi32(e, 11),
+                                _mm512_ror_epi32(e, 25));
+    const __m512i ch = _mm512_ternarylogic_epi32(e, f, g, 0xCA);
+    const __m512i t1 = _mm512_add_epi32(
+        _mm512_add_epi32(_mm512_add_epi32(h, sigma1), ch),
+        _mm512_add_epi32(w[t % 16],
+                         _mm512_set1_epi32(static_cast<int>(kK[t]))));
+    const __m512i sigma0 = Xor3(_mm512_ror_epi32(a, 2),
+                                _mm512_ror_epi32(a, 13),
+                                _mm512_ror_epi32(a, 22));
+    const __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xE8);
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm512_add_epi32(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm512_add_epi32(t1, _mm512_add_epi32(sigma0, maj));
+  }
+
+  const __m512i out[8] = {a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < 8; ++i) {
+    _mm512_storeu_si512(state + (i * kLanes), _mm512_add_epi32(v[i], out[i]));
+  }
+}
+
+void CompressKPlusWLanesAvx512(std::uint32_t* state,
+                               const std::uint32_t* k_plus_w) noexcept {
+  constexpr std::size_t kLanes = 16;
+  __m512i v[8];
+  for (std::size_t i = 0; i < 8; ++i) {
+    v[i] = _mm512_loadu_si512(state + (i * kLanes));
+  }
+  __m512i a = v[0];
+  __m512i b = v[1];
+  __m512i c = v[2];
+  __m512i d = v[3];
+  __m512i e = v[4];
+  __m512i f = v[5];
+  __m512i g = v[6];
+  __m512i h = v[7];
+
+  for (std::size_t t = 0; t < 64; ++t) {
+    const __m512i sigma1 = Xor3(_mm512_ror_epi32(e, 6),
+                                _mm512_ror_epi32(e, 11),
+                                _mm512_ror_epi32(e, 25));
+    const __m512i ch = _mm512_ternarylogic_epi32(e, f, g, 0xCA);
+    const __m512i t1 = _mm512_add_epi32(
+        _mm512_add_epi32(_mm512_add_epi32(h, sigma1), ch),
+        _mm512_set1_epi32(static_cast<int>(k_plus_w[t])));
+    const __m512i sigma0 = Xor3(_mm512_ror_epi32(a, 2),
+                                _mm512_ror_epi32(a, 13),
+                                _mm512_ror_epi32(a, 22));
+    const __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xE8);
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm512_add_epi32(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm512_add_epi32(t1, _mm512_add_epi32(sigma0, maj));
+  }
+
+  const __m512i out[8] = {a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < 8; ++i) {
+    _mm512_storeu_si512(state + (i * kLanes), _mm512_add_epi32(v[i], out[i]));
+  }
+}
+
+}  // namespace bedrock::hash::sha256
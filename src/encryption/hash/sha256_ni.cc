@@ -0,0 +1,97 @@
+#include <immintrin.h>
+
+#include "encryption/hash/sha256_core.h"
+
+// 이 파일만 -msha -msse4.1로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::sha256 {
+
+// sha256rnds2는 상태를 {ABEF, CDGH} 두 레지스터로 나눠 받음
+static inline void LoadState(const State& h, __m128i& state0,
+                             __m128i& state1) {
+  __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h.data()));
+  state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h.data() + 4));
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);                 // CDAB
+  state1 = _mm_shuffle_epi32(state1, 0x1B);           // EFGH
+  state0 = _mm_alignr_epi8(tmp, state1, 8);           // ABEF
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);        // CDGH
+}
+
+static inline void StoreState(__m128i state0, __m128i state1, State& h) {
+  const __m128i tmp = _mm_shuffle_epi32(state0, 0x1B);  // FEBA
+  state1 = _mm_shuffle_epi32(state1, 0xB1);             // DCHG
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);          // DCBA
+  state1 = _mm_alignr_epi8(state1, tmp, 8);             // HGFE
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(h.data()), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(h.data() + 4), state1);
+}
+
+void CompressBlocksShaNi(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept {
+  const __m128i bswap =
+      _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  const auto* k = reinterpret_cast<const __m128i*>(kK.data());
+
+  __m128i state0;
+  __m128i state1;
+  LoadState(h, state0, state1);
+
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const auto* in =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    const __m128i abef_save = state0;
+    const __m128i cdgh_save = state1;
+
+    // msg[g % 4] = W[4g .. 4g+3]
+    __m128i msg[4];
+    for (std::size_t group = 0; group < 16; ++group) {
+      if (group < 4) {
+        msg[group] = _mm_shuffle_epi8(_mm_loadu_si128(in + group), bswap);
+      }
+      __m128i& current = msg[group % 4];
+
+      __m128i wk = _mm_add_epi32(current, _mm_loadu_si128(k + group));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+      wk = _mm_shuffle_epi32(wk, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+
+      // W[4g+4 ..] = msg2(msg1(W[4g-12 ..], W[4g-8 ..]) + W[4g-3 ..], W[4g ..])
+      if (group >= 3 && group < 15) {
+        __m128i& next = msg[(group + 1) % 4];
+        next = _mm_add_epi32(
+            next, _mm_alignr_epi8(current, msg[(group + 3) % 4], 4));
+        next = _mm_sha256msg2_epu32(next, current);
+      }
+      if (group >= 1 && group < 13) {
+        __m128i& prev = msg[(group + 3) % 4];
+        prev = _mm_sha256msg1_epu32(prev, current);
+      }
+    }
+
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+  }
+
+  StoreState(state0, state1, h);
+}
+
+void CompressKPlusWShaNi(State& h, const std::uint32_t* k_plus_w) noexcept {
+  __m128i state0;
+  __m128i state1;
+  LoadState(h, state0, state1);
+  const __m128i abef_save = state0;
+  const __m128i cdgh_save = state1;
+
+  for (std::size_t group = 0; group < 16; ++group) {
+    __m128i wk = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(k_plus_w + (group * 4)));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+    wk = _mm_shuffle_epi32(wk, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+  }
+
+  StoreState(_mm_add_epi32(state0, abef_save),
+             _mm_add_epi32(state1, cdgh_save), h);
+}
+
+}  // namespace bedrock::hash::sha256
@@ -0,0 +1,141 @@
+#include "encryption/hash/sha3_multi.h"
+
+#include <cstring>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha256_multi.h"
+#include "encryption/hash/sha3.h"
+
+namespace bedrock::hash::sha3 {
+
+enum Sha3MultiIntrinSet { kAVX2 };
+
+static bool IntrinEnabled(Sha3MultiIntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 1> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+constexpr std::size_t kLanes = 4;
+
+// 메시지 하나의 블록 공급. 마지막 블록(패딩 포함)은 tail에 만들어 둠
+template <std::size_t kRate>
+struct LaneJob {
+  std::size_t message = 0;
+  const std::uint8_t* data = nullptr;
+  std::size_t full_blocks = 0;
+  bool tail_done = false;
+  std::array<std::uint8_t, kRate> tail{};
+
+  void Start(std::size_t index, std::span<const std::uint8_t> bytes) noexcept {
+    message = index;
+    data = bytes.data();
+    full_blocks = bytes.size() / kRate;
+    tail_done = false;
+
+    const std::size_t rest = bytes.size() % kRate;
+    tail.fill(0);
+    if (rest != 0) {
+      std::memcpy(tail.data(), bytes.data() + (full_blocks * kRate), rest);
+    }
+    tail[rest] ^= 0x06;
+    tail[kRate - 1] ^= 0x80;
+  }
+
+  const std::uint8_t* NextBlock() noexcept {
+    if (full_blocks > 0) {
+      const std::uint8_t* block = data;
+      data += kRate;
+      --full_blocks;
+      return block;
+    }
+    tail_done = true;
+    return tail.data();
+  }
+
+  [[nodiscard]] bool Done() const noexcept { return tail_done; }
+};
+
+template <std::size_t kBytes>
+static void DigestLanes(std::span<const std::span<const std::uint8_t>> messages,
+                        std::span<Digest<kBytes>> digests) {
+  constexpr std::size_t kRate = keccak::kStateBytes - (kBytes * 2);
+  // 쉬는 레인이 흡수할 블록 (0이므로 상태를 바꾸지 않음)
+  static constexpr std::array<std::uint8_t, kRate> kIdleBlock{};
+
+  std::array<std::uint64_t, 25 * kLanes> states{};
+  std::size_t next = 0;
+
+  sha256::RunLanes<kLanes, LaneJob<kRate>>(
+      kIdleBlock.data(),
+      [&](std::size_t lane, LaneJob<kRate>& job) {
+        if (next == messages.size()) {
+          return false;
+        }
+        job.Start(next, messages[next]);
+        ++next;
+        for (std::size_t word = 0; word < 25; ++word) {
+          states[(word * kLanes) + lane] = 0;
+        }
+        return true;
+      },
+      [&](const std::uint8_t* const* blocks) {
+        for (std::size_t lane = 0; lane < kLanes; ++lane) {
+          for (std::size_t word = 0; word < kRate / 8; ++word) {
+            states[(word * kLanes) + lane] ^=
+                keccak::LoadLittleEndian64(blocks[lane] + (word * 8));
+          }
+        }
+        keccak::PermuteX4Avx2(states.data());
+      },
+      // 출력은 rate보다 짧으므로 순열 한 번 뒤 바로 꺼냄
+      [&](std::size_t lane, const LaneJob<kRate>& job) {
+        for (std::size_t i = 0; i < kBytes; ++i) {
+          digests[job.message][i] = static_cast<std::uint8_t>(
+              states[((i / 8) * kLanes) + lane] >> (8 * (i % 8)));
+        }
+        return false;
+      });
+}
+
+template <std::size_t kBytes>
+static bool DigestManyImpl(
+    std::span<const std::span<const std::uint8_t>> messages,
+    std::span<Digest<kBytes>> digests) {
+  if (digests.size() < messages.size()) {
+    return false;
+  }
+
+  if (messages.size() > 1 && IntrinEnabled(kAVX2)) {
+    DigestLanes<kBytes>(messages, digests);
+    return true;
+  }
+
+  const SHA3<kBytes * 8> sha3;
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    const auto digest = sha3.Digest(messages[i]);
+    std::memcpy(digests[i].data(), digest.data(), kBytes);
+  }
+  return true;
+}
+
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<32>> digests) noexcept {
+  return DigestManyImpl<32>(messages, digests);
+}
+
+bool DigestMany(std::span<const std::span<const std::uint8_t>> messages,
+                std::span<Digest<64>> digests) noexcept {
+  return DigestManyImpl<64>(messages, digests);
+}
+
+}  // namespace bedrock::hash::sha3
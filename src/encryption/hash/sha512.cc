@@ -0,0 +1,122 @@
+#include <tmmintrin.h>
+
+#include <array>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha512_core.h"
+
+namespace bedrock::hash::sha512 {
+
+enum Sha512IntrinSet { kSSSE3, kAVX2 };
+
+static bool IntrinEnabled(Sha512IntrinSet target) {
+  static bedrock::intrinsic::Register reg =
+      bedrock::intrinsic::GetCPUFeatures();
+
+  static std::array<bool, 2> enabled = {
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "SSSE3"),
+      bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")};
+
+  switch (target) {
+    case kSSSE3:
+      return enabled[target];
+    case kAVX2:
+      return enabled[target];
+    default:
+      return false;
+  }
+}
+
+using CompressFn = void (*)(State& h, const std::uint8_t* data,
+                            std::size_t blocks) noexcept;
+
+static CompressFn PickCompress() {
+  if (IntrinEnabled(kAVX2)) {
+    return CompressBlocksAvx2;
+  }
+  if (IntrinEnabled(kSSSE3)) {
+    return CompressBlocksSsse3;
+  }
+  return CompressBlocksScalar;
+}
+
+void CompressBlocksScalar(State& h, const std::uint8_t* data,
+                          std::size_t blocks) noexcept {
+  for (std::size_t block = 0; block < blocks; ++block) {
+    CompressBytes(h, data + (block * kBlockBytes));
+  }
+}
+
+static inline __m128i Rotr(__m128i x, int n) {
+  return _mm_or_si128(_mm_srli_epi64(x, n), _mm_slli_epi64(x, 64 - n));
+}
+
+static inline __m128i SmallSigma0(__m128i x) {
+  return _mm_xor_si128(_mm_xor_si128(Rotr(x, 1), Rotr(x, 8)),
+                       _mm_srli_epi64(x, 7));
+}
+
+static inline __m128i SmallSigma1(__m128i x) {
+  return _mm_xor_si128(_mm_xor_si128(Rotr(x, 19), Rotr(x, 61)),
+                       _mm_srli_epi64(x, 6));
+}
+
+// W[2g, 2g+1]. w는 직전 16워드를 2워드씩 담은 8칸 순환 창 (w[g % 8]이 가장
+// 오래된 W[2g-16, 2g-15]). σ1 항은 W[t-2]에만 의존하므로 두 워드를 한 번에
+static inline __m128i NextWords(const __m128i* w,
+                                std::size_t group) {
+  const __m128i w0 = w[group % 8];
+  const __m128i w1 = w[(group + 1) % 8];
+  const __m128i w4 = w[(group + 4) % 8];
+  const __m128i w5 = w[(group + 5) % 8];
+  const __m128i w7 = w[(group + 7) % 8];
+  return _mm_add_epi64(
+      _mm_add_epi64(w0, SmallSigma0(_mm_alignr_epi8(w1, w0, 8))),
+      _mm_add_epi64(_mm_alignr_epi8(w5, w4, 8), SmallSigma1(w7)));
+}
+
+static inline void StoreKPlusW(std::uint64_t* out, __m128i w,
+                               std::size_t group) {
+  const __m128i k = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(kK.data() + (group * 2)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_add_epi64(w, k));
+}
+
+void CompressBlocksSsse3(State& h, const std::uint8_t* data,
+                         std::size_t blocks) noexcept {
+  const __m128i bswap =
+      _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+  for (std::size_t block = 0; block < blocks; ++block) {
+    const auto* in =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    __m128i w[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+      w[i] = _mm_shuffle_epi8(_mm_loadu_si128(in + i), bswap);
+    }
+
+    State v = h;
+    std::array<std::uint64_t, 8> k_plus_w{};
+    for (std::size_t group = 0; group < 40; ++group) {
+      if (group >= 8) {
+        w[group % 8] = NextWords(w, group);
+      }
+      StoreKPlusW(k_plus_w.data() + ((group % 4) * 2), w[group % 8], group);
+      if (group % 4 == 3) {
+        EightRounds(v, k_plus_w.data());
+      }
+    }
+
+    for (std::size_t i = 0; i < 8; ++i) {
+      h[i] += v[i];
+    }
+  }
+}
+
+void CompressBlocks(State& h, const std::uint8_t* data,
+                    std::size_t blocks) noexcept {
+  static const CompressFn compress = PickCompress();
+  compress(h, data, blocks);
+}
+
+}  // namespace bedrock::hash::sha512
@@ -0,0 +1,99 @@
+#include <immintrin.h>
+
+#include <array>
+
+#include "encryption/hash/sha512_core.h"
+
+// 이 파일만 -mavx2로 컴파일됨 (compiler_options.cmake)
+namespace bedrock::hash::sha512 {
+
+static inline __m256i Rotr(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_srli_epi64(x, n),
+                         _mm256_slli_epi64(x, 64 - n));
+}
+
+static inline __m256i SmallSigma0(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(Rotr(x, 1), Rotr(x, 8)),
+                          _mm256_srli_epi64(x, 7));
+}
+
+static inline __m256i SmallSigma1(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(Rotr(x, 19), Rotr(x, 61)),
+                          _mm256_srli_epi64(x, 6));
+}
+
+// 128-bit 레인마다 SSSE3 경로의 NextWords와 같은 계산
+static inline __m256i NextWords(const __m256i* w,
+                                std::size_t group) {
+  const __m256i w0 = w[group % 8];
+  const __m256i w1 = w[(group + 1) % 8];
+  const __m256i w4 = w[(group + 4) % 8];
+  const __m256i w5 = w[(group + 5) % 8];
+  const __m256i w7 = w[(group + 7) % 8];
+  return _mm256_add_epi64(
+      _mm256_add_epi64(w0, SmallSigma0(_mm256_alignr_epi8(w1, w0, 8))),
+      _mm256_add_epi64(_mm256_alignr_epi8(w5, w4, 8), SmallSigma1(w7)));
+}
+
+// 아래 레인(첫 블록)은 바로 쓸 8라운드 버퍼로, 위 레인(둘째 블록)은
+// 나중에 돌릴 80라운드 버퍼로
+static inline void StoreKPlusW(std::uint64_t* first, std::uint64_t* second,
+                               __m256i w, std::size_t group) {
+  const __m256i k = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(kK.data() + (group * 2))));
+  const __m256i sum = _mm256_add_epi64(w, k);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(first),
+                   _mm256_castsi256_si128(sum));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(second + (group * 2)),
+                   _mm256_extracti128_si256(sum, 1));
+}
+
+static inline void AddState(State& h, const State& v) {
+  for (std::size_t i = 0; i < 8; ++i) {
+    h[i] += v[i];
+  }
+}
+
+void CompressBlocksAvx2(State& h, const std::uint8_t* data,
+                        std::size_t blocks) noexcept {
+  const __m256i bswap = _mm256_setr_epi8(
+      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+      1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  std::size_t block = 0;
+
+  for (; block + 2 <= blocks; block += 2) {
+    const auto* first =
+        reinterpret_cast<const __m128i*>(data + (block * kBlockBytes));
+    const auto* second = first + 8;
+    __m256i w[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+      w[i] = _mm256_shuffle_epi8(_mm256_loadu2_m128i(second + i, first + i),
+                                 bswap);
+    }
+
+    std::array<std::uint64_t, 8> first_wk{};
+    std::array<std::uint64_t, 80> second_wk{};
+    State v = h;
+    for (std::size_t group = 0; group < 40; ++group) {
+      if (group >= 8) {
+        w[group % 8] = NextWords(w, group);
+      }
+      StoreKPlusW(first_wk.data() + ((group % 4) * 2), second_wk.data(),
+                  w[group % 8], group);
+      if (group % 4 == 3) {
+        EightRounds(v, first_wk.data());
+      }
+    }
+    AddState(h, v);
+
+    v = h;
+    for (std::size_t round = 0; round < 80; round += 8) {
+      EightRounds(v, second_wk.data() + round);
+    }
+    AddState(h, v);
+  }
+
+  CompressBlocksSsse3(h, data + (block * kBlockBytes), blocks - block);
+}
+
+}  // namespace bedrock::hash::sha512
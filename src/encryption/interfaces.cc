@@ -4,6 +4,44 @@ namespace bedrock::cipher {
 
 BlockCipherAlgorithm::~BlockCipherAlgorithm() noexcept = default;
 
+ErrorStatus BlockCipherAlgorithm::EncryptBlocks(
+    BlockCipherCTX& ctx, std::span<const std::uint8_t> blocks,
+    std::span<std::uint8_t> out) const noexcept {
+  const std::size_t block_bytes = GetBlockSize() / 8;
+  if (block_bytes == 0 || blocks.size() % block_bytes != 0 ||
+      out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  for (std::size_t offset = 0; offset < blocks.size(); offset += block_bytes) {
+    if (Encrypt(ctx, blocks.subspan(offset, block_bytes),
+                out.subspan(offset, block_bytes)) != ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
+ErrorStatus BlockCipherAlgorithm::DecryptBlocks(
+    BlockCipherCTX& ctx, std::span<const std::uint8_t> blocks,
+    std::span<std::uint8_t> out) const noexcept {
+  const std::size_t block_bytes = GetBlockSize() / 8;
+  if (block_bytes == 0 || blocks.size() % block_bytes != 0 ||
+      out.size() < blocks.size()) {
+    return ErrorStatus::kFailure;
+  }
+
+  for (std::size_t offset = 0; offset < blocks.size(); offset += block_bytes) {
+    if (Decrypt(ctx, blocks.subspan(offset, block_bytes),
+                out.subspan(offset, block_bytes)) != ErrorStatus::kSuccess) {
+      return ErrorStatus::kFailure;
+    }
+  }
+
+  return ErrorStatus::kSuccess;
+}
+
 BlockCipherCTX::~BlockCipherCTX() {
 #if ENCRYPTION_USE_OPENSSL
   if (evp_ctx != nullptr) {
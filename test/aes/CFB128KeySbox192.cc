@@ -0,0 +1,6 @@
+#include "common/kat_runner.h"
+
+int main() {
+  return bedrock::test::RunKatTest<bedrock::cipher::AesCfb128, 24>(
+      "CFB128KeySbox192");
+}
@@ -0,0 +1,5 @@
+#include "common/kat_runner.h"
+
+int main() {
+  return bedrock::test::RunCfb1KatTest<24>("CFB1GFSbox192");
+}
@@ -0,0 +1,5 @@
+#include "common/kat_runner.h"
+
+int main() {
+  return bedrock::test::RunCfb1KatTest<16>("CFB1KeySbox128");
+}
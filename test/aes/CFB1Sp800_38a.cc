@@ -0,0 +1,55 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+#include "encryption/cipher/mode/aliases.h"
+#include "encryption/util/helper.h"
+
+// SP 800-38A F.3.1 / F.3.2 (CFB1-AES128). 16 bit가 바이트 경계에 맞으므로
+// 0x6bc1 -> 0x68b3 한번에 처리하고, 한 바이트씩 나눠 넣은 결과도 같아야 함
+int main() {
+  namespace om = bedrock::cipher::op_mode;
+  const std::array<std::uint8_t, 16> key = {
+      0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+      0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+  const std::array<std::uint8_t, 16> iv = {
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+  const std::array<std::uint8_t, 2> plain = {0x6b, 0xc1};
+  const std::array<std::uint8_t, 2> cipher = {0x68, 0xb3};
+
+  for (const bool split : {false, true}) {
+    bedrock::cipher::AesCfb1 enc(key, iv);
+    bedrock::cipher::AesCfb1 dec(key, iv);
+    enc << om::CipherMode::kEncrypt;
+    dec << om::CipherMode::kDecrypt;
+    std::array<std::uint8_t, 2> encrypted{};
+    std::array<std::uint8_t, 2> decrypted{};
+    bool ok = true;
+    if (split) {
+      for (std::size_t i = 0; i < plain.size(); ++i) {
+        ok = ok &&
+             enc.Process(std::span(plain).subspan(i, 1),
+                         std::span(encrypted).subspan(i, 1)) ==
+                 bedrock::cipher::ErrorStatus::kSuccess &&
+             dec.Process(std::span(cipher).subspan(i, 1),
+                         std::span(decrypted).subspan(i, 1)) ==
+                 bedrock::cipher::ErrorStatus::kSuccess;
+      }
+    } else {
+      ok = enc.Process(plain, encrypted) ==
+               bedrock::cipher::ErrorStatus::kSuccess &&
+           dec.Process(cipher, decrypted) ==
+               bedrock::cipher::ErrorStatus::kSuccess;
+    }
+    std::cout << (split ? "split" : "whole") << " CIPHERTEXT: "
+              << bedrock::util::BytesToHexStr(encrypted) << "\n"
+              << (split ? "split" : "whole") << " PLAINTEXT: "
+              << bedrock::util::BytesToHexStr(decrypted) << std::endl;
+    if (!ok || encrypted != cipher || decrypted != plain) {
+      std::cout << "Mismatch" << std::endl;
+      return -1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <array>
+
+#include "common/block_cipher_runner.h"
+#include "encryption/cipher/aria.h"
+
+// RFC 5794 부록 A 테스트 벡터
+int main() {
+  const std::array<bedrock::test::BlockVector, 3> vectors = {{
+      {"000102030405060708090a0b0c0d0e0f", "00112233445566778899aabbccddeeff",
+       "D718FBD6AB644C739DA95F3BE6451778"},
+      {"000102030405060708090a0b0c0d0e0f1011121314151617",
+       "00112233445566778899aabbccddeeff", "26449C1805DBE7AA25A468CE263A9E79"},
+      {"000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+       "00112233445566778899aabbccddeeff", "F92BD7C79FB72E2F2B8F80C1972D24FC"},
+  }};
+  return bedrock::test::RunBlockKat<bedrock::cipher::Aria>("ARIA", vectors);
+}
@@ -0,0 +1,7 @@
+#include "common/block_cipher_runner.h"
+#include "encryption/cipher/aria.h"
+
+// AES-NI 4-way 커널이 블록 단위 처리(테이블 경로)와 같은지 확인
+int main() {
+  return bedrock::test::RunBulkMatchesSingle<bedrock::cipher::Aria>("ARIA");
+}
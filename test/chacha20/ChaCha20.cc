@@ -0,0 +1,82 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "encryption/cipher/chacha20.h"
+#include "encryption/util/helper.h"
+
+// RFC 8439 2.4.2
+int main() {
+  namespace cipher = bedrock::cipher;
+  namespace util = bedrock::util;
+
+  const auto key = util::HexStrToBytes(
+      "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+  const auto nonce = util::HexStrToBytes("000000000000004a00000000");
+  const auto plain = util::StrToBytes(
+      "Ladies and Gentlemen of the class of '99: If I could offer you only one "
+      "tip for the future, sunscreen would be it.");
+  const std::string expected =
+      "6E2E359A2568F98041BA0728DD0D6981E97E7AEC1D4360C20A27AFCCFD9FAE0BF91B65C5"
+      "524733AB8F593DABCD62B3571639D624E65152AB8F530C359F0861D807CA0DBF500D6A61"
+      "56A38E088A22B65E52BC514D16CCF806818CE91AB77937365AF90BBF74A35BE6B40B8EED"
+      "F2785E42874D";
+
+  // 한번에 처리한 결과와 1바이트씩 이어서 처리한 결과가 같아야 함
+  for (std::size_t chunk : {plain.size(), std::size_t{1}, std::size_t{7}}) {
+    cipher::ChaCha20 chacha;
+    if (chacha.SetKey(key, nonce, 1) != cipher::ErrorStatus::kSuccess) {
+      std::cout << "SetKey failed" << std::endl;
+      return 1;
+    }
+
+    std::vector<std::uint8_t> out(plain.size());
+    for (std::size_t offset = 0; offset < plain.size(); offset += chunk) {
+      const std::size_t len = std::min(chunk, plain.size() - offset);
+      chacha.Process(std::span(plain).subspan(offset, len),
+                     std::span(out).subspan(offset, len));
+    }
+
+    const std::string actual = util::BytesToHexStr(out);
+    if (actual != expected) {
+      std::cout << "chunk " << chunk << "\n  expected " << expected
+                << "\n  actual   " << actual << std::endl;
+      return 1;
+    }
+  }
+
+  // 카운터 끝: 0xffffffff 블록까지는 쓰고, 한 바퀴 돌아야 하는 호출은 거부
+  cipher::ChaCha20 chacha;
+  chacha.SetKey(key, nonce);
+  std::vector<std::uint8_t> buffer(3 * cipher::ChaCha20::kBlockBytes);
+  const auto part = [&](std::size_t bytes) {
+    return std::span(buffer).first(bytes);
+  };
+  chacha.Seek(0xfffffffe);
+  if (chacha.Process(part(129), part(129)) != cipher::ErrorStatus::kFailure) {
+    std::cout << "counter wrap accepted (3 blocks)" << std::endl;
+    return 1;
+  }
+  if (chacha.Process(part(64), part(64)) != cipher::ErrorStatus::kSuccess ||
+      chacha.Process(part(63), part(63)) != cipher::ErrorStatus::kSuccess ||
+      chacha.Process(part(1), part(1)) != cipher::ErrorStatus::kSuccess) {
+    std::cout << "last counter blocks refused" << std::endl;
+    return 1;
+  }
+  if (chacha.Process(part(1), part(1)) != cipher::ErrorStatus::kFailure) {
+    std::cout << "counter wrap accepted" << std::endl;
+    return 1;
+  }
+  chacha.Seek(0xffffffff);
+  if (chacha.Process(part(65), part(65)) != cipher::ErrorStatus::kFailure ||
+      chacha.Process(part(64), part(64)) != cipher::ErrorStatus::kSuccess) {
+    std::cout << "Seek did not reset the counter limit" << std::endl;
+    return 1;
+  }
+
+  std::cout << "ChaCha20 passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "encryption/cipher/mode/chacha20_poly1305.h"
+#include "encryption/util/helper.h"
+
+int main() {
+  namespace cipher = bedrock::cipher;
+  namespace util = bedrock::util;
+
+  // RFC 8439 2.8.2
+  const auto key = util::HexStrToBytes(
+      "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f");
+  const auto nonce = util::HexStrToBytes("070000004041424344454647");
+  const auto aad = util::HexStrToBytes("50515253c0c1c2c3c4c5c6c7");
+  const auto plain = util::StrToBytes(
+      "Ladies and Gentlemen of the class of '99: If I could offer you only one "
+      "tip for the future, sunscreen would be it.");
+  const std::string expected_cipher =
+      "D31A8D34648E60DB7B86AFBC53EF7EC2A4ADED51296E08FEA9E2B5A736EE62D63DBEA45E"
+      "8CA9671282FAFB69DA92728B1A71DE0A9E060B2905D6A5B67ECD3B3692DDBD7F2D778B8C"
+      "9803AEE328091B58FAB324E4FAD675945585808B4831D7BC3FF4DEF08E4B7A9DE576D265"
+      "86CEC64B6116";
+  const std::string expected_tag = "1AE10B594F09E26A7E902ECBD0600691";
+
+  cipher::ChaCha20Poly1305 aead(key, nonce);
+  std::vector<std::uint8_t> data = plain;
+  if (aead.AddAad(aad) != cipher::ErrorStatus::kSuccess ||
+      aead.Process(data, data) != cipher::ErrorStatus::kSuccess) {
+    std::cout << "encrypt failed" << std::endl;
+    return 1;
+  }
+  if (util::BytesToHexStr(data) != expected_cipher ||
+      util::BytesToHexStr(aead.Tag()) != expected_tag) {
+    std::cout << "encrypt mismatch\n  cipher " << util::BytesToHexStr(data)
+              << "\n  tag    " << util::BytesToHexStr(aead.Tag()) << std::endl;
+    return 1;
+  }
+  if (aead.AddAad(aad) != cipher::ErrorStatus::kFailure) {
+    std::cout << "AAD accepted after payload" << std::endl;
+    return 1;
+  }
+
+  const auto tag = util::HexStrToBytes(expected_tag);
+  aead << cipher::op_mode::CipherMode::kDecrypt;
+  aead.AddAad(aad);
+  if (aead.Process(data, data) != cipher::ErrorStatus::kSuccess ||
+      data != plain || !aead.Verify(tag)) {
+    std::cout << "decrypt failed" << std::endl;
+    return 1;
+  }
+
+  // 긴 입력: 한번에 처리(SIMD 커널)와 조각 처리(스칼라 꼬리) 결과 비교
+  std::vector<std::uint8_t> long_plain(1500);
+  for (std::size_t i = 0; i < long_plain.size(); i++) {
+    long_plain[i] = static_cast<std::uint8_t>((i * 13) + 1);
+  }
+  cipher::ChaCha20Poly1305 one_shot(key, nonce);
+  cipher::ChaCha20Poly1305 streamed(key, nonce);
+  std::vector<std::uint8_t> one_shot_out(long_plain.size());
+  std::vector<std::uint8_t> streamed_out(long_plain.size());
+  one_shot.Process(long_plain, one_shot_out);
+  for (std::size_t offset = 0; offset < long_plain.size(); offset += 37) {
+    const std::size_t len =
+        std::min<std::size_t>(37, long_plain.size() - offset);
+    streamed.Process(std::span(long_plain).subspan(offset, len),
+                     std::span(streamed_out).subspan(offset, len));
+  }
+  if (one_shot_out != streamed_out || one_shot.Tag() != streamed.Tag()) {
+    std::cout << "one-shot and streamed results differ" << std::endl;
+    return 1;
+  }
+
+  std::cout << "ChaCha20-Poly1305 passed." << std::endl;
+  return 0;
+}
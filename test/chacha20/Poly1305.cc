@@ -0,0 +1,55 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "encryption/cipher/poly1305.h"
+#include "encryption/util/helper.h"
+
+int main() {
+  namespace cipher = bedrock::cipher;
+  namespace util = bedrock::util;
+
+  // RFC 8439 2.5.2
+  const auto key = util::HexStrToBytes(
+      "85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b");
+  const auto message = util::StrToBytes("Cryptographic Forum Research Group");
+  const std::string expected = "A8061DC1305136C6C22B8BAF0C0127A9";
+
+  cipher::Poly1305 poly;
+  if (poly.SetKey(key) != cipher::ErrorStatus::kSuccess) {
+    std::cout << "SetKey failed" << std::endl;
+    return 1;
+  }
+  poly.Update(message);
+  const std::string actual = util::BytesToHexStr(poly.Final());
+  if (actual != expected) {
+    std::cout << "expected " << expected << "\n  actual   " << actual
+              << std::endl;
+    return 1;
+  }
+
+  // 긴 입력은 4-way 경로를 타므로 16바이트씩 넣은 결과(스칼라)와 비교
+  std::vector<std::uint8_t> long_message(1000);
+  for (std::size_t i = 0; i < long_message.size(); i++) {
+    long_message[i] = static_cast<std::uint8_t>((i * 31) + 7);
+  }
+  cipher::Poly1305 one_shot;
+  cipher::Poly1305 streamed;
+  one_shot.SetKey(key);
+  streamed.SetKey(key);
+  one_shot.Update(long_message);
+  for (std::size_t offset = 0; offset < long_message.size(); offset += 16) {
+    const std::size_t len =
+        std::min<std::size_t>(16, long_message.size() - offset);
+    streamed.Update(std::span(long_message).subspan(offset, len));
+  }
+  if (one_shot.Final() != streamed.Final()) {
+    std::cout << "one-shot and streamed tags differ" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Poly1305 passed." << std::endl;
+  return 0;
+}
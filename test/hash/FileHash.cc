@@ -0,0 +1,89 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include "encryption/hash/file_hash.h"
+#include "encryption/hash/lsh.h"
+#include "encryption/hash/sha.h"
+#include "encryption/hash/sha3.h"
+
+namespace hash = bedrock::hash;
+
+static bool WriteFile(const std::filesystem::path& path,
+                      std::span<const std::uint8_t> data) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  return static_cast<bool>(file);
+}
+
+// 읽기 방식마다 파일 해시가 메모리에서 한 번에 계산한 값과 같은지
+template <typename Hasher>
+static bool CheckModes(const char* name, const std::filesystem::path& path,
+                       std::span<const std::uint8_t> data) {
+  const Hasher reference;
+  const auto expected = reference.Digest(data);
+
+  const hash::FileReadOptions modes[] = {
+      {},
+      {hash::FileReadMode::kAuto, 5000},
+      {hash::FileReadMode::kAuto, 4096, 8192},
+      {hash::FileReadMode::kMap, 4096},
+      {hash::FileReadMode::kPipeline, 8192},
+      {hash::FileReadMode::kPipeline, 4096, 0, true},
+  };
+  for (std::size_t i = 0; i < std::size(modes); i++) {
+    auto digest = expected;
+    digest.fill(std::byte{0});
+    if (!hash::DigestFile<Hasher>(path, digest, modes[i]) ||
+        digest != expected) {
+      std::cout << name << " file digest mismatch, " << data.size()
+                << " bytes, options " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  const auto path = std::filesystem::temp_directory_path() /
+                    "bedrock_file_hash_test.bin";
+
+  std::vector<std::uint8_t> pattern(100000);
+  for (std::size_t i = 0; i < pattern.size(); i++) {
+    pattern[i] = static_cast<std::uint8_t>((i * 131) + (i >> 9));
+  }
+
+  // 빈 파일, 버퍼 하나보다 작은 파일, 버퍼 크기의 배수, 여러 버퍼에 걸친 파일
+  for (const std::size_t size : {std::size_t{0}, std::size_t{1000},
+                                 std::size_t{16384}, pattern.size()}) {
+    const auto data = std::span<const std::uint8_t>(pattern).first(size);
+    if (!WriteFile(path, data)) {
+      std::cout << "could not write " << path << std::endl;
+      return 1;
+    }
+    if (!CheckModes<hash::SHA256>("SHA-256", path, data) ||
+        !CheckModes<hash::SHA512>("SHA-512", path, data) ||
+        !CheckModes<hash::SHA3_256>("SHA3-256", path, data) ||
+        !CheckModes<hash::LSH256>("LSH-256", path, data)) {
+      return 1;
+    }
+  }
+
+  std::error_code ignored;
+  std::filesystem::remove(path, ignored);
+  std::array<std::byte, 32> digest{};
+  if (hash::DigestFile<hash::SHA256>(path, digest)) {
+    std::cout << "DigestFile accepted a missing file" << std::endl;
+    return 1;
+  }
+
+  std::cout << "file hash tests passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "encryption/hash/hkdf.h"
+#include "encryption/util/helper.h"
+
+namespace hash = bedrock::hash;
+
+static std::vector<std::uint8_t> Range(std::size_t first, std::size_t last) {
+  std::vector<std::uint8_t> bytes;
+  for (std::size_t i = first; i < last; i++) {
+    bytes.push_back(static_cast<std::uint8_t>(i));
+  }
+  return bytes;
+}
+
+// RFC 5869 부록 A.1 - A.3
+int main() {
+  const struct {
+    std::vector<std::uint8_t> ikm;
+    std::vector<std::uint8_t> salt;
+    std::vector<std::uint8_t> info;
+    const char* prk;
+    const char* okm;
+  } cases[] = {
+      {std::vector<std::uint8_t>(22, 0x0b), Range(0x00, 0x0d),
+       Range(0xf0, 0xfa),
+       "077709362C2E32DF0DDC3F0DC47BBA6390B6C73BB50F9C3122EC844AD7C2B3E5",
+       "3CB25F25FAACD57A90434F64D0362F2A2D2D0A90CF1A5A4C5DB02D56ECC4C5BF"
+       "34007208D5B887185865"},
+      {Range(0x00, 0x50), Range(0x60, 0xb0), Range(0xb0, 0x100),
+       "06A6B88C5853361A06104C9CEB35B45CEF760014904671014A193F40C15FC244",
+       "B11E398DC80327A1C8E7F78C596A49344F012EDA2D4EFAD8A050CC4C19AFA97C"
+       "59045A99CAC7827271CB41C65E590E09DA3275600C2F09B8367793A9ACA3DB71"
+       "CC30C58179EC3E87C14C01D5C1F3434F1D87"},
+      {std::vector<std::uint8_t>(22, 0x0b), {}, {},
+       "19EF24A32C717B167F33A91D6F648BDF96596776AFDB6377AC434C1C293CCB04",
+       "8DA4E775A563C18F715F802A063C5A31B8A11F5C5EE1879EC3454E5F3C738D2D"
+       "9D201395FAA4B61A96C8"},
+  };
+
+  for (const auto& test : cases) {
+    const auto prk = hash::HkdfSha256::Extract(test.salt, test.ikm);
+    std::vector<std::uint8_t> okm(std::string(test.okm).size() / 2);
+    if (bedrock::util::BytesToHexStr(prk) != test.prk ||
+        !hash::Hkdf(test.salt, test.ikm, test.info, okm) ||
+        bedrock::util::BytesToHexStr(okm) != test.okm) {
+      std::cout << "HKDF-SHA256 mismatch\n  expected " << test.okm
+                << "\n  actual   " << bedrock::util::BytesToHexStr(okm)
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // info 길이가 블록 경계를 넘나들고 출력 길이도 제각각인 요청을 섞어
+  // 레인마다 연쇄 길이가 달라지도록
+  const hash::HkdfSha256 hkdf(Range(0x20, 0x40));
+  const std::vector<std::uint8_t> pattern = Range(0, 200);
+  const std::size_t count = 37;
+  std::vector<std::vector<std::uint8_t>> outputs;
+  std::vector<hash::HkdfExpandRequest> requests;
+  for (std::size_t i = 0; i < count; i++) {
+    outputs.emplace_back((i % 6 == 0) ? (1 + (i * 5)) : (32 + (i % 3)));
+  }
+  for (std::size_t i = 0; i < count; i++) {
+    const std::size_t info = (i % 4 == 0) ? (i * 5) : (20 + (i % 5) * 3);
+    requests.push_back({std::span(pattern).first(info), outputs[i]});
+  }
+  if (!hkdf.ExpandMany(requests)) {
+    std::cout << "ExpandMany failed" << std::endl;
+    return 1;
+  }
+  for (std::size_t i = 0; i < count; i++) {
+    std::vector<std::uint8_t> expected(outputs[i].size());
+    if (!hkdf.Expand(requests[i].info, expected) || expected != outputs[i]) {
+      std::cout << "ExpandMany mismatch at request " << i << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<std::uint8_t> too_long(hash::HkdfSha256::kMaxOutputBytes + 1);
+  requests[3].out = too_long;
+  if (hkdf.ExpandMany(requests) || hkdf.Expand({}, too_long) ||
+      hkdf.Expand({}, {})) {
+    std::cout << "HKDF accepted an invalid output length" << std::endl;
+    return 1;
+  }
+
+  std::cout << "HKDF-SHA256 vectors passed." << std::endl;
+  return 0;
+}
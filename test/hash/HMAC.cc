@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "encryption/hash/hmac.h"
+#include "encryption/util/helper.h"
+
+namespace hash = bedrock::hash;
+
+static std::vector<std::uint8_t> Bytes(const std::string& text) {
+  return {text.begin(), text.end()};
+}
+
+// RFC 4231 예제 (5번은 잘린 태그라 제외). 한 번에 / 조각으로 나눠 Update
+int main() {
+  std::vector<std::uint8_t> counting_key(25);
+  for (std::size_t i = 0; i < counting_key.size(); i++) {
+    counting_key[i] = static_cast<std::uint8_t>(i + 1);
+  }
+  const struct {
+    std::vector<std::uint8_t> key;
+    std::vector<std::uint8_t> data;
+    const char* mac;
+  } cases[] = {
+      {std::vector<std::uint8_t>(20, 0x0b), Bytes("Hi There"),
+       "B0344C61D8DB38535CA8AFCEAF0BF12B881DC200C9833DA726E9376C2E32CFF7"},
+      {Bytes("Jefe"), Bytes("what do ya want for nothing?"),
+       "5BDCC146BF60754E6A042426089575C75A003F089D2739839DEC58B964EC3843"},
+      {std::vector<std::uint8_t>(20, 0xaa), std::vector<std::uint8_t>(50, 0xdd),
+       "773EA91E36800E46854DB8EBD09181A72959098B3EF8C122D9635514CED565FE"},
+      {counting_key, std::vector<std::uint8_t>(50, 0xcd),
+       "82558A389A443C0EA4CC819899F2083A85F0FAA3E578F8077A2E3FF46729665B"},
+      {std::vector<std::uint8_t>(131, 0xaa),
+       Bytes("Test Using Larger Than Block-Size Key - Hash Key First"),
+       "60E431591EE0B67F0D8A26AACBF5B77F8E0BC6213728C5140546040F0EE37F54"},
+      {std::vector<std::uint8_t>(131, 0xaa),
+       Bytes("This is a test using a larger than block-size key and a larger "
+             "than block-size data. The key needs to be hashed before being "
+             "used by the HMAC algorithm."),
+       "9B09FFA71B942FCB27635FBCD5B0E944BFDC63644F0713938A7F51535C3A35E2"},
+  };
+
+  for (const auto& test : cases) {
+    hash::HmacSha256 hmac(test.key);
+    const auto tag = hmac.Mac(test.data);
+    if (bedrock::util::BytesToHexStr(tag) != test.mac) {
+      std::cout << "HMAC-SHA256 mismatch\n  expected " << test.mac
+                << "\n  actual   " << bedrock::util::BytesToHexStr(tag)
+                << std::endl;
+      return 1;
+    }
+
+    const std::span<const std::uint8_t> data(test.data);
+    for (std::size_t offset = 0, step = 1; offset < data.size();
+         offset += step, step = (step * 13) % 70 + 1) {
+      hmac.Update(data.subspan(offset, std::min(step, data.size() - offset)));
+    }
+    if (hmac.Final() != tag || !hmac.Verify(data, tag)) {
+      std::cout << "HMAC-SHA256 streaming / Verify mismatch" << std::endl;
+      return 1;
+    }
+  }
+
+  // 키 여러 개, 블록 경계 근처 길이, 일부는 태그를 망가뜨려 섞음
+  std::vector<hash::HmacSha256> keys;
+  for (std::size_t k = 0; k < 5; k++) {
+    keys.emplace_back(std::vector<std::uint8_t>(
+        k * 23, static_cast<std::uint8_t>(0x5a ^ (k * 7))));
+  }
+  std::vector<std::uint8_t> pattern(300);
+  for (std::size_t i = 0; i < pattern.size(); i++) {
+    pattern[i] = static_cast<std::uint8_t>((i * 31) + 7);
+  }
+
+  const std::size_t count = 41;
+  std::vector<hash::HmacSha256::Tag> tags(count);
+  std::vector<hash::HmacVerifyItem> items(count);
+  for (std::size_t i = 0; i < count; i++) {
+    const std::size_t size = (i % 3 == 0) ? (i * 7) : (54 + (i % 12));
+    items[i].key = &keys[i % keys.size()];
+    items[i].message = std::span(pattern).first(size);
+    tags[i] = items[i].key->Mac(items[i].message);
+    if (i % 5 == 4) {
+      tags[i][i % tags[i].size()] ^= 0x01;
+    }
+    items[i].tag = tags[i];
+  }
+  items[7].tag = std::span(tags[7]).first(16);
+  items[11].key = nullptr;
+
+  const auto valid = std::make_unique<bool[]>(count);
+  if (!hash::VerifyMany(items, std::span(valid.get(), count))) {
+    std::cout << "VerifyMany failed" << std::endl;
+    return 1;
+  }
+  for (std::size_t i = 0; i < count; i++) {
+    const bool expected = i % 5 != 4 && i != 7 && i != 11;
+    if (valid[i] != expected) {
+      std::cout << "VerifyMany wrong result at item " << i << std::endl;
+      return 1;
+    }
+  }
+  if (hash::VerifyMany(items, std::span(valid.get(), 1))) {
+    std::cout << "VerifyMany accepted a short result span" << std::endl;
+    return 1;
+  }
+
+  std::cout << "HMAC-SHA256 vectors passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/lsh.h"
+#include "encryption/hash/lsh_multi.h"
+#include "encryption/util/helper.h"
+
+namespace hash = bedrock::hash;
+namespace lsh = bedrock::hash::lsh;
+
+template <std::size_t N>
+static std::string Hex(const std::array<std::byte, N>& bytes) {
+  return bedrock::util::BytesToHexStr(
+      std::span(reinterpret_cast<const std::uint8_t*>(bytes.data()), N));
+}
+
+// 빈 메시지 / "abc" / 패턴 1000바이트. 한 번에 / 조각으로 나눠 Update
+template <typename Lsh>
+static bool Check(const char* name, std::span<const std::uint8_t> pattern,
+                  const std::array<const char*, 3>& mds) {
+  const std::array<std::span<const std::uint8_t>, 3> messages = {
+      std::span<const std::uint8_t>(),
+      std::span(reinterpret_cast<const std::uint8_t*>("abc"), 3), pattern};
+
+  Lsh lsh_hash;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto one_shot = lsh_hash.Digest(messages[i]);
+    if (Hex(one_shot) != mds[i]) {
+      std::cout << name << " mismatch, message " << i << "\n  expected "
+                << mds[i] << "\n  actual   " << Hex(one_shot) << std::endl;
+      return false;
+    }
+
+    const auto message = messages[i];
+    for (std::size_t offset = 0, step = 1; offset < message.size();
+         offset += step, step = (step * 13) % 300 + 1) {
+      lsh_hash.Update(
+          message.subspan(offset, std::min(step, message.size() - offset)));
+    }
+    if (lsh_hash.Digest() != one_shot) {
+      std::cout << name << " streaming mismatch, message " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// bit 길이 입력 (마지막 바이트는 상위 bit부터)
+static hash::HashAlgorithmInputData Bits(std::span<const std::uint8_t> bytes,
+                                         std::uint64_t bit_length) {
+  hash::HashAlgorithmInputData data;
+  for (const std::uint8_t byte : bytes) {
+    data.message.push_back(static_cast<std::byte>(byte));
+  }
+  data.bit_length = bit_length;
+  return data;
+}
+
+// 바이트 중간에서 끝나는 입력: 남는 bit 뒤에 1 bit를 붙인 마지막 블록을
+// 직접 압축한 값과 비교. 그 뒤의 입력과 message보다 긴 bit_length는 거부
+template <typename Lsh>
+static bool CheckBits(const char* name,
+                      std::span<const std::uint8_t> pattern) {
+  constexpr std::size_t kBlock = Lsh::kBlockBytes;
+  Lsh lsh_hash;
+  lsh_hash.Update(Bits(pattern.first(300), 300 * 8));
+  if (lsh_hash.Digest() != lsh_hash.Digest(pattern.first(300))) {
+    std::cout << name << " whole-byte bit input mismatch" << std::endl;
+    return false;
+  }
+
+  // 한 블록 + 3바이트 + 5bit. 마지막 바이트의 하위 3bit는 무시됨
+  auto cv = Lsh::kIv;
+  lsh::CompressBlocks(cv, pattern.data(), 1);
+  std::array<std::uint8_t, kBlock> tail{};
+  std::copy_n(pattern.begin() + kBlock, 3, tail.begin());
+  tail[3] = static_cast<std::uint8_t>((pattern[kBlock + 3] & 0xF8) | 0x04);
+  lsh::CompressBlocks(cv, tail.data(), 1);
+  std::array<std::byte, Lsh::kIv.size() * sizeof(cv[0]) / 2> expected{};
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    const auto word = cv[i / sizeof(cv[0])] ^ cv[(i / sizeof(cv[0])) + 8];
+    expected[i] = static_cast<std::byte>(word >> (8 * (i % sizeof(cv[0]))));
+  }
+
+  std::vector<std::uint8_t> message(pattern.begin(),
+                                    pattern.begin() + kBlock + 4);
+  message.back() = static_cast<std::uint8_t>(message.back() ^ 0x07);
+  lsh_hash.Update(pattern.first(10));
+  lsh_hash.Update(Bits(std::span(message).subspan(10), ((kBlock - 7) * 8) + 5));
+  const bool rejected = !lsh_hash.Update(pattern.first(1));
+  if (!rejected || lsh_hash.Digest() != expected) {
+    std::cout << name << " bit-length message mismatch" << std::endl;
+    return false;
+  }
+
+  lsh_hash.Update(Bits(pattern.first(2), 17));
+  if (lsh_hash.Digest() != lsh_hash.Digest(std::span<const std::uint8_t>())) {
+    std::cout << name << " oversized bit_length accepted" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <std::uint32_t Family>
+static bool CheckMany(const std::vector<std::vector<std::uint8_t>>& storage) {
+  constexpr std::size_t kBytes = Family / 8;
+  const std::vector<std::span<const std::uint8_t>> messages(storage.begin(),
+                                                            storage.end());
+  std::vector<lsh::Digest<kBytes>> digests(messages.size());
+  if (!lsh::DigestMany(messages, std::span(digests))) {
+    std::cout << "DigestMany failed" << std::endl;
+    return false;
+  }
+
+  const hash::LSH<Family> single;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto expected = single.Digest(messages[i]);
+    if (std::memcmp(expected.data(), digests[i].data(), kBytes) != 0) {
+      std::cout << "LSH-" << Family << " DigestMany mismatch at message " << i
+                << " (" << storage[i].size() << " bytes)" << std::endl;
+      return false;
+    }
+  }
+  return !lsh::DigestMany(messages, std::span(digests).first(1));
+}
+
+// 단일 블록 AVX2 커널과 레인 커널을 스칼라 압축과 비교
+template <typename Word>
+static bool CheckKernels(std::span<const std::uint8_t> data) {
+  constexpr std::size_t kLanes = 32 / sizeof(Word);
+  constexpr std::size_t kBlock = lsh::kBlockBytes<Word>;
+  const std::size_t blocks = data.size() / kBlock;
+
+  lsh::ChainVar<Word> expected = lsh::InitialValue<Word>(sizeof(Word) * 64);
+  const lsh::ChainVar<Word> iv = expected;
+  for (std::size_t block = 0; block < blocks; block++) {
+    lsh::CompressBytes(expected, data.data() + (block * kBlock));
+  }
+
+  lsh::ChainVar<Word> avx2 = iv;
+  lsh::CompressBlocksAvx2(avx2, data.data(), blocks);
+  if (avx2 != expected) {
+    std::cout << "AVX2 compress differs from scalar" << std::endl;
+    return false;
+  }
+
+  // 레인 i는 블록 i부터 시작해 한 블록만 압축
+  std::array<Word, 16 * kLanes> lanes{};
+  std::array<const std::uint8_t*, kLanes> inputs{};
+  for (std::size_t lane = 0; lane < kLanes; lane++) {
+    inputs[lane] = data.data() + (lane * kBlock);
+    for (std::size_t word = 0; word < 16; word++) {
+      lanes[(word * kLanes) + lane] = iv[word];
+    }
+  }
+  lsh::CompressLanesAvx2(lanes.data(), inputs.data());
+  for (std::size_t lane = 0; lane < kLanes; lane++) {
+    lsh::ChainVar<Word> single = iv;
+    lsh::CompressBytes(single, inputs[lane]);
+    for (std::size_t word = 0; word < 16; word++) {
+      if (lanes[(word * kLanes) + lane] != single[word]) {
+        std::cout << "lane compress differs from scalar" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main() {
+  // 초기값은 표준에 고정된 상수와 같아야 함
+  if (hash::LSH256::kIv[0] != 0x46a10f1f ||
+      hash::LSH256::kIv[15] != 0xe01afb41 ||
+      hash::LSH256_224::kIv[0] != 0x068608d3 ||
+      hash::LSH512::kIv[0] != 0xadd50f3c7f07094e ||
+      hash::LSH512::kIv[15] != 0x894085e2edb2d819) {
+    std::cout << "LSH initial values mismatch" << std::endl;
+    return 1;
+  }
+
+  std::vector<std::uint8_t> pattern(1000);
+  for (std::size_t i = 0; i < pattern.size(); i++) {
+    pattern[i] = static_cast<std::uint8_t>((i * 31) + 7);
+  }
+
+  using Mds = std::array<const char*, 3>;
+  const Mds lsh256 = {
+      "F3CD416A03818217726CB47F4E4D2881C9C29FD445C18B66FB19DEA1A81007C1",
+      "5FBF365DAEA5446A7053C52B57404D77A07A5F48A1F7C1963A0898BA1B714741",
+      "1C86DB6D00EADBB5A6D4A3B0FCCAC82571D676EE2B2B8CAE1D7F2762BE69DD8A"};
+  const Mds lsh256_224 = {
+      "48A0D55B2B3D91F26E06F7110FE9CE8EA0E2656BBE344CB1C5930653",
+      "F7C53BA4034E708E74FBA42E55997CA5126BB7623688F85342F73732",
+      "74C67BE276159F6A86AF4A2E341A1DD71F59F4AA45FE4F2F89C245AB"};
+  const Mds lsh512 = {
+      "118A2FF2A99E3B2134125E2BAF20EBE3BDD034D5A69B29C22FC4995063340B46"
+      "697801D7F7FB0070568F78E8ED514215FC70AF27D6F27B01AA8A1DA72B14CE7C",
+      "A3D93CFE60DC1AACDD3BD4BEF0A6985381A396C7D49D9FD177795697C3535208"
+      "B5C57224BEF21084D42083E95A4BD8EB33E869812B65031C428819A1E7CE596D",
+      "C539C6E49A7EE74CC165C18440AD4927C771E7F26AE4525C0C55878993851168"
+      "DE06F147D4A91D758FB3D4389C5EB4AD5AD9BC43865830973CBA0834D58DC252"};
+  const Mds lsh512_384 = {
+      "DBB259CF22459368AB2C52B3E1C977288B38670ADCB91CAE6B8B6A2D646E76F8"
+      "BD53E5CAB0E47C856F55249B895C1730",
+      "5F344EFAA0E43CCD2E5E194D6039794B4FB431F10FB4B65FD45E9DA4ECDE0F27"
+      "B66E8DBDFA47252E0D0B741BFD91F9FE",
+      "38AB9ED8387D86F5E3AA9ED2BAEAA98C3C0175CFDAE71E88053BBEC23C1AAE9D"
+      "7B4C11D241A278CE5C9B59EDB26CAFC7"};
+  const Mds lsh512_256 = {
+      "706DF4EBF100F06D5CC9F6C79BE5297C3F6F515801DD10FBC1B665A2D7BDB653",
+      "CD892310532602332B613F1EC11A6962FCA61EA09ECFFCD4BCF75858D802EDEC",
+      "38CFC857B39417AC140AC8E811CD3B49AD0C7CFC09998445884C646DCD95316D"};
+  const Mds lsh512_224 = {
+      "3C124EDFE149B45C067965DAE681322CDF52AA2C9D738B8F271B9318",
+      "D1683234513EC5698394571EAD128A8CD5373E97661BA20DCF89E489",
+      "81A42FF7CBA9B94446E77D3FC63863FD52758BC5B5C4BA4A54BF9EB5"};
+  if (!Check<hash::LSH256>("LSH-256-256", pattern, lsh256) ||
+      !Check<hash::LSH256_224>("LSH-256-224", pattern, lsh256_224) ||
+      !Check<hash::LSH512>("LSH-512-512", pattern, lsh512) ||
+      !Check<hash::LSH512_384>("LSH-512-384", pattern, lsh512_384) ||
+      !Check<hash::LSH512_256>("LSH-512-256", pattern, lsh512_256) ||
+      !Check<hash::LSH512_224>("LSH-512-224", pattern, lsh512_224)) {
+    return 1;
+  }
+
+  if (!CheckBits<hash::LSH256>("LSH-256-256", pattern) ||
+      !CheckBits<hash::LSH512>("LSH-512-512", pattern)) {
+    return 1;
+  }
+
+  // 블록(128 / 256바이트) 경계 근처 길이를 섞어 레인이 여러 번 다시 채워지도록
+  std::vector<std::vector<std::uint8_t>> storage;
+  for (std::size_t i = 0; i < 23; i++) {
+    const std::size_t size =
+        (i % 4 == 0) ? (i * 37) : (126 + (i % 3) + ((i / 8) * 128));
+    storage.emplace_back(pattern.begin(),
+                         pattern.begin() + static_cast<std::ptrdiff_t>(size));
+  }
+  if (!CheckMany<256>(storage) || !CheckMany<512>(storage)) {
+    return 1;
+  }
+
+  // 레인 수만큼 블록이 있으면 두 계열 모두 레인마다 다른 블록을 받음
+  std::vector<std::uint8_t> data(8 * 256);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<std::uint8_t>((i * 131) + 7);
+  }
+  const auto reg = bedrock::intrinsic::GetCPUFeatures();
+  if (bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2") &&
+      (!CheckKernels<std::uint32_t>(data) ||
+       !CheckKernels<std::uint64_t>(data))) {
+    return 1;
+  }
+
+  std::cout << "LSH vectors passed." << std::endl;
+  return 0;
+}
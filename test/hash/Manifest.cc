@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "encryption/hash/manifest.h"
+#include "encryption/hash/merkle.h"
+#include "encryption/hash/sha.h"
+
+namespace fs = std::filesystem;
+namespace hash = bedrock::hash;
+
+struct TestFile {
+  fs::path path;
+  std::vector<std::uint8_t> data;
+};
+
+static bool Check(const fs::path& root, const std::vector<TestFile>& files,
+                  const hash::ManifestOptions& options) {
+  std::vector<hash::ManifestEntry> entries;
+  if (!hash::BuildManifest(root, options, entries) ||
+      entries.size() != files.size()) {
+    std::cout << "BuildManifest failed" << std::endl;
+    return false;
+  }
+  // files는 경로 순으로 만들어 둠
+  for (std::size_t i = 0; i < files.size(); i++) {
+    const hash::ManifestEntry& entry = entries[i];
+    const auto& data = files[i].data;
+    hash::sha256::Digest expected;
+    if (options.digest == hash::ManifestDigest::kMerkle) {
+      hash::merkle::TreeHash(data, {options.leaf_bytes, 1}, expected);
+    } else {
+      const auto digest = hash::SHA256().Digest(data);
+      std::memcpy(expected.data(), digest.data(), digest.size());
+    }
+    if (entry.path != files[i].path || entry.bytes != data.size() ||
+        !entry.readable || entry.digest != expected) {
+      std::cout << "manifest entry mismatch: " << files[i].path << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  const fs::path root =
+      fs::temp_directory_path() / "bedrock_manifest_test";
+  std::error_code ignored;
+  fs::remove_all(root, ignored);
+
+  // 빈 파일, 작은 파일 여러 개(묶음 여러 개), 큰 파일, 하위 디렉터리
+  std::vector<TestFile> files;
+  const std::size_t sizes[] = {0,     1,     63,   64,    1000, 4096,
+                               4097,  9000,  55,   20000, 777,  123457};
+  for (std::size_t i = 0; i < std::size(sizes); i++) {
+    TestFile file;
+    file.path = fs::path(i % 3 == 0 ? "a" : (i % 3 == 1 ? "b/c" : "b")) /
+                ("f" + std::to_string(i));
+    file.data.resize(sizes[i]);
+    for (std::size_t j = 0; j < sizes[i]; j++) {
+      file.data[j] = static_cast<std::uint8_t>((j * 131) + i);
+    }
+    fs::create_directories((root / file.path).parent_path());
+    std::ofstream out(root / file.path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(file.data.data()),
+              static_cast<std::streamsize>(file.data.size()));
+    files.push_back(std::move(file));
+  }
+  fs::create_directories(root / "empty_dir");
+  std::ranges::sort(files, {}, &TestFile::path);
+
+  hash::ManifestOptions options;
+  options.threads = 3;
+  options.small_file_bytes = 4096;
+  options.batch_files = 3;
+  if (!Check(root, files, options)) {
+    return 1;
+  }
+  options.threads = 1;
+  if (!Check(root, files, options)) {
+    return 1;
+  }
+
+  // 큰 파일은 리프 구간으로 나뉘어 여러 스레드에 돌아감
+  options.threads = 4;
+  options.digest = hash::ManifestDigest::kMerkle;
+  options.leaf_bytes = 1024;
+  if (!Check(root, files, options)) {
+    return 1;
+  }
+  // 매핑 / 리프 여러 개를 한 번에 읽는 경우
+  options.read.mode = hash::FileReadMode::kMap;
+  if (!Check(root, files, options)) {
+    return 1;
+  }
+  options.read.mode = hash::FileReadMode::kPipeline;
+  options.read.chunk_bytes = 4096;
+  if (!Check(root, files, options)) {
+    return 1;
+  }
+
+  std::vector<hash::ManifestEntry> entries(1);
+  entries[0].path = "x\\y";
+  entries[0].readable = true;
+  const std::string expected =
+      "\\" + std::string(64, '0') + "  x\\\\y\n";
+  if (hash::FormatManifest(entries) != expected) {
+    std::cout << "FormatManifest escape mismatch" << std::endl;
+    return 1;
+  }
+
+  if (hash::BuildManifest(root / "missing", {}, entries)) {
+    std::cout << "BuildManifest accepted a missing directory" << std::endl;
+    return 1;
+  }
+
+  fs::remove_all(root, ignored);
+  std::cout << "manifest tests passed." << std::endl;
+  return 0;
+}
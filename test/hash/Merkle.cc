@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "encryption/hash/merkle.h"
+#include "encryption/hash/sha.h"
+#include "encryption/util/helper.h"
+
+namespace merkle = bedrock::hash::merkle;
+
+static merkle::Digest Sha(std::span<const std::uint8_t> data) {
+  bedrock::hash::SHA<256> sha;
+  const auto digest = sha.Digest(data);
+  merkle::Digest out;
+  std::memcpy(out.data(), digest.data(), out.size());
+  return out;
+}
+
+// 정의대로 SHA<256>만으로 계산한 루트
+static merkle::Digest Reference(std::span<const std::uint8_t> data,
+                                std::size_t leaf_bytes) {
+  std::vector<merkle::Digest> level;
+  for (std::size_t offset = 0; offset < data.size() || level.empty();
+       offset += leaf_bytes) {
+    level.push_back(
+        Sha(data.subspan(offset, std::min(leaf_bytes, data.size() - offset))));
+  }
+  while (level.size() > 1) {
+    std::vector<merkle::Digest> parents;
+    for (std::size_t i = 0; i + 1 < level.size(); i += 2) {
+      std::array<std::uint8_t, 64> pair;
+      std::memcpy(pair.data(), level[i].data(), 32);
+      std::memcpy(pair.data() + 32, level[i + 1].data(), 32);
+      parents.push_back(Sha(pair));
+    }
+    if (level.size() % 2 != 0) {
+      parents.push_back(level.back());
+    }
+    level = parents;
+  }
+  std::array<std::uint8_t, 64> last{};
+  std::memcpy(last.data(), level[0].data(), 32);
+  for (std::size_t i = 0; i < 8; i++) {
+    last[32 + i] =
+        static_cast<std::uint8_t>(data.size() >> (56 - (8 * i)));
+  }
+  return Sha(last);
+}
+
+int main() {
+  merkle::Digest root;
+  if (!merkle::TreeHash({}, {}, root) ||
+      bedrock::util::BytesToHexStr(root) !=
+          "179271825F84234176C90CBD27F0821BA1544EDDD10836AAF72BD9614E8CF325") {
+    std::cout << "empty input root mismatch" << std::endl;
+    return 1;
+  }
+
+  std::vector<std::uint8_t> data(5000);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<std::uint8_t>((i * 131) + (i >> 8));
+  }
+
+  // 리프 수가 1, 2의 거듭제곱, 홀수인 경우와 마지막 리프가 짧은 경우
+  const struct {
+    std::size_t bytes;
+    std::size_t leaf_bytes;
+  } shapes[] = {{1, 64}, {64, 64}, {512, 64}, {1300, 100}, {5000, 64},
+                {5000, 333}, {5000, 4096}};
+  for (const auto& shape : shapes) {
+    const auto input = std::span(data).first(shape.bytes);
+    const merkle::Digest expected = Reference(input, shape.leaf_bytes);
+    for (const std::size_t threads : {std::size_t{1}, std::size_t{4}}) {
+      std::vector<merkle::Digest> leaves(
+          merkle::LeafCount(shape.bytes, shape.leaf_bytes));
+      if (!merkle::TreeHash(input, {shape.leaf_bytes, threads}, root,
+                            leaves) ||
+          root != expected) {
+        std::cout << "root mismatch for " << shape.bytes << " bytes / "
+                  << shape.leaf_bytes << "-byte leaves, " << threads
+                  << " threads" << std::endl;
+        return 1;
+      }
+      for (std::size_t leaf = 0; leaf < leaves.size(); leaf++) {
+        const std::size_t offset = leaf * shape.leaf_bytes;
+        if (leaves[leaf] !=
+            Sha(input.subspan(offset, std::min(shape.leaf_bytes,
+                                               input.size() - offset)))) {
+          std::cout << "leaf digest mismatch at leaf " << leaf << std::endl;
+          return 1;
+        }
+      }
+      merkle::Digest reduced;
+      if (!merkle::Reduce(leaves, shape.bytes, reduced) ||
+          reduced != expected) {
+        std::cout << "Reduce mismatch" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  // 두 자식을 이어 붙인 64바이트 입력은 다른 루트여야 함 (두 번째 원상)
+  std::vector<merkle::Digest> pair_leaves(2);
+  if (!merkle::TreeHash(std::span(data).first(128), {64, 1}, root,
+                        pair_leaves)) {
+    return 1;
+  }
+  std::array<std::uint8_t, 64> children;
+  std::memcpy(children.data(), pair_leaves[0].data(), 32);
+  std::memcpy(children.data() + 32, pair_leaves[1].data(), 32);
+  merkle::Digest forged;
+  if (!merkle::TreeHash(children, {64, 1}, forged) || forged == root) {
+    std::cout << "child concatenation collides with the root" << std::endl;
+    return 1;
+  }
+
+  std::vector<merkle::Digest> short_leaves(2);
+  if (merkle::TreeHash(data, {0, 1}, root) ||
+      merkle::TreeHash(data, {64, 1}, root, short_leaves) ||
+      merkle::Reduce({}, 0, root)) {
+    std::cout << "TreeHash accepted invalid arguments" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Merkle tree hash passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include "encryption/hash/merkle.h"
+#include "encryption/hash/merkle_index.h"
+
+namespace merkle = bedrock::hash::merkle;
+
+// 인덱스의 루트 / 리프가 처음부터 다시 계산한 트리와 같은지
+static bool Matches(const merkle::MerkleIndex& index,
+                    std::span<const std::uint8_t> data,
+                    const merkle::TreeOptions& options) {
+  std::vector<merkle::Digest> leaves(
+      merkle::LeafCount(data.size(), options.leaf_bytes));
+  merkle::Digest root;
+  if (!merkle::TreeHash(data, options, root, leaves)) {
+    return false;
+  }
+  const auto stored = index.Leaves();
+  return index.Root() == root && stored.size() == leaves.size() &&
+         std::equal(stored.begin(), stored.end(), leaves.begin());
+}
+
+int main() {
+  const auto path = std::filesystem::temp_directory_path() /
+                    "bedrock_merkle_index_test.mrk";
+
+  std::vector<std::uint8_t> data(37 * 256 + 91);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<std::uint8_t>((i * 131) + (i >> 8));
+  }
+  const merkle::TreeOptions options = {256, 3};
+
+  merkle::MerkleIndex index;
+  if (!index.Create(path, data, options) || !Matches(index, data, options)) {
+    std::cout << "MerkleIndex Create mismatch" << std::endl;
+    return 1;
+  }
+
+  // 한 바이트, 리프 경계를 걸친 구간, 마지막 짧은 리프, 전체
+  const struct {
+    std::size_t offset;
+    std::size_t length;
+  } edits[] = {{0, 1},    {255, 2},          {1000, 3000},
+               {9450, 23}, {data.size() - 1, 1}, {0, data.size()}};
+  for (const auto& edit : edits) {
+    for (std::size_t i = edit.offset; i < edit.offset + edit.length; i++) {
+      data[i] = static_cast<std::uint8_t>(data[i] ^ (0x5a + i));
+    }
+    if (!index.Update(data, edit.offset, edit.length) ||
+        !Matches(index, data, options)) {
+      std::cout << "MerkleIndex Update mismatch at offset " << edit.offset
+                << std::endl;
+      return 1;
+    }
+  }
+
+  if (index.Update(std::span(data).first(data.size() - 1), 0, 1) ||
+      index.Update(data, data.size(), 1)) {
+    std::cout << "MerkleIndex accepted a bad update" << std::endl;
+    return 1;
+  }
+
+  // 다시 열어도 같은 트리
+  const merkle::Digest root = index.Root();
+  if (!index.Sync()) {
+    std::cout << "MerkleIndex Sync failed" << std::endl;
+    return 1;
+  }
+  index.Close();
+  merkle::MerkleIndex reopened;
+  if (!reopened.Open(path) || reopened.Root() != root ||
+      reopened.LeafBytes() != options.leaf_bytes ||
+      reopened.DataBytes() != data.size() ||
+      !Matches(reopened, data, options)) {
+    std::cout << "MerkleIndex Open mismatch" << std::endl;
+    return 1;
+  }
+  reopened.Close();
+
+  // 헤더가 망가진 파일은 열지 않음
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(0);
+    file.put('X');
+  }
+  if (reopened.Open(path) || reopened.IsOpen()) {
+    std::cout << "MerkleIndex opened a corrupted file" << std::endl;
+    return 1;
+  }
+
+  // 리프 하나짜리 인덱스의 헤더 길이를 부풀림. 리프 수를 올림할 때
+  // 넘치면 다시 리프 하나로 보여 크기 검사를 통과하던 경우
+  if (!index.Create(path, std::span(data).first(100), options)) {
+    std::cout << "MerkleIndex Create failed" << std::endl;
+    return 1;
+  }
+  index.Close();
+  {
+    const std::uint64_t leaf_bytes = 2;
+    const std::uint64_t data_bytes = ~std::uint64_t{0};
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(8);
+    file.write(reinterpret_cast<const char*>(&leaf_bytes), 8);
+    file.write(reinterpret_cast<const char*>(&data_bytes), 8);
+  }
+  if (reopened.Open(path) || reopened.IsOpen()) {
+    std::cout << "MerkleIndex opened an oversized header" << std::endl;
+    return 1;
+  }
+
+  std::error_code ignored;
+  std::filesystem::remove(path, ignored);
+  std::cout << "MerkleIndex tests passed." << std::endl;
+  return 0;
+}
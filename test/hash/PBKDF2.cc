@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "encryption/hash/hmac.h"
+#include "encryption/hash/pbkdf2.h"
+#include "encryption/util/helper.h"
+
+namespace hash = bedrock::hash;
+
+static std::vector<std::uint8_t> Bytes(const std::string& text) {
+  return {text.begin(), text.end()};
+}
+
+// RFC 8018 정의를 HmacSha256::Mac으로 그대로 옮긴 비교용 구현
+static std::vector<std::uint8_t> Reference(
+    const std::vector<std::uint8_t>& password,
+    const std::vector<std::uint8_t>& salt, std::uint32_t iterations,
+    std::size_t length) {
+  const hash::HmacSha256 key(password);
+  std::vector<std::uint8_t> out;
+  for (std::uint32_t block = 1; out.size() < length; block++) {
+    std::vector<std::uint8_t> message = salt;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      message.push_back(static_cast<std::uint8_t>(block >> shift));
+    }
+    auto u = key.Mac(message);
+    auto t = u;
+    for (std::uint32_t j = 1; j < iterations; j++) {
+      u = key.Mac(u);
+      for (std::size_t i = 0; i < t.size(); i++) {
+        t[i] ^= u[i];
+      }
+    }
+    out.insert(out.end(), t.begin(), t.end());
+  }
+  out.resize(length);
+  return out;
+}
+
+int main() {
+  // RFC 7914 11절, 그 외는 널리 쓰이는 PBKDF2-HMAC-SHA256 벡터
+  const struct {
+    std::vector<std::uint8_t> password;
+    std::vector<std::uint8_t> salt;
+    std::uint32_t iterations;
+    const char* dk;
+  } cases[] = {
+      {Bytes("password"), Bytes("salt"), 1,
+       "120FB6CFFCF8B32C43E7225256C4F837A86548C92CCC35480805987CB70BE17B"},
+      {Bytes("password"), Bytes("salt"), 4096,
+       "C5E478D59288C841AA530DB6845C4C8D962893A001CE4E11A4963873AA98134A"},
+      {Bytes("passwordPASSWORDpassword"),
+       Bytes("saltSALTsaltSALTsaltSALTsaltSALTsalt"), 4096,
+       "348C89DBCBD32B2F32D814B8116E84CF2B17347EBC1800181C4E2A1FB8DD53E1"
+       "C635518C7DAC47E9"},
+      {Bytes(std::string("pass\0word", 9)), Bytes(std::string("sa\0lt", 5)),
+       4096, "89B69D0516F829893C696226650A8687"},
+      {Bytes("passwd"), Bytes("salt"), 1,
+       "55AC046E56E3089FEC1691C22544B605F94185216DDE0465E68B9D57C20DACBC"
+       "49CA9CCCF179B645991664B39D77EF317C71B845B1E30BD509112041D3A19783"},
+  };
+
+  for (const auto& test : cases) {
+    std::vector<std::uint8_t> dk(std::string(test.dk).size() / 2);
+    if (!hash::Pbkdf2HmacSha256(test.password, test.salt, test.iterations,
+                                dk) ||
+        bedrock::util::BytesToHexStr(dk) != test.dk) {
+      std::cout << "PBKDF2-HMAC-SHA256 mismatch\n  expected " << test.dk
+                << "\n  actual   " << bedrock::util::BytesToHexStr(dk)
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // 출력 길이가 제각각인 요청을 섞어 레인이 여러 번 채워지고
+  // 마지막 묶음은 일부만 차도록
+  const std::uint32_t iterations = 7;
+  std::vector<std::vector<std::uint8_t>> passwords;
+  std::vector<std::vector<std::uint8_t>> salts;
+  std::vector<std::vector<std::uint8_t>> outputs;
+  for (std::size_t i = 0; i < 13; i++) {
+    passwords.emplace_back(i * 11, static_cast<std::uint8_t>(i + 1));
+    salts.emplace_back(i % 5 * 9, static_cast<std::uint8_t>(0xa0 ^ i));
+    outputs.emplace_back((i % 4 == 0) ? 100 : (16 + (i * 3)));
+  }
+  std::vector<hash::Pbkdf2Request> requests;
+  for (std::size_t i = 0; i < passwords.size(); i++) {
+    requests.push_back({passwords[i], salts[i], outputs[i]});
+  }
+  if (!hash::Pbkdf2HmacSha256Many(requests, iterations)) {
+    std::cout << "Pbkdf2HmacSha256Many failed" << std::endl;
+    return 1;
+  }
+  for (std::size_t i = 0; i < requests.size(); i++) {
+    if (outputs[i] !=
+        Reference(passwords[i], salts[i], iterations, outputs[i].size())) {
+      std::cout << "Pbkdf2HmacSha256Many mismatch at request " << i
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // 잘못된 요청이 섞이면 아무것도 쓰지 않음
+  std::vector<std::uint8_t> untouched(outputs[0].size(), 0);
+  requests[0].out = untouched;
+  requests[1].out = {};
+  if (hash::Pbkdf2HmacSha256Many(requests, iterations) ||
+      std::ranges::any_of(untouched, [](std::uint8_t b) { return b != 0; }) ||
+      hash::Pbkdf2HmacSha256(passwords[0], salts[0], 0, outputs[0])) {
+    std::cout << "PBKDF2 accepted an invalid request" << std::endl;
+    return 1;
+  }
+
+  std::cout << "PBKDF2-HMAC-SHA256 vectors passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/compress_kernel_runner.h"
+#include "encryption/hash/sha.h"
+#include "encryption/util/helper.h"
+
+// FIPS 180 예제 메시지: 빈 문자열, "abc", 448비트, 'a' 백만 개
+int main() {
+  namespace sha1 = bedrock::hash::sha1;
+
+  const std::string two_block =
+      "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  const std::vector<std::uint8_t> million(1000000, 'a');
+  const std::array<std::span<const std::uint8_t>, 4> messages = {
+      std::span<const std::uint8_t>(),
+      std::span(reinterpret_cast<const std::uint8_t*>("abc"), 3),
+      std::span(reinterpret_cast<const std::uint8_t*>(two_block.data()),
+                two_block.size()),
+      std::span<const std::uint8_t>(million)};
+  const std::array<const char*, 4> mds = {
+      "DA39A3EE5E6B4B0D3255BFEF95601890AFD80709",
+      "A9993E364706816ABA3E25717850C26C9CD0D89D",
+      "84983E441C3BD26EBAAE4AA1F95129E5E54670F1",
+      "34AA973CD4C4DAA4F61EEB2BDBAD27316534016F"};
+
+  bedrock::hash::SHA1 sha;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto one_shot = sha.Digest(messages[i]);
+    const std::string actual = bedrock::util::BytesToHexStr(
+        std::span(reinterpret_cast<const std::uint8_t*>(one_shot.data()),
+                  one_shot.size()));
+    if (actual != mds[i]) {
+      std::cout << "SHA-1 mismatch, message " << i << "\n  expected "
+                << mds[i] << "\n  actual   " << actual << std::endl;
+      return 1;
+    }
+
+    // 블록 경계를 가로지르도록 조각 크기를 바꿔가며 Update
+    const auto message = messages[i];
+    for (std::size_t offset = 0, step = 1; offset < message.size();
+         offset += step, step = (step * 13) % 1000 + 1) {
+      sha.Update(
+          message.subspan(offset, std::min(step, message.size() - offset)));
+    }
+    if (sha.Digest() != one_shot) {
+      std::cout << "SHA-1 streaming mismatch, message " << i << std::endl;
+      return 1;
+    }
+  }
+
+  // 각 커널(SSSE3 / SHA-NI)과 스칼라 압축 비교
+  const bedrock::test::CompressKernel<sha1::State> kernels[] = {
+      {"dispatched", "SSE2", sha1::CompressBlocks},
+      {"scalar", "SSE2", sha1::CompressBlocksScalar},
+      {"SSSE3", "SSSE3", sha1::CompressBlocksSsse3},
+      {"SHA-NI", "SHA", sha1::CompressBlocksShaNi},
+  };
+  if (!bedrock::test::CompressKernelsMatchScalar(
+          sha1::kH0, sha1::kBlockBytes, sha1::CompressBytes, kernels)) {
+    return 1;
+  }
+
+  std::cout << "SHA-1 vectors passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "encryption/hash/hmac.h"
+#include "encryption/hash/sha.h"
+#include "encryption/hash/sha256_constexpr.h"
+
+namespace sha256 = bedrock::hash::sha256;
+
+static constexpr std::uint8_t HexNibble(char c) {
+  return static_cast<std::uint8_t>(c <= '9' ? c - '0' : c - 'A' + 10);
+}
+
+static constexpr sha256::Digest FromHex(std::string_view hex) {
+  sha256::Digest digest{};
+  for (std::size_t i = 0; i < digest.size(); i++) {
+    digest[i] = static_cast<std::uint8_t>((HexNibble(hex[2 * i]) << 4) |
+                                          HexNibble(hex[(2 * i) + 1]));
+  }
+  return digest;
+}
+
+// FIPS 180-4 / RFC 4231 예제를 컴파일 시간에 확인
+static_assert(sha256::DigestConstexpr("") ==
+              FromHex("E3B0C44298FC1C149AFBF4C8996FB92427AE41E4649B934CA495991B"
+                      "7852B855"));
+static_assert(sha256::DigestConstexpr("abc") ==
+              FromHex("BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61"
+                      "F20015AD"));
+static_assert(
+    sha256::DigestConstexpr(
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+    FromHex("248D6A61D20638B8E5C026930C3E6039"
+            "A33CE45964FF2167F6ECEDD419DB06C1"));
+static_assert(
+    sha256::HmacConstexpr("Jefe", "what do ya want for nothing?") ==
+    FromHex("5BDCC146BF60754E6A042426089575C7"
+            "5A003F089D2739839DEC58B964EC3843"));
+
+// 블록보다 긴 키 (RFC 4231 예제 6)
+static constexpr std::array<std::uint8_t, 131> kLongKey = [] {
+  std::array<std::uint8_t, 131> key{};
+  key.fill(0xaa);
+  return key;
+}();
+static constexpr std::array<std::uint8_t, 54> kLongKeyMessage = [] {
+  constexpr std::string_view text =
+      "Test Using Larger Than Block-Size Key - Hash Key First";
+  std::array<std::uint8_t, 54> message{};
+  for (std::size_t i = 0; i < message.size(); i++) {
+    message[i] = static_cast<std::uint8_t>(text[i]);
+  }
+  return message;
+}();
+static_assert(
+    sha256::HmacConstexpr(kLongKey, kLongKeyMessage) ==
+    FromHex("60E431591EE0B67F0D8A26AACBF5B77F"
+            "8E0BC6213728C5140546040F0EE37F54"));
+
+int main() {
+  // 런타임에도 같은 함수가 SHA<256> / HmacSha256과 같은 값을 냄
+  std::vector<std::uint8_t> data(300);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<std::uint8_t>((i * 131) + 7);
+  }
+  const bedrock::hash::SHA<256> sha;
+  const bedrock::hash::HmacSha256 hmac{std::span(data).first(77)};
+  for (std::size_t size = 0; size <= data.size(); size += 7) {
+    const auto message = std::span<const std::uint8_t>(data).first(size);
+    const auto expected = sha.Digest(message);
+    const auto digest = sha256::DigestConstexpr(message);
+    if (std::memcmp(expected.data(), digest.data(), digest.size()) != 0) {
+      std::cout << "DigestConstexpr mismatch at " << size << " bytes"
+                << std::endl;
+      return 1;
+    }
+    if (sha256::HmacConstexpr(std::span(data).first(77), message) !=
+        hmac.Mac(message)) {
+      std::cout << "HmacConstexpr mismatch at " << size << " bytes"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "SHA-256 constexpr vectors passed." << std::endl;
+  return 0;
+}
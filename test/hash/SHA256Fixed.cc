@@ -0,0 +1,125 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha.h"
+#include "encryption/hash/sha256_fixed.h"
+#include "encryption/util/helper.h"
+
+namespace sha256 = bedrock::hash::sha256;
+
+template <std::size_t N>
+static bool SameAsSha(const sha256::Digest& digest,
+                      const std::array<std::uint8_t, N>& input) {
+  bedrock::hash::SHA<256> sha;
+  const auto expected = sha.Digest(std::span<const std::uint8_t>(input));
+  return std::memcmp(expected.data(), digest.data(), digest.size()) == 0;
+}
+
+// 고정 길이 경로와 묶음 경로가 SHA<256>과 같은지, 미리 계산한 패딩 블록
+// 스케줄 커널(단일 / 레인)이 실제 패딩 블록 압축과 같은지 확인
+int main() {
+  const sha256::Block64 zeros64{};
+  const sha256::Digest zeros32{};
+  if (bedrock::util::BytesToHexStr(sha256::Hash64(zeros64)) !=
+          "F5A5FD42D16A20302798EF6ED309979B43003D2320D9F0E8EA9831A92759FB4B" ||
+      bedrock::util::BytesToHexStr(sha256::Hash32(zeros32)) !=
+          "66687AADF862BD776C8FC18B8E9F8E20089714856EE233B3902A591D0D5F2925") {
+    std::cout << "Hash64 / Hash32 of zeros mismatch" << std::endl;
+    return 1;
+  }
+
+  const std::size_t count = 37;
+  std::vector<sha256::Block64> blocks(count);
+  std::vector<sha256::Digest> halves(count);
+  for (std::size_t i = 0; i < count; i++) {
+    for (std::size_t j = 0; j < 64; j++) {
+      blocks[i][j] = static_cast<std::uint8_t>((j * 29) + (i * 7) + 1);
+    }
+    std::memcpy(halves[i].data(), blocks[i].data(), halves[i].size());
+  }
+
+  std::vector<sha256::Digest> digests64(count);
+  std::vector<sha256::Digest> digests32(count);
+  if (!sha256::Hash64Many(blocks, digests64) ||
+      !sha256::Hash32Many(halves, digests32)) {
+    std::cout << "Hash64Many / Hash32Many failed" << std::endl;
+    return 1;
+  }
+  for (std::size_t i = 0; i < count; i++) {
+    sha256::Digest left;
+    sha256::Digest right;
+    std::memcpy(left.data(), blocks[i].data(), 32);
+    std::memcpy(right.data(), blocks[i].data() + 32, 32);
+    if (!SameAsSha(sha256::Hash64(blocks[i]), blocks[i]) ||
+        sha256::Hash64(left, right) != digests64[i] ||
+        !SameAsSha(digests64[i], blocks[i]) ||
+        !SameAsSha(sha256::Hash32(halves[i]), halves[i]) ||
+        !SameAsSha(digests32[i], halves[i])) {
+      std::cout << "fixed-length digest mismatch at input " << i << std::endl;
+      return 1;
+    }
+  }
+  if (sha256::Hash64Many(blocks, std::span(digests64).first(2))) {
+    std::cout << "short output span accepted" << std::endl;
+    return 1;
+  }
+
+  // 임의 상태에서 패딩 블록을 압축한 결과와 비교
+  sha256::Block64 pad{};
+  pad[0] = 0x80;
+  pad[62] = 0x02;
+  sha256::State start{};
+  for (std::size_t word = 0; word < 8; word++) {
+    start[word] = static_cast<std::uint32_t>(0x9e3779b9U * (word + 1));
+  }
+  sha256::State expected = start;
+  sha256::CompressBytes(expected, pad.data());
+
+  sha256::State scalar = start;
+  sha256::State dispatched = start;
+  sha256::CompressKPlusWScalar(scalar, sha256::kPad64KPlusW.data());
+  sha256::CompressKPlusW(dispatched, sha256::kPad64KPlusW.data());
+  if (scalar != expected || dispatched != expected) {
+    std::cout << "precomputed schedule compress mismatch" << std::endl;
+    return 1;
+  }
+
+  const auto reg = bedrock::intrinsic::GetCPUFeatures();
+  for (const std::size_t lanes : {std::size_t{8}, std::size_t{16}}) {
+    if (!bedrock::intrinsic::IsCpuEnabledFeature(
+            reg, lanes == 8 ? "AVX2" : "AVX512F")) {
+      continue;
+    }
+    std::vector<std::uint32_t> state(8 * lanes);
+    for (std::size_t word = 0; word < 8; word++) {
+      for (std::size_t lane = 0; lane < lanes; lane++) {
+        state[(word * lanes) + lane] = start[word];
+      }
+    }
+    if (lanes == 8) {
+      sha256::CompressKPlusWLanesAvx2(state.data(),
+                                      sha256::kPad64KPlusW.data());
+    } else {
+      sha256::CompressKPlusWLanesAvx512(state.data(),
+                                        sha256::kPad64KPlusW.data());
+    }
+    for (std::size_t word = 0; word < 8; word++) {
+      for (std::size_t lane = 0; lane < lanes; lane++) {
+        if (state[(word * lanes) + lane] != expected[word]) {
+          std::cout << lanes << "-lane precomputed schedule mismatch"
+                    << std::endl;
+          return 1;
+        }
+      }
+    }
+  }
+
+  std::cout << "SHA-256 fixed-length paths passed." << std::endl;
+  return 0;
+}
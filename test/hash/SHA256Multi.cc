@@ -0,0 +1,94 @@
+#include <array>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha.h"
+#include "encryption/hash/sha256_multi.h"
+
+// 길이가 제각각인 메시지들을 한 번에 해시한 결과가 SHA<256> 단일 경로와
+// 같은지 확인. 레인 수보다 메시지가 많아 끝난 레인이 다시 채워지도록 함
+int main() {
+  namespace sha256 = bedrock::hash::sha256;
+
+  std::vector<std::vector<std::uint8_t>> storage;
+  for (std::size_t i = 0; i < 41; i++) {
+    // 패딩 경계(55, 56, 63, 64바이트) 근처와 수 KB 메시지를 섞음
+    const std::size_t size = (i % 5 == 0) ? (i * 97) : (50 + (i % 16));
+    std::vector<std::uint8_t> message(size);
+    for (std::size_t j = 0; j < size; j++) {
+      message[j] = static_cast<std::uint8_t>((j * 31) + i);
+    }
+    storage.push_back(std::move(message));
+  }
+  std::vector<std::span<const std::uint8_t>> messages(storage.begin(),
+                                                      storage.end());
+
+  std::vector<sha256::Digest> digests(messages.size());
+  if (!sha256::DigestMany(messages, digests)) {
+    std::cout << "DigestMany failed" << std::endl;
+    return 1;
+  }
+
+  bedrock::hash::SHA<256> sha;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto expected = sha.Digest(messages[i]);
+    if (std::memcmp(expected.data(), digests[i].data(), expected.size()) !=
+        0) {
+      std::cout << "digest mismatch at message " << i << " ("
+                << storage[i].size() << " bytes)" << std::endl;
+      return 1;
+    }
+  }
+
+  if (sha256::DigestMany(messages, std::span(digests).first(3))) {
+    std::cout << "short output span accepted" << std::endl;
+    return 1;
+  }
+
+  // 레인 커널을 직접 호출해 레인마다 스칼라 결과와 비교
+  const auto reg = bedrock::intrinsic::GetCPUFeatures();
+  for (const std::size_t lanes : {std::size_t{8}, std::size_t{16}}) {
+    if (!bedrock::intrinsic::IsCpuEnabledFeature(
+            reg, lanes == 8 ? "AVX2" : "AVX512F")) {
+      continue;
+    }
+    std::vector<std::uint32_t> state(8 * lanes);
+    std::vector<const std::uint8_t*> blocks(lanes);
+    for (std::size_t lane = 0; lane < lanes; lane++) {
+      for (std::size_t word = 0; word < 8; word++) {
+        state[(word * lanes) + lane] =
+            static_cast<std::uint32_t>((lane * 0x01000193U) ^ word);
+      }
+      blocks[lane] = storage[40].data() + (lane * 64);
+    }
+    std::vector<std::uint32_t> expected = state;
+    for (std::size_t lane = 0; lane < lanes; lane++) {
+      sha256::State h{};
+      for (std::size_t word = 0; word < 8; word++) {
+        h[word] = expected[(word * lanes) + lane];
+      }
+      sha256::CompressBytes(h, blocks[lane]);
+      for (std::size_t word = 0; word < 8; word++) {
+        expected[(word * lanes) + lane] = h[word];
+      }
+    }
+
+    if (lanes == 8) {
+      sha256::CompressLanesAvx2(state.data(), blocks.data());
+    } else {
+      sha256::CompressLanesAvx512(state.data(), blocks.data());
+    }
+    if (state != expected) {
+      std::cout << lanes << "-lane kernel differs from scalar" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "SHA-256 multi-buffer passed." << std::endl;
+  return 0;
+}
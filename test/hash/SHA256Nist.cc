@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/compress_kernel_runner.h"
+#include "common/nist_testvector_parser.h"
+#include "encryption/hash/sha.h"
+
+namespace parser = bedrock::util::NISTTestVectorParser;
+
+// NIST CAVS SHA-256 바이트 벡터. 한 번에 / 조각으로 나눠 Update (두 오버로드) 모두 확인
+static bool RunVectors(const std::string& path) {
+  std::vector<parser::NISTTestVariables> vectors;
+  if (parser::ParseHashVector(path, vectors) !=
+      parser::ReturnStatusCode::kSuccess) {
+    std::cout << "failed to parse " << path << std::endl;
+    return false;
+  }
+
+  bedrock::hash::SHA<256> sha;
+  for (auto& vector : vectors) {
+    const std::size_t bytes = vector.integer["Len"] / 8;
+    const std::span<const std::uint8_t> msg(vector.binary["Msg"].data(),
+                                            bytes);
+    std::array<std::byte, 32> expected{};
+    std::ranges::transform(vector.binary["MD"], expected.begin(),
+                           [](std::uint8_t b) { return std::byte{b}; });
+
+    if (sha.Digest(msg) != expected) {
+      std::cout << path << " one-shot mismatch, Len = " << bytes * 8
+                << std::endl;
+      return false;
+    }
+
+    // 블록 경계를 가로지르도록 37바이트씩
+    for (std::size_t offset = 0; offset < bytes; offset += 37) {
+      const std::size_t chunk = std::min<std::size_t>(37, bytes - offset);
+      bedrock::hash::HashAlgorithmInputData input;
+      input.message.resize(chunk);
+      std::memcpy(input.message.data(), msg.data() + offset, chunk);
+      input.bit_length = chunk * 8;
+      sha.Update(input);
+    }
+    if (sha.Digest() != expected) {
+      std::cout << path << " streaming mismatch, Len = " << bytes * 8
+                << std::endl;
+      return false;
+    }
+
+    // span Update: 조각 크기를 바꿔가며 (블록보다 작게 / 크게)
+    for (std::size_t offset = 0, step = 1; offset < bytes;
+         offset += step, step = (step * 7) % 150 + 1) {
+      sha.Update(msg.subspan(offset, std::min(step, bytes - offset)));
+    }
+    if (sha.Digest() != expected) {
+      std::cout << path << " span streaming mismatch, Len = " << bytes * 8
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  namespace sha256 = bedrock::hash::sha256;
+
+  if (!RunVectors("../test_vector/shabytetestvectors/SHA256ShortMsg.rsp") ||
+      !RunVectors("../test_vector/shabytetestvectors/SHA256LongMsg.rsp")) {
+    return 1;
+  }
+
+  // 각 커널과 스칼라 압축 비교. 9블록이면 두 블록씩 묶는 AVX2 커널의 홀수
+  // 꼬리도 지남
+  const bedrock::test::CompressKernel<sha256::State> kernels[] = {
+      {"dispatched", "SSE2", sha256::CompressBlocks},
+      {"scalar", "SSE2", sha256::CompressBlocksScalar},
+      {"SSSE3", "SSSE3", sha256::CompressBlocksSsse3},
+      {"AVX2", "AVX2", sha256::CompressBlocksAvx2},
+      {"SHA-NI", "SHA", sha256::CompressBlocksShaNi},
+  };
+  if (!bedrock::test::CompressKernelsMatchScalar(
+          sha256::kH0, sha256::kBlockBytes, sha256::CompressBytes, kernels)) {
+    return 1;
+  }
+
+  std::cout << "SHA-256 NIST vectors passed." << std::endl;
+  return 0;
+}
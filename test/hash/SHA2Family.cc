@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/compress_kernel_runner.h"
+#include "encryption/hash/sha.h"
+#include "encryption/util/helper.h"
+
+// FIPS 180-4 예제 메시지: 빈 문자열, "abc", 896비트 두 블록, 'a' 백만 개
+using Mds = std::array<const char*, 4>;
+
+static const std::string kTwoBlock =
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+    "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+template <typename Sha>
+static bool Check(const char* name, const Mds& mds) {
+  const std::vector<std::uint8_t> million(1000000, 'a');
+  const std::array<std::span<const std::uint8_t>, 4> messages = {
+      std::span<const std::uint8_t>(),
+      std::span(reinterpret_cast<const std::uint8_t*>("abc"), 3),
+      std::span(reinterpret_cast<const std::uint8_t*>(kTwoBlock.data()),
+                kTwoBlock.size()),
+      std::span<const std::uint8_t>(million)};
+
+  Sha sha;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto one_shot = sha.Digest(messages[i]);
+    const std::string actual = bedrock::util::BytesToHexStr(
+        std::span(reinterpret_cast<const std::uint8_t*>(one_shot.data()),
+                  one_shot.size()));
+    if (actual != mds[i]) {
+      std::cout << name << " mismatch, message " << i << "\n  expected "
+                << mds[i] << "\n  actual   " << actual << std::endl;
+      return false;
+    }
+
+    // 블록 경계를 가로지르도록 조각 크기를 바꿔가며 Update
+    const auto message = messages[i];
+    for (std::size_t offset = 0, step = 1; offset < message.size();
+         offset += step, step = (step * 13) % 1000 + 1) {
+      sha.Update(
+          message.subspan(offset, std::min(step, message.size() - offset)));
+    }
+    if (sha.Digest() != one_shot) {
+      std::cout << name << " streaming mismatch, message " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  namespace hash = bedrock::hash;
+  namespace sha512 = bedrock::hash::sha512;
+
+  const Mds sha224 = {
+      "D14A028C2A3A2BC9476102BB288234C415A2B01F828EA62AC5B3E42F",
+      "23097D223405D8228642A477BDA255B32AADBCE4BDA0B3F7E36C9DA7",
+      "C97CA9A559850CE97A04A96DEF6D99A9E0E0E2AB14E6B8DF265FC0B3",
+      "20794655980C91D8BBB4C1EA97618A4BF03F42581948B2EE4EE7AD67"};
+  const Mds sha384 = {
+      "38B060A751AC96384CD9327EB1B1E36A21FDB71114BE07434C0CC7BF63F6E1DA"
+      "274EDEBFE76F65FBD51AD2F14898B95B",
+      "CB00753F45A35E8BB5A03D699AC65007272C32AB0EDED1631A8B605A43FF5BED"
+      "8086072BA1E7CC2358BAECA134C825A7",
+      "09330C33F71147E83D192FC782CD1B4753111B173B3B05D22FA08086E3B0F712"
+      "FCC7C71A557E2DB966C3E9FA91746039",
+      "9D0E1809716474CB086E834E310A4A1CED149E9C00F248527972CEC5704C2A5B"
+      "07B8B3DC38ECC4EBAE97DDD87F3D8985"};
+  const Mds sha512_mds = {
+      "CF83E1357EEFB8BDF1542850D66D8007D620E4050B5715DC83F4A921D36CE9CE"
+      "47D0D13C5D85F2B0FF8318D2877EEC2F63B931BD47417A81A538327AF927DA3E",
+      "DDAF35A193617ABACC417349AE20413112E6FA4E89A97EA20A9EEEE64B55D39A"
+      "2192992A274FC1A836BA3C23A3FEEBBD454D4423643CE80E2A9AC94FA54CA49F",
+      "8E959B75DAE313DA8CF4F72814FC143F8F7779C6EB9F7FA17299AEADB6889018"
+      "501D289E4900F7E4331B99DEC4B5433AC7D329EEB6DD26545E96E55B874BE909",
+      "E718483D0CE769644E2E42C7BC15B4638E1F98B13B2044285632A803AFA973EB"
+      "DE0FF244877EA60A4CB0432CE577C31BEB009C5C2C49AA2E4EADB217AD8CC09B"};
+  const Mds sha512_256 = {
+      "C672B8D1EF56ED28AB87C3622C5114069BDD3AD7B8F9737498D0C01ECEF0967A",
+      "53048E2681941EF99B2E29B76B4C7DABE4C2D0C634FC6D46E0E2F13107E7AF23",
+      "3928E184FB8690F840DA3988121D31BE65CB9D3EF83EE6146FEAC861E19B563A",
+      "9A59A052930187A97038CAE692F30708AA6491923EF5194394DC68D56C74FB21"};
+
+  if (!Check<hash::SHA224>("SHA-224", sha224) ||
+      !Check<hash::SHA384>("SHA-384", sha384) ||
+      !Check<hash::SHA512>("SHA-512", sha512_mds) ||
+      !Check<hash::SHA512_256>("SHA-512/256", sha512_256)) {
+    return 1;
+  }
+
+  // 각 커널과 스칼라 압축 비교. 9블록이면 두 블록씩 묶는 AVX2 커널의 홀수
+  // 꼬리도 지남
+  const bedrock::test::CompressKernel<sha512::State> kernels[] = {
+      {"dispatched", "SSE2", sha512::CompressBlocks},
+      {"scalar", "SSE2", sha512::CompressBlocksScalar},
+      {"SSSE3", "SSSE3", sha512::CompressBlocksSsse3},
+      {"AVX2", "AVX2", sha512::CompressBlocksAvx2},
+  };
+  if (!bedrock::test::CompressKernelsMatchScalar(
+          sha512::kH0, sha512::kBlockBytes, sha512::CompressBytes, kernels)) {
+    return 1;
+  }
+
+  std::cout << "SHA-2 family vectors passed." << std::endl;
+  return 0;
+}
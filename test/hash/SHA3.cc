@@ -0,0 +1,277 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/intrinsics.h"
+#include "encryption/hash/sha3.h"
+#include "encryption/hash/sha3_multi.h"
+#include "encryption/util/helper.h"
+
+namespace hash = bedrock::hash;
+
+static std::string Hex(std::span<const std::uint8_t> bytes) {
+  return bedrock::util::BytesToHexStr(bytes);
+}
+
+template <std::size_t N>
+static std::string Hex(const std::array<std::byte, N>& bytes) {
+  return Hex(std::span(reinterpret_cast<const std::uint8_t*>(bytes.data()), N));
+}
+
+// 빈 메시지 / "abc" / 패턴 1000바이트. 한 번에 / 조각으로 나눠 Update
+template <typename Sha>
+static bool Check(const char* name, std::span<const std::uint8_t> pattern,
+                  const std::array<const char*, 3>& mds) {
+  const std::array<std::span<const std::uint8_t>, 3> messages = {
+      std::span<const std::uint8_t>(),
+      std::span(reinterpret_cast<const std::uint8_t*>("abc"), 3), pattern};
+
+  Sha sha;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto one_shot = sha.Digest(messages[i]);
+    if (Hex(one_shot) != mds[i]) {
+      std::cout << name << " mismatch, message " << i << "\n  expected "
+                << mds[i] << "\n  actual   " << Hex(one_shot) << std::endl;
+      return false;
+    }
+
+    const auto message = messages[i];
+    for (std::size_t offset = 0, step = 1; offset < message.size();
+         offset += step, step = (step * 13) % 300 + 1) {
+      sha.Update(
+          message.subspan(offset, std::min(step, message.size() - offset)));
+    }
+    if (sha.Digest() != one_shot) {
+      std::cout << name << " streaming mismatch, message " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// 300바이트를 조각으로 짜낸 결과가 한 번에 짜낸 것과 같고 끝 32바이트가 맞는지
+template <typename Shake>
+static bool CheckXof(const char* name, std::span<const std::uint8_t> message,
+                     const char* last32) {
+  Shake shake;
+  std::vector<std::uint8_t> expected(300);
+  shake.Digest(message, expected);
+
+  std::vector<std::uint8_t> out(300);
+  shake.Update(message);
+  for (std::size_t offset = 0; offset < out.size(); offset += 7) {
+    shake.Squeeze(std::span(out).subspan(
+        offset, std::min<std::size_t>(7, out.size() - offset)));
+  }
+  shake.Reset();
+
+  if (out != expected || Hex(std::span(out).last(32)) != last32) {
+    std::cout << name << " XOF mismatch\n  expected " << last32
+              << "\n  actual   " << Hex(std::span(out).last(32)) << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// bit 길이 입력 (FIPS 202 B.1 순서, 마지막 바이트는 하위 bit부터)
+static hash::HashAlgorithmInputData Bits(std::span<const std::uint8_t> bytes,
+                                         std::uint64_t bit_length) {
+  hash::HashAlgorithmInputData data;
+  for (const std::uint8_t byte : bytes) {
+    data.message.push_back(static_cast<std::byte>(byte));
+  }
+  data.bit_length = bit_length;
+  return data;
+}
+
+static bool CheckBits() {
+  // NIST FIPS 202 예제 (SHA3-256 5 / 30 bit, SHA3-224 5 bit)
+  const std::array<std::uint8_t, 4> msg30 = {0x53, 0x58, 0x7B, 0x19};
+  const std::array<std::uint8_t, 1> msg5 = {0x13};
+  hash::SHA3_256 sha3_256;
+  hash::SHA3_224 sha3_224;
+  sha3_256.Update(Bits(msg5, 5));
+  const std::string md5 = Hex(sha3_256.Digest());
+  sha3_256.Update(Bits(msg30, 30));
+  const std::string md30 = Hex(sha3_256.Digest());
+  sha3_224.Update(Bits(msg5, 5));
+  if (md5 !=
+          "7B0047CF5A456882363CBF0FB05322CF65F4B7059A46365E830132E3B5D957AF" ||
+      md30 !=
+          "C8242FEF409E5AE9D1F1C857AE4DC624B92B19809F62AA8C07411C54A078B1D0" ||
+      Hex(sha3_224.Digest()) !=
+          "FFBAD5DA96BAD71789330206DC6768ECAEB1B32DCA6B3301489674AB") {
+    std::cout << "SHA-3 bit-length message mismatch" << std::endl;
+    return false;
+  }
+
+  // 남는 bit와 패딩이 블록 끝을 넘거나, pad의 첫 1이 블록 마지막 bit에 오는 경우
+  std::vector<std::uint8_t> block(136);
+  for (std::size_t i = 0; i < block.size(); i++) {
+    block[i] = static_cast<std::uint8_t>((i * 7) + 1);
+  }
+  sha3_256.Update(Bits(block, (135 * 8) + 5));
+  const std::string first_one_last = Hex(sha3_256.Digest());
+  sha3_256.Update(Bits(block, (135 * 8) + 7));
+  const std::string spilled = Hex(sha3_256.Digest());
+  hash::SHAKE256 shake256;
+  shake256.Update(Bits(block, (135 * 8) + 3));
+  hash::SHAKE128 shake128;
+  shake128.Update(Bits(msg5, 5));
+  if (first_one_last !=
+          "52C6D80C30589D7AA12FD7E01DE3A0C857987C35D5A295E7BEB6A06C397690E4" ||
+      spilled !=
+          "AFF0164D18BDF06ABD5DE6AD3CD7AE43B6AC53C26FD4A08339194D811550BE32" ||
+      Hex(shake256.Digest()).substr(0, 64) !=
+          "E8A6F0974E6642824186DF3D3004639DB0D1DCCDAB55678CAC6D1509F6ED81DA" ||
+      Hex(shake128.Digest()) !=
+          "2E0ABFBA83E6720BFBC225FF6B7AB9FFCE58BA027EE3D898764FEF287DDECCCA") {
+    std::cout << "SHA-3 bit-length padding mismatch at block boundary"
+              << std::endl;
+    return false;
+  }
+
+  // 바이트 중간에서 끝난 뒤나 짜내기 시작한 뒤의 입력은 거부
+  std::array<std::uint8_t, 8> out{};
+  sha3_256.Update(Bits(msg5, 5));
+  const bool after_bits = sha3_256.Update(msg30);
+  shake128.Update(msg30);
+  shake128.Squeeze(out);
+  const bool after_squeeze = shake128.Update(msg30);
+  shake128.Reset();
+  if (after_bits || after_squeeze || Hex(sha3_256.Digest()) != md5 ||
+      !shake128.Update(msg30)) {
+    std::cout << "SHA-3 accepted input after the message ended" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <std::size_t kBytes>
+static bool CheckMany(const std::vector<std::vector<std::uint8_t>>& storage) {
+  namespace sha3 = bedrock::hash::sha3;
+  const std::vector<std::span<const std::uint8_t>> messages(storage.begin(),
+                                                            storage.end());
+  std::vector<sha3::Digest<kBytes>> digests(messages.size());
+  if (!sha3::DigestMany(messages, std::span(digests))) {
+    std::cout << "DigestMany failed" << std::endl;
+    return false;
+  }
+
+  const hash::SHA3<kBytes * 8> single;
+  for (std::size_t i = 0; i < messages.size(); i++) {
+    const auto expected = single.Digest(messages[i]);
+    if (std::memcmp(expected.data(), digests[i].data(), kBytes) != 0) {
+      std::cout << "SHA3-" << kBytes * 8 << " DigestMany mismatch at message "
+                << i << " (" << storage[i].size() << " bytes)" << std::endl;
+      return false;
+    }
+  }
+  return !sha3::DigestMany(messages, std::span(digests).first(1));
+}
+
+int main() {
+  namespace keccak = bedrock::hash::keccak;
+
+  std::vector<std::uint8_t> pattern(1000);
+  for (std::size_t i = 0; i < pattern.size(); i++) {
+    pattern[i] = static_cast<std::uint8_t>((i * 31) + 7);
+  }
+
+  using Mds = std::array<const char*, 3>;
+  const Mds sha3_224 = {
+      "6B4E03423667DBB73B6E15454F0EB1ABD4597F9A1B078E3F5B5A6BC7",
+      "E642824C3F8CF24AD09234EE7D3C766FC9A3A5168D0C94AD73B46FDF",
+      "7989DFD171A962C2DDEF4CA6034A480E33F92D9EC131D6E378309CEE"};
+  const Mds sha3_256 = {
+      "A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A",
+      "3A985DA74FE225B2045C172D6BD390BD855F086E3E9D525B46BFE24511431532",
+      "E9612E6ECFC2FC3C9467302E2563D3155906EAF49E0BB663E460791EF2FEC839"};
+  const Mds sha3_384 = {
+      "0C63A75B845E4F7D01107D852E4C2485C51A50AAAA94FC61995E71BBEE983A2A"
+      "C3713831264ADB47FB6BD1E058D5F004",
+      "EC01498288516FC926459F58E2C6AD8DF9B473CB0FC08C2596DA7CF0E49BE4B2"
+      "98D88CEA927AC7F539F1EDF228376D25",
+      "70F30A5988EDF28989C9D1BCE5B07762120FBF8C9F53A466DB2A02AED8C0F08B"
+      "D24F70A57DA28269C565575524967823"};
+  const Mds sha3_512 = {
+      "A69F73CCA23A9AC5C8B567DC185A756E97C982164FE25859E0D1DCC1475C80A6"
+      "15B2123AF1F5F94C11E3E9402C3AC558F500199D95B6D3E301758586281DCD26",
+      "B751850B1A57168A5693CD924B6B096E08F621827444F70D884F5D0240D2712E"
+      "10E116E9192AF3C91A7EC57647E3934057340B4CF408D5A56592F8274EEC53F0",
+      "842D060A3F1A6D6B80AAF57258F0EDB7E1C0ABCFA112479AC989B1527D0B0C5E"
+      "F6DA88B7F6C80CD05A7A1E08D46865BF02620044DED6EF5C21C8902A38D4F909"};
+  if (!Check<hash::SHA3_224>("SHA3-224", pattern, sha3_224) ||
+      !Check<hash::SHA3_256>("SHA3-256", pattern, sha3_256) ||
+      !Check<hash::SHA3_384>("SHA3-384", pattern, sha3_384) ||
+      !Check<hash::SHA3_512>("SHA3-512", pattern, sha3_512)) {
+    return 1;
+  }
+
+  // HashAlgorithm 인터페이스의 고정 길이 출력 (SHAKE128 256비트, SHAKE256 512비트)
+  if (Hex(hash::SHAKE128().Digest(std::span<const std::uint8_t>())) !=
+          "7F9C2BA4E88F827D616045507605853ED73B8093F6EFBC88EB1A6EACFA66EF26" ||
+      Hex(hash::SHAKE256().Digest(std::span<const std::uint8_t>())) !=
+          "46B9DD2B0BA88D13233B3FEB743EEB243FCD52EA62B81B82B50C27646ED5762F"
+          "D75DC4DDD8C0F200CB05019D67B592F6FC821C49479AB48640292EACB3B7C4BE") {
+    std::cout << "SHAKE empty message mismatch" << std::endl;
+    return 1;
+  }
+  const auto abc = std::span(reinterpret_cast<const std::uint8_t*>("abc"), 3);
+  if (!CheckXof<hash::SHAKE128>(
+          "SHAKE128", abc,
+          "4B8F5774AA1482CFA58F83096BDB2E06A3EED543A38919B57ECBEC737F4086BE") ||
+      !CheckXof<hash::SHAKE256>(
+          "SHAKE256", pattern,
+          "94B193CE2ED65194823745AFBB708A454A74418F30B23E581944778C9C7CE55D")) {
+    return 1;
+  }
+
+  if (!CheckBits()) {
+    return 1;
+  }
+
+  // rate(136 / 72바이트) 경계 근처 길이를 섞어 레인이 여러 번 다시 채워지도록
+  std::vector<std::vector<std::uint8_t>> storage;
+  for (std::size_t i = 0; i < 23; i++) {
+    const std::size_t size =
+        (i % 4 == 0) ? (i * 61) : (70 + (i % 3) + ((i / 8) * 64));
+    storage.emplace_back(pattern.begin(),
+                         pattern.begin() + static_cast<std::ptrdiff_t>(size));
+  }
+  if (!CheckMany<32>(storage) || !CheckMany<64>(storage)) {
+    return 1;
+  }
+
+  // 4레인 순열과 스칼라 순열 비교
+  const auto reg = bedrock::intrinsic::GetCPUFeatures();
+  if (bedrock::intrinsic::IsCpuEnabledFeature(reg, "AVX2")) {
+    std::array<keccak::State, 4> expected{};
+    std::array<std::uint64_t, 25 * 4> lanes{};
+    for (std::size_t s = 0; s < 4; s++) {
+      for (std::size_t i = 0; i < 25; i++) {
+        expected[s][i] = (i * 0x9E3779B97F4A7C15ULL) ^ (s << 40);
+        lanes[(i * 4) + s] = expected[s][i];
+      }
+      keccak::Permute(expected[s]);
+    }
+    keccak::PermuteX4Avx2(lanes.data());
+    for (std::size_t s = 0; s < 4; s++) {
+      for (std::size_t i = 0; i < 25; i++) {
+        if (lanes[(i * 4) + s] != expected[s][i]) {
+          std::cout << "AVX2 permutation differs from scalar" << std::endl;
+          return 1;
+        }
+      }
+    }
+  }
+
+  std::cout << "SHA-3 / SHAKE vectors passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "encryption/hash/sha.h"
+
+namespace hash = bedrock::hash;
+
+// 임의의 지점에서 Export한 상태를 바이트로 저장했다가 새 객체에 Import해
+// 나머지를 이어 넣으면 한 번에 계산한 다이제스트와 같아야 함
+template <typename Sha>
+static bool CheckResume(const char* name, std::span<const std::uint8_t> data) {
+  const Sha reference;
+  const auto expected = reference.Digest(data);
+
+  for (std::size_t split = 0; split <= data.size(); split += 37) {
+    Sha first;
+    first.Update(data.first(split));
+
+    std::vector<std::uint8_t> saved(sizeof(typename Sha::Midstate));
+    const auto exported = first.Export();
+    std::memcpy(saved.data(), &exported, saved.size());
+
+    typename Sha::Midstate loaded;
+    std::memcpy(&loaded, saved.data(), saved.size());
+    Sha second;
+    if (!second.Import(loaded)) {
+      std::cout << name << " Import rejected a valid midstate" << std::endl;
+      return false;
+    }
+    second.Update(data.subspan(split));
+    if (second.Digest() != expected) {
+      std::cout << name << " resumed digest mismatch at split " << split
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  std::vector<std::uint8_t> data(1000);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<std::uint8_t>((i * 131) + 7);
+  }
+  if (!CheckResume<hash::SHA1>("SHA-1", data) ||
+      !CheckResume<hash::SHA224>("SHA-224", data) ||
+      !CheckResume<hash::SHA256>("SHA-256", data) ||
+      !CheckResume<hash::SHA384>("SHA-384", data) ||
+      !CheckResume<hash::SHA512>("SHA-512", data) ||
+      !CheckResume<hash::SHA512_256>("SHA-512/256", data)) {
+    return 1;
+  }
+
+  // 비트 단위 입력이 버퍼에 남은 상태도 그대로 이어짐
+  hash::HashAlgorithmInputData bits;
+  bits.message = {std::byte{0xa5}, std::byte{0xc0}};
+  bits.bit_length = 11;
+  hash::SHA256 partial;
+  partial.Update(bits);
+  hash::SHA256 resumed;
+  if (!resumed.Import(partial.Export()) ||
+      resumed.Digest() != partial.Digest()) {
+    std::cout << "SHA-256 bit-level midstate mismatch" << std::endl;
+    return 1;
+  }
+
+  // 다른 알고리즘, 블록 배수가 아닌 길이, 버퍼보다 긴 꼬리는 거부
+  hash::SHA256 sha;
+  sha.Update(std::span(data).first(100));
+  const auto valid = sha.Export();
+  auto wrong_algorithm = valid;
+  wrong_algorithm.digest_bits = 224;
+  auto wrong_length = valid;
+  wrong_length.total_bits += 8;
+  auto wrong_buffer = valid;
+  wrong_buffer.buffered_bits = 512;
+  wrong_buffer.total_bits = 1024;
+  hash::SHA256 target;
+  if (target.Import(wrong_algorithm) || target.Import(wrong_length) ||
+      target.Import(wrong_buffer) ||
+      target.Digest() != hash::SHA256().Digest({})) {
+    std::cout << "Import accepted an invalid midstate" << std::endl;
+    return 1;
+  }
+
+  std::cout << "SHA midstate tests passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "encryption/hash/scrypt.h"
+#include "encryption/util/helper.h"
+
+namespace hash = bedrock::hash;
+
+static std::vector<std::uint8_t> Bytes(const std::string& text) {
+  return {text.begin(), text.end()};
+}
+
+// RFC 7914 12절 (1 GiB짜리 네 번째 예제 제외) + p가 홀수라 AVX2 두 레인
+// 묶음과 단일 레인이 섞이는 경우. 스레드 수를 바꿔도 결과가 같아야 함
+int main() {
+  const struct {
+    std::string password;
+    std::string salt;
+    hash::ScryptParams params;
+    const char* dk;
+  } cases[] = {
+      {"", "", {16, 1, 1},
+       "77D6576238657B203B19CA42C18A0497F16B4844E3074AE8DFDFFA3FEDE21442"
+       "FCD0069DED0948F8326A753A0FC81F17E8D3E0FB2E0D3628CF35E20C38D18906"},
+      {"password", "NaCl", {1024, 8, 16},
+       "FDBABE1C9D3472007856E7190D01E9FE7C6AD7CBC8237830E77376634B373162"
+       "2EAF30D92E22A3886FF109279D9830DAC727AFB94A83EE6D8360CBDFA2CC0640"},
+      {"pleaseletmein", "SodiumChloride", {16384, 8, 1},
+       "7023BDCB3AFD7348461C06CD81FD38EBFDA8FBBA904F8E3EA9B543F6545DA1F2"
+       "D5432955613F0FCF62D49705242A9AF9E61E85DC0D651E40DFCF017B45575887"},
+      {"bedrock", "lanes", {64, 3, 5},
+       "039A237049751BDB822BCE40035C4222F03AA9277BC8359E77ECDEFB1BA51F40"
+       "E899DAB243C61D72"},
+  };
+
+  hash::ScryptScratch scratch;
+  for (const auto& test : cases) {
+    for (const std::size_t threads : {std::size_t{1}, std::size_t{3}}) {
+      std::vector<std::uint8_t> dk(std::string(test.dk).size() / 2);
+      if (!hash::Scrypt(Bytes(test.password), Bytes(test.salt), test.params,
+                        dk, scratch, threads) ||
+          bedrock::util::BytesToHexStr(dk) != test.dk) {
+        std::cout << "scrypt mismatch (" << threads << " threads)\n  expected "
+                  << test.dk << "\n  actual   "
+                  << bedrock::util::BytesToHexStr(dk) << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  // 이미 충분히 큰 작업 메모리는 다시 잡지 않음
+  const std::uint8_t* reserved = scratch.Data();
+  std::vector<std::uint8_t> dk(32);
+  if (!hash::Scrypt(Bytes("again"), Bytes("salt"), {1024, 8, 1}, dk,
+                    scratch) ||
+      scratch.Data() != reserved ||
+      dk != [&] {
+        std::vector<std::uint8_t> fresh(32);
+        hash::Scrypt(Bytes("again"), Bytes("salt"), {1024, 8, 1}, fresh);
+        return fresh;
+      }()) {
+    std::cout << "scrypt scratch reuse failed" << std::endl;
+    return 1;
+  }
+
+  const hash::ScryptParams invalid[] = {
+      {0, 8, 1}, {1, 8, 1}, {1000, 8, 1}, {16, 0, 1}, {16, 8, 0},
+      {std::uint64_t{1} << 16, 1, 1}, {16, 1 << 15, 1 << 15}};
+  for (const auto& params : invalid) {
+    if (hash::Scrypt(Bytes("p"), Bytes("s"), params, dk)) {
+      std::cout << "scrypt accepted invalid parameters" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "scrypt vectors passed." << std::endl;
+  return 0;
+}
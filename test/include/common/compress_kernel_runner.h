@@ -0,0 +1,63 @@
+#pragma once
+// 해시 압축 커널 공통 테스트 러너.
+// - CompressKernelsMatchScalar: 커널 표의 각 커널(CPU가 지원하는 것만)이
+//   블록 단위 스칼라 압축(CompressBytes)과 같은 상태를 내는지 확인
+//
+// 사용 예:
+//   const bedrock::test::CompressKernel<sha1::State> kernels[] = {
+//       {"scalar", "SSE2", sha1::CompressBlocksScalar}, ...};
+//   if (!bedrock::test::CompressKernelsMatchScalar(
+//           sha1::kH0, sha1::kBlockBytes, sha1::CompressBytes, kernels))
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "common/intrinsics.h"
+
+namespace bedrock::test {
+
+template <typename State>
+struct CompressKernel {
+  const char* name;
+  // IsCpuEnabledFeature에 넘길 이름
+  const char* feature;
+  void (*compress)(State&, const std::uint8_t*, std::size_t) noexcept;
+};
+
+// blocks개의 블록을 한 번에 넘겨 비교. 기본값 9는 홀수라 여러 블록을
+// 묶어 처리하는 커널의 꼬리 블록도 지남
+template <typename State>
+bool CompressKernelsMatchScalar(
+    const State& h0, std::size_t block_bytes,
+    void (*compress_bytes)(State&, const std::uint8_t*),
+    std::span<const std::type_identity_t<CompressKernel<State>>> kernels,
+    std::size_t blocks = 9) {
+  std::vector<std::uint8_t> data(blocks * block_bytes);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<std::uint8_t>((i * 131) + 7);
+  }
+  State expected = h0;
+  for (std::size_t offset = 0; offset < data.size(); offset += block_bytes) {
+    compress_bytes(expected, data.data() + offset);
+  }
+
+  const auto reg = bedrock::intrinsic::GetCPUFeatures();
+  for (const auto& kernel : kernels) {
+    if (!bedrock::intrinsic::IsCpuEnabledFeature(reg, kernel.feature)) {
+      continue;
+    }
+    State state = h0;
+    kernel.compress(state, data.data(), blocks);
+    if (state != expected) {
+      std::cout << kernel.name << " compress differs from scalar" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace bedrock::test
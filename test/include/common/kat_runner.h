@@ -1,6 +1,8 @@
 #pragma once
 // NIST AES KAT/MMT 테스트 공통 러너.
 // CBC(IV 있음) / ECB(IV 없음) 양쪽을 concept으로 분기.
+// ChunkBytes: Process 한 번에 넘기는 바이트 수 (마지막 조각은 남은 길이만큼).
+//   CFB8처럼 블록 단위가 아닌 모드나, 여러 블록을 한번에 넘기는 경로 검증용.
 //
 // 사용 예:
 //   return bedrock::test::RunKatTest<bedrock::cipher::AES_CBC,
@@ -61,7 +63,7 @@ auto MakeCipher(const P::NISTTestVariables& item) {
   }
 }
 
-template <typename Algorithm>
+template <typename Algorithm, std::size_t ChunkBytes>
 bool ProcessOne(const P::NISTTestVariables& item, P::VectorCategory cat,
                 Algorithm& cipher) {
   namespace om = bedrock::cipher::op_mode;
@@ -86,12 +88,15 @@ bool ProcessOne(const P::NISTTestVariables& item, P::VectorCategory cat,
   std::vector<std::uint8_t> result;
   result.reserve(exp_bytes.size());
 
-  for (std::uint32_t i = 0; (i + 1) * 16 <= in_bytes.size(); ++i) {
-    std::vector<std::uint8_t> input_block(in_bytes.begin() + i * 16,
-                                          in_bytes.begin() + i * 16 + 16);
-    std::vector<std::uint8_t> expected_block(exp_bytes.begin() + i * 16,
-                                             exp_bytes.begin() + i * 16 + 16);
-    std::vector<std::uint8_t> output_block(16);
+  for (std::uint32_t i = 0; i * ChunkBytes < in_bytes.size(); ++i) {
+    const auto offset = static_cast<std::ptrdiff_t>(i * ChunkBytes);
+    const auto len = static_cast<std::ptrdiff_t>(
+        (std::min)(ChunkBytes, in_bytes.size() - (i * ChunkBytes)));
+    std::vector<std::uint8_t> input_block(in_bytes.begin() + offset,
+                                          in_bytes.begin() + offset + len);
+    std::vector<std::uint8_t> expected_block(exp_bytes.begin() + offset,
+                                             exp_bytes.begin() + offset + len);
+    std::vector<std::uint8_t> output_block(input_block.size());
 
     cipher.Process(input_block, output_block);
     std::copy(output_block.begin(), output_block.end(),
@@ -124,7 +129,7 @@ bool ProcessOne(const P::NISTTestVariables& item, P::VectorCategory cat,
   return true;
 }
 
-template <typename Algorithm, std::size_t KeyBytes>
+template <typename Algorithm, std::size_t KeyBytes, std::size_t ChunkBytes>
 bool RunDirection(const std::vector<P::NISTTestVariables>& vectors,
                   P::VectorCategory cat, const std::string& test_name) {
   std::cout << test_name << " "
@@ -133,14 +138,75 @@ bool RunDirection(const std::vector<P::NISTTestVariables>& vectors,
             << ":" << std::endl;
   for (const auto& item : vectors) {
     auto cipher = MakeCipher<Algorithm, KeyBytes>(item);
-    if (!ProcessOne(item, cat, cipher)) return false;
+    if (!ProcessOne<Algorithm, ChunkBytes>(item, cat, cipher)) return false;
+  }
+  return true;
+}
+
+// "1101" 같은 bit 문자열을 MSB부터 바이트에 채움 (남는 bit는 0)
+inline std::vector<std::uint8_t> PackBits(const std::string& bits) {
+  std::vector<std::uint8_t> bytes((bits.size() + 7) / 8);
+  for (std::size_t i = 0; i < bits.size(); ++i) {
+    if (bits[i] == '1') {
+      bytes[i / 8] =
+          static_cast<std::uint8_t>(bytes[i / 8] | (0x80U >> (i % 8)));
+    }
+  }
+  return bytes;
+}
+
+inline std::string UnpackBits(const std::vector<std::uint8_t>& bytes,
+                              std::size_t count) {
+  std::string bits(count, '0');
+  for (std::size_t i = 0; i < count; ++i) {
+    if ((bytes[i / 8] & (0x80U >> (i % 8))) != 0) {
+      bits[i] = '1';
+    }
+  }
+  return bits;
+}
+
+template <std::size_t KeyBytes>
+bool RunCfb1Direction(const std::vector<P::NISTTestVariables>& vectors,
+                      P::VectorCategory cat, const std::string& test_name) {
+  namespace om = bedrock::cipher::op_mode;
+  const bool encrypt = (cat == P::VectorCategory::kEncrypt);
+  const char* in_label = encrypt ? "PLAINTEXT" : "CIPHERTEXT";
+  const char* out_label = encrypt ? "CIPHERTEXT" : "PLAINTEXT";
+  std::cout << test_name << " " << (encrypt ? "Encryption" : "Decryption")
+            << ":" << std::endl;
+
+  for (const auto& item : vectors) {
+    auto cipher = MakeCipher<bedrock::cipher::AesCfb1, KeyBytes>(item);
+    cipher << (encrypt ? om::CipherMode::kEncrypt : om::CipherMode::kDecrypt);
+
+    const std::string& in_bits = item.text.at(in_label);
+    const std::string& exp_bits = item.text.at(out_label);
+    const std::vector<std::uint8_t> input = PackBits(in_bits);
+    std::vector<std::uint8_t> output(input.size());
+    if (cipher.Process(input, output) !=
+        bedrock::cipher::ErrorStatus::kSuccess) {
+      std::cout << "Process failed" << std::endl;
+      return false;
+    }
+
+    // 패딩 bit는 앞쪽 bit의 결과에 영향을 주지 않으므로 앞쪽만 비교
+    const std::string result = UnpackBits(output, in_bits.size());
+    std::cout << in_label << ": " << in_bits << "\n";
+    std::cout << "EXPECTED: " << exp_bits << "\n";
+    std::cout << out_label << ": " << result << "\n";
+    if (result != exp_bits) {
+      std::cout << "Mismatch" << std::endl;
+      return false;
+    }
   }
   return true;
 }
 
 }  // namespace _kat
 
-template <typename Algorithm, std::size_t KeyBytes>
+template <typename Algorithm, std::size_t KeyBytes,
+          std::size_t ChunkBytes = 16>
 int RunKatTest(const std::string& test_name,
                const std::string& subdir = "KAT_AES") {
   namespace P = bedrock::util::NISTTestVectorParser;
@@ -154,11 +220,36 @@ int RunKatTest(const std::string& test_name,
   if (!_kat::LoadOrPrintError(path, P::VectorCategory::kDecrypt, dec))
     return -1;
 
-  if (!_kat::RunDirection<Algorithm, KeyBytes>(enc, P::VectorCategory::kEncrypt,
-                                               test_name))
+  if (!_kat::RunDirection<Algorithm, KeyBytes, ChunkBytes>(
+          enc, P::VectorCategory::kEncrypt, test_name))
+    return -1;
+  if (!_kat::RunDirection<Algorithm, KeyBytes, ChunkBytes>(
+          dec, P::VectorCategory::kDecrypt, test_name))
+    return -1;
+  return 0;
+}
+
+// CFB1 벡터는 PLAINTEXT / CIPHERTEXT가 bit 문자열이므로 따로 처리.
+// bit를 MSB부터 바이트로 묶어 AesCfb1에 한번에 넘기고 결과의 앞쪽 bit를 비교
+template <std::size_t KeyBytes>
+int RunCfb1KatTest(const std::string& test_name,
+                   const std::string& subdir = "KAT_AES") {
+  namespace P = bedrock::util::NISTTestVectorParser;
+  const std::string path =
+      "../test_vector/" + subdir + "/" + test_name + ".rsp";
+
+  std::vector<P::NISTTestVariables> enc;
+  std::vector<P::NISTTestVariables> dec;
+  if (!_kat::LoadOrPrintError(path, P::VectorCategory::kEncrypt, enc))
+    return -1;
+  if (!_kat::LoadOrPrintError(path, P::VectorCategory::kDecrypt, dec))
+    return -1;
+
+  if (!_kat::RunCfb1Direction<KeyBytes>(enc, P::VectorCategory::kEncrypt,
+                                        test_name))
     return -1;
-  if (!_kat::RunDirection<Algorithm, KeyBytes>(dec, P::VectorCategory::kDecrypt,
-                                               test_name))
+  if (!_kat::RunCfb1Direction<KeyBytes>(dec, P::VectorCategory::kDecrypt,
+                                        test_name))
     return -1;
   return 0;
 }
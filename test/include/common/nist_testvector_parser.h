@@ -20,6 +20,8 @@ enum class DRBGFunctionName {
 struct NISTTestVariables {
   std::unordered_map<std::string, std::uint32_t> integer;
   std::unordered_map<std::string, std::vector<std::uint8_t>> binary;
+  // 파일에 적힌 값 그대로 (CFB1처럼 16진수가 아닌 bit 문자열용)
+  std::unordered_map<std::string, std::string> text;
 };
 
 struct NISTTestMonteSample {
@@ -0,0 +1,17 @@
+#include <array>
+
+#include "common/block_cipher_runner.h"
+#include "encryption/cipher/lea.h"
+
+// KS X 3246 부록 테스트 벡터
+int main() {
+  const std::array<bedrock::test::BlockVector, 3> vectors = {{
+      {"0f1e2d3c4b5a69788796a5b4c3d2e1f0", "101112131415161718191a1b1c1d1e1f",
+       "9FC84E3528C6C6185532C7A704648BFD"},
+      {"0f1e2d3c4b5a69788796a5b4c3d2e1f0f0e1d2c3b4a59687",
+       "202122232425262728292a2b2c2d2e2f", "6FB95E325AAD1B878CDCF5357674C6F2"},
+      {"0f1e2d3c4b5a69788796a5b4c3d2e1f0f0e1d2c3b4a5968778695a4b3c2d1e0f",
+       "303132333435363738393a3b3c3d3e3f", "D651AFF647B189C13A8900CA27F9E197"},
+  }};
+  return bedrock::test::RunBlockKat<bedrock::cipher::Lea>("LEA", vectors);
+}
@@ -0,0 +1,7 @@
+#include "common/block_cipher_runner.h"
+#include "encryption/cipher/lea.h"
+
+// SSE2 4-way / AVX2 8-way 커널이 블록 단위 처리와 같은지 확인
+int main() {
+  return bedrock::test::RunBulkMatchesSingle<bedrock::cipher::Lea>("LEA");
+}
@@ -233,6 +233,7 @@ ReturnStatusCode ParseCipherVector(const std::filesystem::path& file_path,
         test_vectors.emplace_back();
       }
       test_vectors[count].binary[var_name] = HexStrToBytes(var_value);
+      test_vectors[count].text[var_name] = var_value;
     }
   }
 
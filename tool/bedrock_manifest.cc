@@ -0,0 +1,85 @@
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "encryption/hash/manifest.h"
+
+namespace hash = bedrock::hash;
+
+static constexpr std::string_view kUsage =
+    "usage: bedrock_manifest [-j THREADS] [--merkle[=LEAF_BYTES]] "
+    "[-o FILE] DIR\n"
+    "  Writes the SHA-256 of every regular file under DIR in sha256sum "
+    "format.\n"
+    "  -j THREADS            worker threads (default: number of cores)\n"
+    "  --merkle[=LEAF_BYTES] Merkle tree root per file (default leaf 1 MiB)\n"
+    "  -o FILE               write to FILE instead of stdout\n";
+
+static bool ParseSize(std::string_view text, std::size_t& value) {
+  const char* end = text.data() + text.size();
+  const auto result = std::from_chars(text.data(), end, value);
+  return result.ec == std::errc() && result.ptr == end;
+}
+
+int main(int argc, char** argv) {
+  hash::ManifestOptions options;
+  std::filesystem::path root;
+  std::filesystem::path output;
+
+  const std::vector<std::string_view> args(argv + 1, argv + argc);
+  for (std::size_t i = 0; i < args.size(); i++) {
+    const std::string_view arg = args[i];
+    if (arg == "-j" && i + 1 < args.size() &&
+        ParseSize(args[i + 1], options.threads)) {
+      i++;
+    } else if (arg == "-o" && i + 1 < args.size()) {
+      output = args[++i];
+    } else if (arg == "--merkle") {
+      options.digest = hash::ManifestDigest::kMerkle;
+    } else if (arg.starts_with("--merkle=") &&
+               ParseSize(arg.substr(9), options.leaf_bytes) &&
+               options.leaf_bytes != 0) {
+      options.digest = hash::ManifestDigest::kMerkle;
+    } else if (root.empty() && !arg.starts_with('-')) {
+      root = arg;
+    } else {
+      std::cerr << kUsage;
+      return 2;
+    }
+  }
+  if (root.empty()) {
+    std::cerr << kUsage;
+    return 2;
+  }
+
+  std::vector<hash::ManifestEntry> entries;
+  const bool complete = hash::BuildManifest(root, options, entries);
+  const std::string text = hash::FormatManifest(entries);
+
+  if (output.empty()) {
+    std::cout << text;
+  } else {
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    file << text;
+    if (!file) {
+      std::cerr << "bedrock_manifest: cannot write " << output << std::endl;
+      return 1;
+    }
+  }
+
+  for (const hash::ManifestEntry& entry : entries) {
+    if (!entry.readable) {
+      std::cerr << "bedrock_manifest: cannot read " << (root / entry.path)
+                << std::endl;
+    }
+  }
+  if (!complete) {
+    std::cerr << "bedrock_manifest: manifest is incomplete" << std::endl;
+    return 1;
+  }
+  return 0;
+}